@@ -56,6 +56,7 @@
 
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <algorithm>
 #include <float.h>
 #include <iostream>
 #include <limits.h>
@@ -115,7 +116,10 @@ InspectorGadget::InspectorGadget(QWidget* parent, int indent, ComboHighlightBrid
     m_showAllFields(true),
     m_recursive(false),
     m_unitSystem(IP),
-    m_workspaceObjectChanged(false)
+    m_workspaceObjectChanged(false),
+    m_fieldsLayout(nullptr),
+    m_extensibleToolBar(nullptr),
+    m_numNonextensibleFields(0)
 //m_workspaceObjs(std::vector<openstudio::OptionalWorkspaceObject>&())
 {
   m_layout = new QVBoxLayout(this);
@@ -146,7 +150,10 @@ InspectorGadget::InspectorGadget(WorkspaceObject& workspaceObj, int indent, Comb
     m_showAllFields(showAllFields),
     m_recursive(recursive),
     m_unitSystem(IP),
-    m_workspaceObjectChanged(false)
+    m_workspaceObjectChanged(false),
+    m_fieldsLayout(nullptr),
+    m_extensibleToolBar(nullptr),
+    m_numNonextensibleFields(0)
 //m_workspaceObjs(std::vector<openstudio::OptionalWorkspaceObject>&())
 {
   m_layout = new QVBoxLayout(this);
@@ -259,6 +266,12 @@ void InspectorGadget::clear(bool recursive) {
     m_deleteHandle = nullptr;
   }
 
+  m_fieldsLayout = nullptr;
+  m_extensibleToolBar = nullptr;
+  m_fieldRows.clear();
+  m_fieldValues.clear();
+  m_fieldComments.clear();
+
   // This line is commented out to prevent a crash when displaying the Inspector Gadget
   // within SketchUp 2016.  We have no idea why this works or what repercussions it may cause
   //m_workspaceObj.reset();
@@ -285,43 +298,21 @@ void InspectorGadget::layoutItems(QVBoxLayout* masterLayout, QWidget* parent, bo
   hlayout->addLayout(layout);
   layoutText(layout, parent, AccessPolicy::LOCKED, iddObj.type().valueDescription().c_str(), -1, comment);
 
-  AccessPolicy::ACCESS_LEVEL level;
-  const AccessPolicy* pAccessPolicy = AccessPolicyStore::Instance().getPolicy(iddObj.type());
-  for (unsigned int i = 0, iend = m_workspaceObj->numFields(); i < iend; ++i) {
-    openstudio::IddField field(*(iddObj.getField(i)));
-    if (pAccessPolicy) {
-      level = pAccessPolicy->getAccess(i);
-    } else {
-      level = AccessPolicy::FREE;
-    }
-
-    if (m_locked && (level == AccessPolicy::FREE)) {
-      level = AccessPolicy::LOCKED;
-    }
-
-    comment = *(m_workspaceObj->fieldComment(i, true));
-    // starting at 1 because the "base" obj is at 0
-    //for(unsigned it=1; i<m_workspaceObjs.size(); i++)
-    //{
-    //  if(comment == m_workspaceObjs[it]->fieldComment(i,true)){
-    //    // keep track of a field set to the value FIELDS_MATCH,
-    //    // if it changed, change the respective elements in any
-    //    // other
-    //    comment == FIELDS_MATCH;
-    //    break;
-    //  }
-    //}
-
-    //Strip off prefix of "!"
-    if (comment.size() >= 1) {
-      string::size_type j = comment.find('!');
-      if (j != string::npos) {
-        comment.erase(0, j + 1);
-      }
-    }
-    parseItem(layout, parent, field, field.name(), *(m_workspaceObj->getString(i, true)), level, i, comment, true);
+  m_fieldsLayout = layout;
+  m_extensibleToolBar = nullptr;
+  m_objectComment = m_workspaceObj->comment();
+  m_numNonextensibleFields = m_workspaceObj->numNonextensibleFields();
+
+  unsigned numExistingFields = m_workspaceObj->numFields();
+  m_fieldRows.assign(numExistingFields, nullptr);
+  m_fieldValues.assign(numExistingFields, std::string());
+  m_fieldComments.assign(numExistingFields, std::string());
+  for (unsigned int i = 0; i < numExistingFields; ++i) {
+    layoutField(layout, parent, i);
   }
 
+  AccessPolicy::ACCESS_LEVEL level;
+  const AccessPolicy* pAccessPolicy = AccessPolicyStore::Instance().getPolicy(iddObj.type());
   const IddObjectProperties& props = m_workspaceObj->iddObject().properties();
   if (pAccessPolicy) {
     unsigned numFields = iddObj.numFields();
@@ -369,11 +360,183 @@ void InspectorGadget::layoutItems(QVBoxLayout* masterLayout, QWidget* parent, bo
         m_childMap[elem] = igChild;
       }
     }
+
+    // delete the gadgets of children that left the object, clear(false) already took them out of the layout
+    for (auto it = m_childMap.begin(); it != m_childMap.end();) {
+      if (std::find(cvec.begin(), cvec.end(), it->first) == cvec.end()) {
+        delete it->second;
+        it = m_childMap.erase(it);
+      } else {
+        ++it;
+      }
+    }
   }  // if(p)
 
   if (m_stretch) masterLayout->addStretch();
 }
 
+void InspectorGadget::layoutField(QVBoxLayout* layout, QWidget* parent, unsigned index) {
+  IddObject iddObj = m_workspaceObj->iddObject();
+  openstudio::IddField field(*(iddObj.getField(index)));
+
+  AccessPolicy::ACCESS_LEVEL level;
+  const AccessPolicy* pAccessPolicy = AccessPolicyStore::Instance().getPolicy(iddObj.type());
+  if (pAccessPolicy) {
+    level = pAccessPolicy->getAccess(index);
+  } else {
+    level = AccessPolicy::FREE;
+  }
+
+  if (m_locked && (level == AccessPolicy::FREE)) {
+    level = AccessPolicy::LOCKED;
+  }
+
+  std::string comment = *(m_workspaceObj->fieldComment(index, true));
+  // starting at 1 because the "base" obj is at 0
+  //for(unsigned it=1; i<m_workspaceObjs.size(); i++)
+  //{
+  //  if(comment == m_workspaceObjs[it]->fieldComment(i,true)){
+  //    // keep track of a field set to the value FIELDS_MATCH,
+  //    // if it changed, change the respective elements in any
+  //    // other
+  //    comment == FIELDS_MATCH;
+  //    break;
+  //  }
+  //}
+
+  //Strip off prefix of "!"
+  if (comment.size() >= 1) {
+    string::size_type j = comment.find('!');
+    if (j != string::npos) {
+      comment.erase(0, j + 1);
+    }
+  }
+
+  // parseItem adds at most one row to the layout, remember it so it can be replaced on its own later
+  int count = layout->count();
+  parseItem(layout, parent, field, field.name(), *(m_workspaceObj->getString(index, true)), level, index, comment, true);
+  if (layout->count() > count) {
+    m_fieldRows[index] = layout->itemAt(layout->count() - 1)->widget();
+  }
+
+  snapshotField(index);
+}
+
+void InspectorGadget::snapshotField(unsigned index) {
+  if (index < m_fieldValues.size()) {
+    m_fieldValues[index] = m_workspaceObj->getString(index, true).get_value_or("");
+    m_fieldComments[index] = m_workspaceObj->fieldComment(index, true).get_value_or("");
+  }
+}
+
+void InspectorGadget::removeFieldRow(unsigned index) {
+  if (QWidget* row = m_fieldRows[index]) {
+    m_fieldsLayout->removeWidget(row);
+    delete row;
+    m_fieldRows[index] = nullptr;
+  }
+}
+
+void InspectorGadget::updateChangedFields() {
+  if (!m_deleteHandle || !m_fieldsLayout) {
+    rebuild(false);
+    return;
+  }
+
+  unsigned oldNumFields = m_fieldRows.size();
+  unsigned newNumFields = m_workspaceObj->numFields();
+
+  bool needsRebuild = (m_objectComment != m_workspaceObj->comment()) || (m_numNonextensibleFields != m_workspaceObj->numNonextensibleFields());
+
+  // new extensible fields go right before the extensible tool bar, there is nowhere sensible to put them without it
+  if ((newNumFields > oldNumFields) && !m_extensibleToolBar) {
+    needsRebuild = true;
+  }
+
+  // children are laid out after the fields, rebuild if they changed
+  if (OptionalParentObject p = m_workspaceObj->optionalCast<ParentObject>()) {
+    if (!m_lastHideChildren) {
+      ModelObjectVector children = p->children();
+      if (children.size() != m_childMap.size()) {
+        needsRebuild = true;
+      } else {
+        for (const auto& child : children) {
+          if (m_childMap.find(child) == m_childMap.end()) {
+            needsRebuild = true;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  if (needsRebuild) {
+    rebuild(false);
+    return;
+  }
+
+  // replace rows of fields that still exist but changed
+  unsigned numCommonFields = std::min(oldNumFields, newNumFields);
+  for (unsigned i = 0; i < numCommonFields; ++i) {
+    if ((m_fieldValues[i] == m_workspaceObj->getString(i, true).get_value_or(""))
+        && (m_fieldComments[i] == m_workspaceObj->fieldComment(i, true).get_value_or(""))) {
+      continue;
+    }
+
+    QWidget* oldRow = m_fieldRows[i];
+    int position = oldRow ? m_fieldsLayout->indexOf(oldRow) : -1;
+
+    QVBoxLayout rowLayout;
+    layoutField(&rowLayout, m_deleteHandle, i);
+    if (QWidget* newRow = m_fieldRows[i]) {
+      rowLayout.removeWidget(newRow);
+      if (position >= 0) {
+        m_fieldsLayout->insertWidget(position, newRow);
+      } else {
+        // row was hidden before, keep the rows in field order
+        int insertAt = 1;  // after the header
+        for (unsigned j = 0; j < i; ++j) {
+          if (m_fieldRows[j]) {
+            insertAt = m_fieldsLayout->indexOf(m_fieldRows[j]) + 1;
+          }
+        }
+        m_fieldsLayout->insertWidget(insertAt, newRow);
+      }
+    }
+
+    if (oldRow) {
+      m_fieldsLayout->removeWidget(oldRow);
+      delete oldRow;
+    }
+  }
+
+  // removed extensible groups
+  for (unsigned i = newNumFields; i < oldNumFields; ++i) {
+    removeFieldRow(i);
+  }
+
+  // added extensible groups
+  if (newNumFields != oldNumFields) {
+    m_fieldRows.resize(newNumFields, nullptr);
+    m_fieldValues.resize(newNumFields);
+    m_fieldComments.resize(newNumFields);
+  }
+  for (unsigned i = oldNumFields; i < newNumFields; ++i) {
+    QVBoxLayout rowLayout;
+    layoutField(&rowLayout, m_deleteHandle, i);
+    if (QWidget* newRow = m_fieldRows[i]) {
+      rowLayout.removeWidget(newRow);
+      m_fieldsLayout->insertWidget(m_fieldsLayout->indexOf(m_extensibleToolBar), newRow);
+    }
+  }
+
+  if (m_extensibleToolBar) {
+    if (QPushButton* subBtn = m_extensibleToolBar->findChild<QPushButton*>("IGRemoveExtensible")) {
+      checkRemoveBtn(subBtn);
+    }
+  }
+}
+
 void InspectorGadget::parseItem(QVBoxLayout* layout, QWidget* parent, openstudio::IddField& field, const std::string& name, const std::string& curVal,
                                 openstudio::model::AccessPolicy::ACCESS_LEVEL level, int index, const std::string& comment, bool exists) {
   IddFieldProperties prop = field.properties();
@@ -828,6 +991,7 @@ void InspectorGadget::createExtensibleToolBar(QVBoxLayout* layout,
   frame->setObjectName("IGRow");
 
   layout->addWidget(frame);
+  m_extensibleToolBar = frame;
 
   QLabel* label = new QLabel(tr("Add/Remove Extensible Groups"), parent);
 
@@ -837,6 +1001,7 @@ void InspectorGadget::createExtensibleToolBar(QVBoxLayout* layout,
   addBtn->setStyleSheet(" margin: 0px; border: 0px;");
 
   auto subBtn = new QPushButton(frame);
+  subBtn->setObjectName("IGRemoveExtensible");
   QIcon ico2(":images/edit_remove.png");
   subBtn->setIcon(ico2);
   subBtn->setStyleSheet(" margin: 0px; border: 0px;");
@@ -937,6 +1102,9 @@ void InspectorGadget::IGvalueChanged(const QString& value) {
     return;
   }
 
+  // the widget already shows the new value, no need to recreate it on the next change
+  snapshotField(index);
+
   if (m_objectHasName && index == m_nameIndex.get()) {
     emit nameChanged(temp.c_str());
   }
@@ -953,10 +1121,12 @@ void InspectorGadget::IGcommentChanged(const QString& value) {
     disconnectWorkspaceObjectSignals();
     m_workspaceObj->setComment(temp);
     connectWorkspaceObjectSignals();
+    m_objectComment = m_workspaceObj->comment();
   } else {
     disconnectWorkspaceObjectSignals();
     m_workspaceObj->setFieldComment(index, temp);
     connectWorkspaceObjectSignals();
+    snapshotField(index);
   }
 
   emit dirty();
@@ -975,6 +1145,7 @@ void InspectorGadget::IGautosize(bool toggled) {
   disconnectWorkspaceObjectSignals();
   m_workspaceObj->setString(index, "Autosize");
   connectWorkspaceObjectSignals();
+  snapshotField(index);
 }
 
 void InspectorGadget::IGautocalculate(bool toggled) {
@@ -989,6 +1160,7 @@ void InspectorGadget::IGautocalculate(bool toggled) {
   disconnectWorkspaceObjectSignals();
   m_workspaceObj->setString(index, "Autocalculate");
   connectWorkspaceObjectSignals();
+  snapshotField(index);
 }
 
 void InspectorGadget::commentConfig(bool showComments) {
@@ -1008,7 +1180,7 @@ void InspectorGadget::addExtensible() {
   OS_ASSERT(source);
   checkRemoveBtn(source);
   emit dirty();
-  rebuild(false);
+  updateChangedFields();
 }
 
 void InspectorGadget::removeExtensible() {
@@ -1020,7 +1192,7 @@ void InspectorGadget::removeExtensible() {
   OS_ASSERT(source);
   checkRemoveBtn(source);
   emit dirty();
-  rebuild(false);
+  updateChangedFields();
 }
 
 void InspectorGadget::createAllFields() {
@@ -1069,7 +1241,7 @@ void InspectorGadget::onWorkspaceObjectChanged() {
 void InspectorGadget::onTimeout() {
   if (m_workspaceObjectChanged && m_workspaceObj && !m_workspaceObj->handle().isNull()) {
     if (m_workspaceObj) {
-      rebuild(false);
+      updateChangedFields();
     }
     m_workspaceObjectChanged = false;
   }
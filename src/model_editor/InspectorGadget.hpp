@@ -288,6 +288,23 @@ class MODELEDITOR_API InspectorGadget : public QWidget, public Nano::Observer
 
   void stripchar(std::string& strip, char c);
 
+  /*! \brief updates the rows of the fields that changed since they were laid out
+   *
+   * Rows whose value or comment changed are recreated in place and rows for added or removed extensible
+   * groups are inserted or deleted, every other widget is left untouched. Falls back to rebuild(false)
+   * when anything else about the object (comment, non-extensible fields, children) changed.
+   */
+  void updateChangedFields();
+
+  // lays out a single field row and records it in m_fieldRows at index
+  void layoutField(QVBoxLayout* layout, QWidget* parent, unsigned index);
+
+  // records the current value and comment of a field, as last displayed
+  void snapshotField(unsigned index);
+
+  // deletes the row widget of a field, if any
+  void removeFieldRow(unsigned index);
+
   QVBoxLayout* m_layout;
   QScrollArea* m_scroll;
   QWidget* m_deleteHandle;  // we need a parent for everything in IG so we can delete it all.
@@ -319,6 +336,15 @@ class MODELEDITOR_API InspectorGadget : public QWidget, public Nano::Observer
   typedef std::map<openstudio::model::ModelObject, InspectorGadget*> MODELMAP;
   MODELMAP m_childMap;
 
+  // field level change tracking, all reset by layoutItems
+  QVBoxLayout* m_fieldsLayout;        // holds the header, one row per field and the extensible tool bar
+  QWidget* m_extensibleToolBar;       // nullptr if not shown
+  std::vector<QWidget*> m_fieldRows;  // row for each existing field index, nullptr if the field is not shown
+  std::vector<std::string> m_fieldValues;
+  std::vector<std::string> m_fieldComments;
+  std::string m_objectComment;
+  unsigned m_numNonextensibleFields;
+
   void connectWorkspaceObjectSignals() const;
 
   void disconnectWorkspaceObjectSignals() const;
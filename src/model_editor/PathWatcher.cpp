@@ -35,6 +35,7 @@
 #include <openstudio/utilities/core/Checksum.hpp>
 #include <openstudio/utilities/core/Assert.hpp>
 
+#include <QFileInfo>
 #include <QFileSystemWatcher>
 #include <QTimer>
 
@@ -45,31 +46,50 @@ PathWatcher::PathWatcher(const openstudio::path& p, int msec)
     m_isDirectory(openstudio::filesystem::is_directory(p) || openstudio::toString(p.filename()) == "." || openstudio::toString(p.filename()) == "/"),
     m_exists(openstudio::filesystem::exists(p)),
     m_dirty(false),
-    m_checksum(openstudio::checksum(p)),
+    m_fileModified(false),
+    m_size(-1),
+    m_checksumCount(0),
     m_path(p),
     m_msec(msec) {
   // make sure a QApplication exists
   openstudio::Application::instance().application(false);
   openstudio::Application::instance().processEvents();
 
+  connect(m_impl.get(), &QFileSystemWatcher::directoryChanged, this, &PathWatcher::directoryChanged);
+
   if (m_isDirectory) {
 
     if (!m_exists) {
       LOG_FREE_AND_THROW("openstudio.PathWatcher", "Directory '" << openstudio::toString(p) << "' does not exist, cannot be watched");
     }
 
-    connect(m_impl.get(), &QFileSystemWatcher::directoryChanged, this, &PathWatcher::directoryChanged);
     m_impl->addPath(openstudio::toQString(p));
 
   } else {
+    // events often come in bursts while a file is written, only check once they settle
     m_timer = std::shared_ptr<QTimer>(new QTimer());
+    m_timer->setSingleShot(true);
+    m_timer->setInterval(m_msec);
     connect(m_timer.get(), &QTimer::timeout, this, &PathWatcher::checkFile);
-    m_timer->start(m_msec);
 
-    // DLM: do not use QFileSystemWatcher to watch individual files, was acting glitchy
-    //connected = this->connect(m_impl.get(), SIGNAL(fileChanged(const QString&)), SLOT(fileChanged(const QString&)));
-    //OS_ASSERT(connected);
-    //m_impl->addPath(openstudio::toQString(p));
+    connect(m_impl.get(), &QFileSystemWatcher::fileChanged, this, &PathWatcher::fileChanged);
+
+    // the parent directory reports creation, removal and replacement of the file, which the file watch alone misses
+    openstudio::path parentPath = m_path.parent_path();
+    if (parentPath.empty()) {
+      parentPath = openstudio::toPath(".");
+    }
+    if (openstudio::filesystem::is_directory(parentPath)) {
+      m_impl->addPath(openstudio::toQString(parentPath));
+    }
+
+    watchFile();
+
+    QFileInfo info(openstudio::toQString(m_path));
+    m_exists = info.exists() && (info.size() > 0);
+    m_size = info.size();
+    m_lastModified = info.lastModified();
+    m_checksum = computeChecksum();
   }
 }
 
@@ -82,13 +102,12 @@ bool PathWatcher::enabled() const {
 void PathWatcher::enable() {
   m_enabled = true;
 
-  if (!m_timer->isActive()) {
-    m_timer->start(m_msec);
-  }
+  // catch up with anything that happened while disabled
+  scheduleCheckFile();
 }
 
 bool PathWatcher::disable() {
-  if (m_timer->isActive()) {
+  if (m_timer && m_timer->isActive()) {
     m_timer->stop();
   }
 
@@ -108,7 +127,15 @@ bool PathWatcher::dirty() const {
 void PathWatcher::clearState() {
   m_exists = openstudio::filesystem::exists(m_path);
   m_dirty = false;
-  m_checksum = openstudio::checksum(m_path);
+
+  if (!m_isDirectory) {
+    QFileInfo info(openstudio::toQString(m_path));
+    m_exists = info.exists() && (info.size() > 0);
+    m_size = info.size();
+    m_lastModified = info.lastModified();
+    m_fileModified = false;
+    m_checksum = computeChecksum();
+  }
 }
 
 void PathWatcher::onPathAdded() {}
@@ -117,7 +144,36 @@ void PathWatcher::onPathChanged() {}
 
 void PathWatcher::onPathRemoved() {}
 
+unsigned PathWatcher::checksumCount() const {
+  return m_checksumCount;
+}
+
+void PathWatcher::watchFile() {
+  QString filePath = openstudio::toQString(m_path);
+  if (QFileInfo::exists(filePath) && !m_impl->files().contains(filePath)) {
+    m_impl->addPath(filePath);
+  }
+}
+
+void PathWatcher::scheduleCheckFile() {
+  if (m_timer && m_enabled) {
+    // restarting the timer coalesces all events received within m_msec into a single check
+    m_timer->start();
+  }
+}
+
+std::string PathWatcher::computeChecksum() {
+  ++m_checksumCount;
+  return openstudio::checksum(m_path);
+}
+
 void PathWatcher::directoryChanged(const QString& path) {
+  if (!m_isDirectory) {
+    // something changed in the parent directory of the watched file, which may or may not be the file
+    scheduleCheckFile();
+    return;
+  }
+
   bool exists = openstudio::filesystem::exists(m_path);
 
   if (m_exists && exists) {
@@ -155,27 +211,40 @@ void PathWatcher::directoryChanged(const QString& path) {
 }
 
 void PathWatcher::fileChanged(const QString& path) {
-  checkFile();
+  // the file itself was written, its size and time stamp may still look the same
+  m_fileModified = true;
+  scheduleCheckFile();
 }
 
 void PathWatcher::checkFile() {
-  bool exists = openstudio::filesystem::exists(m_path);
-  std::string checksum = openstudio::checksum(m_path);
+  // the file may have been removed or replaced since it was last watched
+  watchFile();
 
-  if (checksum == "00000000") {
-    exists = false;
-  }
+  QFileInfo info(openstudio::toQString(m_path));
+
+  // empty files are treated as missing, they are usually in the middle of being written
+  bool exists = info.exists() && (info.size() > 0);
+
+  // cheap prefilter, only compute the checksum if the file may actually have changed
+  bool possiblyChanged = m_fileModified || (info.size() != m_size) || (info.lastModified() != m_lastModified);
+  m_fileModified = false;
+  m_size = info.size();
+  m_lastModified = info.lastModified();
 
   if (m_exists && exists) {
 
-    // first check checksum
-    if (checksum != m_checksum) {
-      m_dirty = true;
-      m_checksum = checksum;
+    if (possiblyChanged) {
+      std::string checksum = computeChecksum();
+
+      // then check checksum
+      if (checksum != m_checksum) {
+        m_dirty = true;
+        m_checksum = checksum;
 
-      // regular change
-      if (m_enabled) {
-        onPathChanged();
+        // regular change
+        if (m_enabled) {
+          onPathChanged();
+        }
       }
     }
 
@@ -184,7 +253,7 @@ void PathWatcher::checkFile() {
     // used to exist, now does not
     m_dirty = true;
     m_exists = exists;
-    m_checksum = openstudio::checksum(m_path);
+    m_checksum = "00000000";
 
     if (m_enabled) {
       onPathRemoved();
@@ -195,7 +264,7 @@ void PathWatcher::checkFile() {
     // did not exist, now does
     m_dirty = true;
     m_exists = exists;
-    m_checksum = openstudio::checksum(m_path);
+    m_checksum = computeChecksum();
 
     if (m_enabled) {
       onPathAdded();
@@ -34,6 +34,7 @@
 
 #include <openstudio/utilities/core/Path.hpp>
 
+#include <QDateTime>
 #include <QObject>
 #include <QString>
 
@@ -52,10 +53,10 @@ class MODELEDITOR_API PathWatcher : public QObject
  public:
   /// constructor with path
 
-  /// if path is a directory it must exist at time of construction, no periodic checks are performed for directory
+  /// if path is a directory it must exist at time of construction
   /// if path is not a directory it is assumed to be a regular file which may or may not exist at construction,
-  /// a timer is used to periodically check for changes to the file
-  /// msec is the timer delay to check for updates to the file, msec does not apply if the path is a directory
+  /// the file and its parent directory are watched for file system events, no periodic checks are performed
+  /// msec is the delay used to coalesce bursts of events on the file before checking it, msec does not apply if the path is a directory
   PathWatcher(const openstudio::path& p, int msec = 1000);
 
   /// virtual destructor
@@ -98,10 +99,23 @@ class MODELEDITOR_API PathWatcher : public QObject
   /// called when file is modified or removed
   void fileChanged(const QString& path);
 
-  /// periodically check for changes
+  /// check the file for changes, the checksum is only computed if size or modification time changed
+  /// or if the file itself was reported as modified
   void checkFile();
 
+ protected:
+  /// number of checksums computed since construction, for files
+  unsigned checksumCount() const;
+
  private:
+  /// watch the file again, QFileSystemWatcher drops files that are removed or replaced
+  void watchFile();
+
+  /// restart the coalescing timer, checkFile is called once it expires
+  void scheduleCheckFile();
+
+  std::string computeChecksum();
+
   /// impl
   std::shared_ptr<QFileSystemWatcher> m_impl;
   std::shared_ptr<QTimer> m_timer;
@@ -110,7 +124,11 @@ class MODELEDITOR_API PathWatcher : public QObject
   bool m_isDirectory;
   bool m_exists;
   bool m_dirty;
+  bool m_fileModified;
   std::string m_checksum;
+  qint64 m_size;
+  QDateTime m_lastModified;
+  unsigned m_checksumCount;
   openstudio::path m_path;
   int m_msec;
 };
@@ -0,0 +1,159 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ModelEditorFixture.hpp"
+
+#include "../Application.hpp"
+#include "../IGLineEdit.hpp"
+#include "../InspectorGadget.hpp"
+
+#include <openstudio/model/Lights.hpp>
+#include <openstudio/model/LightsDefinition.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleCompact.hpp>
+#include <openstudio/model/ScheduleCompact_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+
+#include <QApplication>
+#include <QPointer>
+
+#include <set>
+
+using namespace openstudio::model;
+using namespace openstudio;
+
+static std::set<IGLineEdit*> lineEdits(const InspectorGadget& gadget) {
+  QList<IGLineEdit*> list = gadget.findChildren<IGLineEdit*>();
+  return std::set<IGLineEdit*>(list.begin(), list.end());
+}
+
+TEST_F(ModelEditorFixture, InspectorGadget_InPlaceFieldUpdate) {
+  Model model;
+  ScheduleCompact schedule(model);
+  for (unsigned i = 0; i < 300; ++i) {
+    schedule.pushExtensibleGroup(std::vector<std::string>(1, "Until: 24:00"));
+  }
+
+  InspectorGadget gadget;
+  WorkspaceObject workspaceObject = schedule;
+  gadget.layoutModelObj(workspaceObject);
+
+  std::set<IGLineEdit*> before = lineEdits(gadget);
+  ASSERT_LT(300u, before.size());
+
+  // changing one field only recreates the widgets of that field
+  unsigned index = schedule.numNonextensibleFields() + 10;
+  EXPECT_TRUE(schedule.setString(index, "Through: 12/31"));
+  Application::instance().application(true)->processEvents();
+
+  std::set<IGLineEdit*> after = lineEdits(gadget);
+  ASSERT_EQ(before.size(), after.size());
+
+  unsigned numRecreated = 0;
+  for (IGLineEdit* lineEdit : after) {
+    if (before.find(lineEdit) == before.end()) {
+      ++numRecreated;
+      EXPECT_EQ(QString("Through: 12/31"), lineEdit->text());
+    }
+  }
+  EXPECT_EQ(1u, numRecreated);
+
+  // adding an extensible group only creates the widgets of the new group
+  before = after;
+  schedule.pushExtensibleGroup(std::vector<std::string>(1, "Until: 12:00"));
+  Application::instance().application(true)->processEvents();
+
+  after = lineEdits(gadget);
+  ASSERT_EQ(before.size() + 1, after.size());
+  for (IGLineEdit* lineEdit : before) {
+    EXPECT_TRUE(after.find(lineEdit) != after.end());
+  }
+
+  // removing it deletes only those widgets
+  before = after;
+  schedule.popExtensibleGroup();
+  Application::instance().application(true)->processEvents();
+
+  after = lineEdits(gadget);
+  ASSERT_EQ(before.size() - 1, after.size());
+  for (IGLineEdit* lineEdit : after) {
+    EXPECT_TRUE(before.find(lineEdit) != before.end());
+  }
+}
+
+TEST_F(ModelEditorFixture, InspectorGadget_RemovedChild) {
+  Model model;
+  Space space(model);
+  LightsDefinition definition(model);
+  Lights lights1(definition);
+  Lights lights2(definition);
+  EXPECT_TRUE(lights1.setSpace(space));
+  EXPECT_TRUE(lights2.setSpace(space));
+
+  InspectorGadget gadget;
+  WorkspaceObject workspaceObject = space;
+  gadget.layoutModelObj(workspaceObject);
+
+  QList<QPointer<InspectorGadget>> childGadgets;
+  for (InspectorGadget* child : gadget.findChildren<InspectorGadget*>()) {
+    childGadgets.append(child);
+  }
+  ASSERT_EQ(2, childGadgets.size());
+
+  // the next change of the space lays out its children again, which deletes the gadget of the removed child
+  lights2.remove();
+  EXPECT_TRUE(space.setName("Space 1"));
+  Application::instance().application(true)->processEvents();
+
+  int numDeleted = 0;
+  for (const auto& child : childGadgets) {
+    if (child.isNull()) {
+      ++numDeleted;
+    }
+  }
+  EXPECT_EQ(1, numDeleted);
+  EXPECT_EQ(1, gadget.findChildren<InspectorGadget*>().size());
+
+  // after that changes are applied in place again instead of rebuilding
+  std::set<IGLineEdit*> before = lineEdits(gadget);
+  EXPECT_TRUE(space.setName("Space 2"));
+  Application::instance().application(true)->processEvents();
+
+  std::set<IGLineEdit*> after = lineEdits(gadget);
+  ASSERT_EQ(before.size(), after.size());
+  unsigned numRecreated = 0;
+  for (IGLineEdit* lineEdit : after) {
+    if (before.find(lineEdit) == before.end()) {
+      ++numRecreated;
+    }
+  }
+  EXPECT_EQ(1u, numRecreated);
+}
@@ -50,14 +50,19 @@ using std::ios_base;
 struct TestPathWatcher : public PathWatcher
 {
 
-  // set periodic timer to 1 ms
-  TestPathWatcher(const openstudio::path& path) : PathWatcher(path, 1), added(false), changed(false), removed(false) {}
+  // set coalescing timer to 1 ms
+  TestPathWatcher(const openstudio::path& path) : PathWatcher(path, 1), added(false), changed(false), removed(false), numChanged(0) {}
 
   virtual void onPathAdded() override {
     added = true;
   }
   virtual void onPathChanged() override {
     changed = true;
+    ++numChanged;
+  }
+
+  unsigned numChecksums() const {
+    return checksumCount();
   }
   virtual void onPathRemoved() override {
     removed = true;
@@ -66,6 +71,7 @@ struct TestPathWatcher : public PathWatcher
   bool added;
   bool changed;
   bool removed;
+  unsigned numChanged;
 };
 
 // writes seem to have to occur in another thread for watcher to detect them
@@ -176,3 +182,44 @@ TEST_F(ModelEditorFixture, PathWatcher_Dir) {
 
   EXPECT_TRUE(watcher.changed);
 }
+
+TEST_F(ModelEditorFixture, PathWatcher_File_NoPolling) {
+  Application::instance().application(false);
+
+  openstudio::path path = toPath("./PathWatcher_File_NoPolling");
+  auto w1 = std::thread(write_file, path, "test 1");
+  w1.join();
+
+  ASSERT_TRUE(openstudio::filesystem::exists(path));
+
+  TestPathWatcher watcher(path);
+  unsigned numChecksums = watcher.numChecksums();
+
+  // idle watcher does not hash the file
+  openstudio::System::msleep(500);
+  Application::instance().processEvents(10);
+  EXPECT_EQ(numChecksums, watcher.numChecksums());
+  EXPECT_EQ(0u, watcher.numChanged);
+
+  auto w2 = std::thread(write_file, path, "test 2 is longer");
+  w2.join();
+
+  openstudio::System::msleep(1000);
+  Application::instance().processEvents(10);
+  Application::instance().processEvents(10);
+
+  // one notification for one write
+  EXPECT_EQ(1u, watcher.numChanged);
+  EXPECT_FALSE(watcher.added);
+  EXPECT_FALSE(watcher.removed);
+
+  // and nothing more while idle again
+  numChecksums = watcher.numChecksums();
+  openstudio::System::msleep(500);
+  Application::instance().processEvents(10);
+  EXPECT_EQ(numChecksums, watcher.numChecksums());
+  EXPECT_EQ(1u, watcher.numChanged);
+
+  auto r1 = std::thread(remove_file, path);
+  r1.join();
+}
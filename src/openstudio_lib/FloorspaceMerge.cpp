@@ -0,0 +1,620 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "FloorspaceMerge.hpp"
+
+#include <openstudio/model/Building.hpp>
+#include <openstudio/model/Building_Impl.hpp>
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/BuildingStory_Impl.hpp>
+#include <openstudio/model/BuildingUnit.hpp>
+#include <openstudio/model/BuildingUnit_Impl.hpp>
+#include <openstudio/model/DefaultConstructionSet.hpp>
+#include <openstudio/model/DefaultConstructionSet_Impl.hpp>
+#include <openstudio/model/Facility.hpp>
+#include <openstudio/model/Facility_Impl.hpp>
+#include <openstudio/model/RenderingColor.hpp>
+#include <openstudio/model/RenderingColor_Impl.hpp>
+#include <openstudio/model/ShadingSurface.hpp>
+#include <openstudio/model/ShadingSurface_Impl.hpp>
+#include <openstudio/model/Site.hpp>
+#include <openstudio/model/Site_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/SpaceType_Impl.hpp>
+#include <openstudio/model/SubSurface.hpp>
+#include <openstudio/model/SubSurface_Impl.hpp>
+#include <openstudio/model/Surface.hpp>
+#include <openstudio/model/Surface_Impl.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/model/ThermalZone_Impl.hpp>
+#include <openstudio/model/ThreeJSReverseTranslator.hpp>
+
+#include <openstudio/utilities/core/Compare.hpp>
+#include <openstudio/utilities/geometry/Point3d.hpp>
+#include <openstudio/utilities/geometry/ThreeJS.hpp>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <cmath>
+#include <set>
+
+namespace openstudio {
+
+namespace {
+
+const double vertexTolerance = 0.001;
+
+bool pointsEqual(const Point3d& a, const Point3d& b) {
+  return (std::abs(a.x() - b.x()) < vertexTolerance) && (std::abs(a.y() - b.y()) < vertexTolerance) && (std::abs(a.z() - b.z()) < vertexTolerance);
+}
+
+// same vertices in the same winding, starting vertex may differ
+bool verticesEqual(const std::vector<Point3d>& a, const std::vector<Point3d>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  if (a.empty()) {
+    return true;
+  }
+  const size_t n = a.size();
+  for (size_t offset = 0; offset < n; ++offset) {
+    bool equal = true;
+    for (size_t i = 0; i < n; ++i) {
+      if (!pointsEqual(a[i], b[(i + offset) % n])) {
+        equal = false;
+        break;
+      }
+    }
+    if (equal) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool subSurfacesEqual(const model::Surface& current, const model::Surface& exported) {
+  std::vector<model::SubSurface> currentSubSurfaces = current.subSurfaces();
+  std::vector<model::SubSurface> exportSubSurfaces = exported.subSurfaces();
+  if (currentSubSurfaces.size() != exportSubSurfaces.size()) {
+    return false;
+  }
+  std::vector<bool> used(currentSubSurfaces.size(), false);
+  for (const auto& exportSubSurface : exportSubSurfaces) {
+    bool found = false;
+    for (size_t i = 0; i < currentSubSurfaces.size(); ++i) {
+      if (!used[i] && istringEqual(currentSubSurfaces[i].subSurfaceType(), exportSubSurface.subSurfaceType())
+          && verticesEqual(currentSubSurfaces[i].vertices(), exportSubSurface.vertices())) {
+        used[i] = true;
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool surfacesEqual(const model::Surface& current, const model::Surface& exported) {
+  return istringEqual(current.surfaceType(), exported.surfaceType()) && verticesEqual(current.vertices(), exported.vertices())
+         && subSurfacesEqual(current, exported);
+}
+
+// handle of the current object mapped to exportObject, null if there is none
+template <typename T>
+Handle currentHandle(const boost::optional<T>& exportObject, const std::map<UUID, UUID>& exportToCurrent) {
+  if (!exportObject) {
+    return Handle();
+  }
+  auto it = exportToCurrent.find(exportObject->handle());
+  if (it == exportToCurrent.end()) {
+    return Handle();
+  }
+  return it->second;
+}
+
+template <typename T>
+Handle handleOf(const boost::optional<T>& object) {
+  return object ? object->handle() : Handle();
+}
+
+bool sameValue(const boost::optional<double>& current, const boost::optional<double>& exported) {
+  if (!current || !exported) {
+    return !current && !exported;
+  }
+  return std::abs(*current - *exported) < vertexTolerance;
+}
+
+// floorspace only keeps the color, not the alpha
+bool sameRenderingColor(const boost::optional<model::RenderingColor>& current, const boost::optional<model::RenderingColor>& exported) {
+  if (!current || !exported) {
+    return !current && !exported;
+  }
+  return (current->renderingRedValue() == exported->renderingRedValue()) && (current->renderingGreenValue() == exported->renderingGreenValue())
+         && (current->renderingBlueValue() == exported->renderingBlueValue());
+}
+
+// Attributes the ModelMerger copies from the export object to the current object, besides the name
+template <typename T>
+bool sameAttributes(const T& current, const T& exported, const std::map<UUID, UUID>& exportToCurrent) {
+  return true;
+}
+
+bool sameAttributes(const model::BuildingStory& current, const model::BuildingStory& exported, const std::map<UUID, UUID>& exportToCurrent) {
+  return sameValue(current.nominalZCoordinate(), exported.nominalZCoordinate())
+         && sameValue(current.nominalFloortoFloorHeight(), exported.nominalFloortoFloorHeight())
+         && sameValue(current.nominalFloortoCeilingHeight(), exported.nominalFloortoCeilingHeight())
+         && sameRenderingColor(current.renderingColor(), exported.renderingColor())
+         && (handleOf(current.defaultConstructionSet()) == currentHandle(exported.defaultConstructionSet(), exportToCurrent));
+}
+
+bool sameAttributes(const model::ThermalZone& current, const model::ThermalZone& exported, const std::map<UUID, UUID>& exportToCurrent) {
+  return sameRenderingColor(current.renderingColor(), exported.renderingColor());
+}
+
+bool sameAttributes(const model::SpaceType& current, const model::SpaceType& exported, const std::map<UUID, UUID>& exportToCurrent) {
+  return sameRenderingColor(current.renderingColor(), exported.renderingColor())
+         && (handleOf(current.defaultConstructionSet()) == currentHandle(exported.defaultConstructionSet(), exportToCurrent));
+}
+
+bool sameAttributes(const model::BuildingUnit& current, const model::BuildingUnit& exported, const std::map<UUID, UUID>& exportToCurrent) {
+  return (current.buildingUnitType() == exported.buildingUnitType()) && sameRenderingColor(current.renderingColor(), exported.renderingColor());
+}
+
+bool sameAttributes(const model::Space& current, const model::Space& exported, const std::map<UUID, UUID>& exportToCurrent) {
+  return handleOf(current.defaultConstructionSet()) == currentHandle(exported.defaultConstructionSet(), exportToCurrent);
+}
+
+// every export object of type T is mapped to a current object with the same name and attributes, and vice versa
+template <typename T>
+bool sameObjects(const model::Model& currentModel, const model::Model& exportModel, const std::map<UUID, UUID>& exportToCurrent) {
+  std::vector<T> currentObjects = currentModel.getConcreteModelObjects<T>();
+  std::vector<T> exportObjects = exportModel.getConcreteModelObjects<T>();
+  if (currentObjects.size() != exportObjects.size()) {
+    return false;
+  }
+  for (const auto& exportObject : exportObjects) {
+    auto it = exportToCurrent.find(exportObject.handle());
+    if (it == exportToCurrent.end()) {
+      return false;
+    }
+    boost::optional<T> currentObject = currentModel.getModelObject<T>(it->second);
+    if (!currentObject || (currentObject->nameString() != exportObject.nameString())
+        || !sameAttributes(*currentObject, exportObject, exportToCurrent)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool sameShading(const model::Model& currentModel, const model::Model& exportModel) {
+  std::vector<model::ShadingSurface> currentSurfaces = currentModel.getConcreteModelObjects<model::ShadingSurface>();
+  std::vector<model::ShadingSurface> exportSurfaces = exportModel.getConcreteModelObjects<model::ShadingSurface>();
+  if (currentSurfaces.size() != exportSurfaces.size()) {
+    return false;
+  }
+  std::vector<bool> used(currentSurfaces.size(), false);
+  for (const auto& exportSurface : exportSurfaces) {
+    bool found = false;
+    for (size_t i = 0; i < currentSurfaces.size(); ++i) {
+      if (!used[i] && verticesEqual(currentSurfaces[i].vertices(), exportSurface.vertices())) {
+        used[i] = true;
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+FloorspaceChangeSet::FloorspaceChangeSet() : m_isIncremental(false) {}
+
+FloorspaceTranslation FloorspaceChangeSet::translate(const FloorplanJS& floorplan, const model::Model& currentModel, const std::string& buildingName,
+                                                     const std::string& siteName, const boost::optional<Handle>& defaultConstructionSetHandle) {
+  FloorspaceTranslation result;
+
+  model::ThreeJSReverseTranslator rt;
+  ThreeScene scene = floorplan.toThreeScene(true);
+  boost::optional<model::Model> model = rt.modelFromThreeJS(scene);
+
+  result.errors = rt.errors();
+  result.warnings = rt.warnings();
+
+  if (!model) {
+    return result;
+  }
+
+  // set north axis, floorspace js northAxis is opposite of EnergyPlus's
+  model::Building building = model->getUniqueModelObject<model::Building>();
+  building.setName(buildingName);
+  building.setNorthAxis(-floorplan.northAxis());
+
+  // synchronize latitude and longitude, floorspace does not set elevation when locating on map
+  model::Site site = model->getUniqueModelObject<model::Site>();
+  site.setName(siteName);
+  double latitude = floorplan.latitude();
+  double longitude = floorplan.longitude();
+  if ((latitude != 0) && (longitude != 0)) {
+    site.setLatitude(latitude);
+    site.setLongitude(longitude);
+  }
+
+  model::Model exportModel = *model;
+  std::map<UUID, UUID> exportModelHandleMapping = rt.handleMapping();
+
+  // User cannot edit thermal zone for plenums in floorspace, a new thermal zone will always be created for each plenum
+  // if the associated space has a thermal zone in FloorplanJS::toThreeScene.  This was probably a bad decision, since
+  // the user cannot see or edit this zone we should not create it.  Created floorspace.js/issues/388 to better attach
+  // information related to plenum zones
+
+  // the exported plenum space is not matched to an existing space, so existing space will be replaced by exported space
+  // we can throw away the new plenum zone, it will not be mapped to anything
+  bool removedPlenumZones = false;
+  for (const auto& exportSpace : exportModel.getConcreteModelObjects<model::Space>()) {
+    if (boost::algorithm::ends_with(exportSpace.nameString(), "Plenum")) {
+      boost::optional<model::ThermalZone> exportThermalZone = exportSpace.thermalZone();
+      if (exportThermalZone && (exportThermalZone->spaces().size() == 1u)) {
+        exportThermalZone->remove();
+        removedPlenumZones = true;
+      }
+    }
+  }
+
+  if (removedPlenumZones) {
+    // attempt to match thermal zones for existing plenums with new plenums
+    for (const auto& space : currentModel.getConcreteModelObjects<model::Space>()) {
+      boost::optional<model::Space> abovePlenumSpace;
+      boost::optional<model::Space> belowPlenumSpace;
+      for (const auto& surface : space.surfaces()) {
+        if (istringEqual(surface.surfaceType(), "RoofCeiling")) {
+          auto adjacentSurface = surface.adjacentSurface();
+          if (adjacentSurface) {
+            abovePlenumSpace = adjacentSurface->space();
+            if (abovePlenumSpace && !abovePlenumSpace->isPlenum() && !boost::algorithm::icontains(abovePlenumSpace->nameString(), "Plenum")) {
+              abovePlenumSpace.reset();
+            }
+          }
+        } else if (istringEqual(surface.surfaceType(), "Floor")) {
+          auto adjacentSurface = surface.adjacentSurface();
+          if (adjacentSurface) {
+            belowPlenumSpace = adjacentSurface->space();
+            if (belowPlenumSpace && !belowPlenumSpace->isPlenum() && !boost::algorithm::icontains(belowPlenumSpace->nameString(), "Plenum")) {
+              belowPlenumSpace.reset();
+            }
+          }
+        }
+      }
+
+      boost::optional<model::Space> exportSpace;
+      boost::optional<model::Space> exportAbovePlenumSpace;
+      boost::optional<model::Space> exportBelowPlenumSpace;
+      auto exportSpaceHandle = exportModelHandleMapping.find(space.handle());
+      if (exportSpaceHandle != exportModelHandleMapping.end()) {
+        exportSpace = exportModel.getModelObject<model::Space>(exportSpaceHandle->second);
+        if (exportSpace) {
+          for (const auto& surface : exportSpace->surfaces()) {
+            if (istringEqual(surface.surfaceType(), "RoofCeiling")) {
+              auto adjacentSurface = surface.adjacentSurface();
+              if (adjacentSurface) {
+                exportAbovePlenumSpace = adjacentSurface->space();
+                if (exportAbovePlenumSpace && !boost::algorithm::ends_with(exportAbovePlenumSpace->nameString(), "Plenum")) {
+                  exportAbovePlenumSpace.reset();
+                }
+              }
+            } else if (istringEqual(surface.surfaceType(), "Floor")) {
+              auto adjacentSurface = surface.adjacentSurface();
+              if (adjacentSurface) {
+                exportBelowPlenumSpace = adjacentSurface->space();
+                if (exportBelowPlenumSpace && !boost::algorithm::ends_with(exportBelowPlenumSpace->nameString(), "Plenum")) {
+                  exportBelowPlenumSpace.reset();
+                }
+              }
+            }
+          }
+        }
+      }
+
+      if (abovePlenumSpace && exportAbovePlenumSpace) {
+        boost::optional<model::ThermalZone> thermalZone = abovePlenumSpace->thermalZone();
+        if (thermalZone) {
+          auto exportThermalZoneHandle = exportModelHandleMapping.find(thermalZone->handle());
+          if (exportThermalZoneHandle != exportModelHandleMapping.end()) {
+            boost::optional<model::ThermalZone> exportThermalZone = exportModel.getModelObject<model::ThermalZone>(exportThermalZoneHandle->second);
+            if (exportThermalZone) {
+              exportAbovePlenumSpace->setThermalZone(*exportThermalZone);
+            }
+          }
+        }
+      }
+
+      if (belowPlenumSpace && exportBelowPlenumSpace) {
+        boost::optional<model::ThermalZone> thermalZone = belowPlenumSpace->thermalZone();
+        if (thermalZone) {
+          auto exportThermalZoneHandle = exportModelHandleMapping.find(thermalZone->handle());
+          if (exportThermalZoneHandle != exportModelHandleMapping.end()) {
+            boost::optional<model::ThermalZone> exportThermalZone = exportModel.getModelObject<model::ThermalZone>(exportThermalZoneHandle->second);
+            if (exportThermalZone) {
+              exportBelowPlenumSpace->setThermalZone(*exportThermalZone);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // manually add mappings between current model and new model for Site, Facility, and Building objects
+  exportModelHandleMapping[currentModel.getUniqueModelObject<model::Site>().handle()] = exportModel.getUniqueModelObject<model::Site>().handle();
+  exportModelHandleMapping[currentModel.getUniqueModelObject<model::Facility>().handle()] =
+    exportModel.getUniqueModelObject<model::Facility>().handle();
+  exportModelHandleMapping[currentModel.getUniqueModelObject<model::Building>().handle()] =
+    exportModel.getUniqueModelObject<model::Building>().handle();
+
+  // restore properties on unique objects
+  if (defaultConstructionSetHandle) {
+    auto it = exportModelHandleMapping.find(*defaultConstructionSetHandle);
+    if (it != exportModelHandleMapping.end()) {
+      boost::optional<model::DefaultConstructionSet> exportDefaultConstructionSet =
+        exportModel.getModelObject<model::DefaultConstructionSet>(it->second);
+      if (exportDefaultConstructionSet) {
+        building.setDefaultConstructionSet(*exportDefaultConstructionSet);
+      }
+    }
+  }
+
+  result.exportModel = exportModel;
+  result.handleMapping = exportModelHandleMapping;
+  return result;
+}
+
+FloorspaceChangeSet FloorspaceChangeSet::compute(const model::Model& currentModel, const model::Model& exportModel,
+                                                 const std::map<UUID, UUID>& handleMapping) {
+  FloorspaceChangeSet result;
+
+  std::map<UUID, UUID> exportToCurrent;
+  for (const auto& p : handleMapping) {
+    exportToCurrent[p.second] = p.first;
+  }
+
+  // anything the merger would do besides replacing surfaces needs the full merge
+  model::Building currentBuilding = currentModel.getUniqueModelObject<model::Building>();
+  model::Building exportBuilding = exportModel.getUniqueModelObject<model::Building>();
+  if ((currentBuilding.nameString() != exportBuilding.nameString()) || (currentBuilding.northAxis() != exportBuilding.northAxis())
+      || (handleOf(currentBuilding.defaultConstructionSet()) != currentHandle(exportBuilding.defaultConstructionSet(), exportToCurrent))) {
+    return result;
+  }
+  model::Site currentSite = currentModel.getUniqueModelObject<model::Site>();
+  model::Site exportSite = exportModel.getUniqueModelObject<model::Site>();
+  if ((currentSite.nameString() != exportSite.nameString()) || (currentSite.latitude() != exportSite.latitude())
+      || (currentSite.longitude() != exportSite.longitude())) {
+    return result;
+  }
+  if (!sameObjects<model::Space>(currentModel, exportModel, exportToCurrent) || !sameObjects<model::BuildingStory>(currentModel, exportModel, exportToCurrent)
+      || !sameObjects<model::ThermalZone>(currentModel, exportModel, exportToCurrent)
+      || !sameObjects<model::SpaceType>(currentModel, exportModel, exportToCurrent)
+      || !sameObjects<model::BuildingUnit>(currentModel, exportModel, exportToCurrent) || !sameShading(currentModel, exportModel)) {
+    return result;
+  }
+
+  for (const auto& exportSpace : exportModel.getConcreteModelObjects<model::Space>()) {
+    model::Space currentSpace = currentModel.getModelObject<model::Space>(exportToCurrent[exportSpace.handle()]).get();
+
+    if ((currentSpace.xOrigin() != exportSpace.xOrigin()) || (currentSpace.yOrigin() != exportSpace.yOrigin())
+        || (currentSpace.zOrigin() != exportSpace.zOrigin()) || (currentSpace.directionofRelativeNorth() != exportSpace.directionofRelativeNorth())
+        || (handleOf(currentSpace.buildingStory()) != currentHandle(exportSpace.buildingStory(), exportToCurrent))
+        || (handleOf(currentSpace.thermalZone()) != currentHandle(exportSpace.thermalZone(), exportToCurrent))
+        || (handleOf(currentSpace.spaceType()) != currentHandle(exportSpace.spaceType(), exportToCurrent))
+        || (handleOf(currentSpace.buildingUnit()) != currentHandle(exportSpace.buildingUnit(), exportToCurrent))) {
+      return result;
+    }
+
+    FloorspaceSpaceChanges changes;
+    changes.currentSpace = currentSpace.handle();
+    changes.exportSpace = exportSpace.handle();
+
+    std::vector<model::Surface> currentSurfaces = currentSpace.surfaces();
+    std::vector<bool> used(currentSurfaces.size(), false);
+    std::vector<model::Surface> unmatchedExportSurfaces;
+    for (const auto& exportSurface : exportSpace.surfaces()) {
+      bool found = false;
+      for (size_t i = 0; i < currentSurfaces.size(); ++i) {
+        if (!used[i] && surfacesEqual(currentSurfaces[i], exportSurface)) {
+          used[i] = true;
+          found = true;
+          result.m_matchedSurfaces[exportSurface.handle()] = currentSurfaces[i].handle();
+          break;
+        }
+      }
+      if (!found) {
+        unmatchedExportSurfaces.push_back(exportSurface);
+      }
+    }
+
+    // surfaces keep their name and type while the user drags vertices around
+    for (const auto& exportSurface : unmatchedExportSurfaces) {
+      bool found = false;
+      for (size_t i = 0; i < currentSurfaces.size(); ++i) {
+        if (!used[i] && (currentSurfaces[i].nameString() == exportSurface.nameString())
+            && istringEqual(currentSurfaces[i].surfaceType(), exportSurface.surfaceType())) {
+          used[i] = true;
+          found = true;
+          changes.modifiedSurfaces.push_back(std::make_pair(currentSurfaces[i].handle(), exportSurface.handle()));
+          break;
+        }
+      }
+      if (!found) {
+        changes.addedSurfaces.push_back(exportSurface.handle());
+      }
+    }
+
+    for (size_t i = 0; i < currentSurfaces.size(); ++i) {
+      if (!used[i]) {
+        changes.removedSurfaces.push_back(currentSurfaces[i].handle());
+      }
+    }
+
+    if (!changes.removedSurfaces.empty() || !changes.addedSurfaces.empty() || !changes.modifiedSurfaces.empty()) {
+      result.m_spaceChanges.push_back(changes);
+    }
+  }
+
+  result.m_isIncremental = true;
+  return result;
+}
+
+bool FloorspaceChangeSet::isIncremental() const {
+  return m_isIncremental;
+}
+
+bool FloorspaceChangeSet::empty() const {
+  return m_isIncremental && m_spaceChanges.empty();
+}
+
+const std::vector<FloorspaceSpaceChanges>& FloorspaceChangeSet::spaceChanges() const {
+  return m_spaceChanges;
+}
+
+bool FloorspaceChangeSet::apply(model::Model& currentModel, const model::Model& exportModel) const {
+  if (!m_isIncremental) {
+    return false;
+  }
+
+  // check everything resolves before touching the model
+  for (const auto& changes : m_spaceChanges) {
+    if (!currentModel.getModelObject<model::Space>(changes.currentSpace) || !exportModel.getModelObject<model::Space>(changes.exportSpace)) {
+      return false;
+    }
+    for (const auto& handle : changes.removedSurfaces) {
+      if (!currentModel.getModelObject<model::Surface>(handle)) {
+        return false;
+      }
+    }
+    for (const auto& handle : changes.addedSurfaces) {
+      if (!exportModel.getModelObject<model::Surface>(handle)) {
+        return false;
+      }
+    }
+    for (const auto& p : changes.modifiedSurfaces) {
+      if (!currentModel.getModelObject<model::Surface>(p.first) || !exportModel.getModelObject<model::Surface>(p.second)) {
+        return false;
+      }
+    }
+  }
+  for (const auto& p : m_matchedSurfaces) {
+    if (!currentModel.getModelObject<model::Surface>(p.second)) {
+      return false;
+    }
+  }
+
+  // export surface to current surface after the changes are applied
+  std::map<Handle, Handle> exportToCurrentSurfaces = m_matchedSurfaces;
+
+  for (const auto& changes : m_spaceChanges) {
+    model::Space currentSpace = currentModel.getModelObject<model::Space>(changes.currentSpace).get();
+
+    for (const auto& handle : changes.removedSurfaces) {
+      currentModel.getModelObject<model::Surface>(handle)->remove();
+    }
+
+    for (const auto& p : changes.modifiedSurfaces) {
+      model::Surface currentSurface = currentModel.getModelObject<model::Surface>(p.first).get();
+      model::Surface exportSurface = exportModel.getModelObject<model::Surface>(p.second).get();
+
+      for (auto& subSurface : currentSurface.subSurfaces()) {
+        subSurface.remove();
+      }
+
+      if (currentSurface.setVertices(exportSurface.vertices())) {
+        currentSurface.setSurfaceType(exportSurface.surfaceType());
+        for (const auto& exportSubSurface : exportSurface.subSurfaces()) {
+          model::SubSurface clone = exportSubSurface.clone(currentModel).cast<model::SubSurface>();
+          clone.setSurface(currentSurface);
+        }
+      } else {
+        // new geometry was not accepted, replace the surface instead
+        currentSurface.remove();
+        model::Surface clone = exportSurface.clone(currentModel).cast<model::Surface>();
+        clone.setSpace(currentSpace);
+        currentSurface = clone;
+      }
+
+      exportToCurrentSurfaces[exportSurface.handle()] = currentSurface.handle();
+    }
+
+    for (const auto& handle : changes.addedSurfaces) {
+      model::Surface exportSurface = exportModel.getModelObject<model::Surface>(handle).get();
+      model::Surface clone = exportSurface.clone(currentModel).cast<model::Surface>();
+      clone.setSpace(currentSpace);
+      exportToCurrentSurfaces[exportSurface.handle()] = clone.handle();
+    }
+  }
+
+  // restore surface matching for surfaces that changed and their neighbors
+  std::set<Handle> changedSpaces;
+  for (const auto& changes : m_spaceChanges) {
+    changedSpaces.insert(changes.exportSpace);
+  }
+  for (const auto& exportSurface : exportModel.getConcreteModelObjects<model::Surface>()) {
+    boost::optional<model::Space> exportSpace = exportSurface.space();
+    if (!exportSpace || (changedSpaces.find(exportSpace->handle()) == changedSpaces.end())) {
+      continue;
+    }
+
+    auto it = exportToCurrentSurfaces.find(exportSurface.handle());
+    if (it == exportToCurrentSurfaces.end()) {
+      continue;
+    }
+    model::Surface currentSurface = currentModel.getModelObject<model::Surface>(it->second).get();
+
+    boost::optional<model::Surface> exportAdjacentSurface = exportSurface.adjacentSurface();
+    if (exportAdjacentSurface) {
+      auto adjacentIt = exportToCurrentSurfaces.find(exportAdjacentSurface->handle());
+      if (adjacentIt != exportToCurrentSurfaces.end()) {
+        boost::optional<model::Surface> currentAdjacentSurface = currentSurface.adjacentSurface();
+        if (!currentAdjacentSurface || (currentAdjacentSurface->handle() != adjacentIt->second)) {
+          model::Surface adjacentSurface = currentModel.getModelObject<model::Surface>(adjacentIt->second).get();
+          currentSurface.setAdjacentSurface(adjacentSurface);
+        }
+      }
+    } else if (!istringEqual(currentSurface.outsideBoundaryCondition(), exportSurface.outsideBoundaryCondition())) {
+      currentSurface.setOutsideBoundaryCondition(exportSurface.outsideBoundaryCondition());
+    }
+  }
+
+  return true;
+}
+
+}  // namespace openstudio
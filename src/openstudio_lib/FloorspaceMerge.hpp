@@ -0,0 +1,108 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_FLOORSPACEMERGE_HPP
+#define OPENSTUDIO_FLOORSPACEMERGE_HPP
+
+#include <openstudio/model/Model.hpp>
+
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/UUID.hpp>
+#include <openstudio/utilities/geometry/FloorplanJS.hpp>
+
+#include <boost/optional.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+// Result of translating an exported floorplan, see FloorspaceEditor::translateExport
+struct FloorspaceTranslation
+{
+  boost::optional<model::Model> exportModel;
+  // current model handle to export model handle
+  std::map<UUID, UUID> handleMapping;
+  std::vector<LogMessage> errors;
+  std::vector<LogMessage> warnings;
+};
+
+// Surfaces of one space that differ between the current model and the export model
+struct FloorspaceSpaceChanges
+{
+  Handle currentSpace;
+  Handle exportSpace;
+  // current surfaces with no counterpart in the export
+  std::vector<Handle> removedSurfaces;
+  // export surfaces with no counterpart in the current model
+  std::vector<Handle> addedSurfaces;
+  // current surface, export surface with the same name and type but different geometry
+  std::vector<std::pair<Handle, Handle>> modifiedSurfaces;
+};
+
+// Difference between the current model and a translated floorplan, applied in place of a full ModelMerger merge
+// when the edit only touched surface geometry
+class FloorspaceChangeSet
+{
+ public:
+  FloorspaceChangeSet();
+
+  // reverse translates floorplan and matches plenum zones against currentModel
+  // does not touch the gui or currentModel, so it may run on a worker thread against a snapshot
+  static FloorspaceTranslation translate(const FloorplanJS& floorplan, const model::Model& currentModel, const std::string& buildingName,
+                                         const std::string& siteName, const boost::optional<Handle>& defaultConstructionSetHandle);
+
+  // compares currentModel to exportModel, may run on a worker thread against a snapshot
+  static FloorspaceChangeSet compute(const model::Model& currentModel, const model::Model& exportModel, const std::map<UUID, UUID>& handleMapping);
+
+  // false if anything but surface geometry changed, a full merge is needed
+  bool isIncremental() const;
+
+  // no changes at all
+  bool empty() const;
+
+  const std::vector<FloorspaceSpaceChanges>& spaceChanges() const;
+
+  // applies the changes to currentModel in one pass, currentModel must have the handles the change set was computed from
+  // returns false without modifying currentModel if the change set does not apply
+  bool apply(model::Model& currentModel, const model::Model& exportModel) const;
+
+ private:
+  REGISTER_LOGGER("openstudio::FloorspaceChangeSet");
+
+  bool m_isIncremental;
+  std::vector<FloorspaceSpaceChanges> m_spaceChanges;
+  // export surface to current surface, for surfaces that are unchanged
+  std::map<Handle, Handle> m_matchedSurfaces;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_FLOORSPACEMERGE_HPP
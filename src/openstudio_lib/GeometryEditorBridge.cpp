@@ -0,0 +1,165 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "GeometryEditorBridge.hpp"
+
+#include <openstudio/utilities/core/Logger.hpp>
+
+#include <QFile>
+#include <QTimer>
+#include <QWebChannel>
+#include <QWebEnginePage>
+#include <QWebEngineScript>
+#include <QWebEngineScriptCollection>
+
+namespace openstudio {
+
+GeometryEditorBridge::GeometryEditorBridge(QObject* parent, int debounceMSec)
+  : QObject(parent),
+    m_debounceTimer(new QTimer(this)),
+    m_channel(nullptr),
+    m_versionNumber(0),
+    m_reportedVersionNumber(0),
+    m_suspended(false),
+    m_pageConnected(false) {
+  m_debounceTimer->setSingleShot(true);
+  m_debounceTimer->setInterval(debounceMSec);
+  connect(m_debounceTimer, &QTimer::timeout, this, &GeometryEditorBridge::onDebounceTimeout);
+}
+
+GeometryEditorBridge::~GeometryEditorBridge() {}
+
+void GeometryEditorBridge::attachToPage(QWebEnginePage* page) {
+  if (!m_channel) {
+    m_channel = new QWebChannel(this);
+    m_channel->registerObject(QStringLiteral("geometryEditorBridge"), this);
+  }
+  page->setWebChannel(m_channel);
+
+  // the editor pages are not ours to modify, inject qwebchannel.js into every page instead
+  QWebEngineScriptCollection& scripts = page->scripts();
+  if (scripts.findScript(QStringLiteral("qwebchannel")).isNull()) {
+    QFile webChannelFile(":/qtwebchannel/qwebchannel.js");
+    if (webChannelFile.open(QFile::ReadOnly)) {
+      QWebEngineScript script;
+      script.setName(QStringLiteral("qwebchannel"));
+      script.setSourceCode(QString::fromUtf8(webChannelFile.readAll()));
+      script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+      script.setWorldId(QWebEngineScript::MainWorld);
+      script.setRunsOnSubFrames(false);
+      scripts.insert(script);
+    } else {
+      LOG_FREE(Error, "openstudio::GeometryEditorBridge", "Cannot open qwebchannel.js, geometry editor changes will not be detected");
+    }
+  }
+}
+
+QString GeometryEditorBridge::onChangeJavaScript() {
+  // window.versionNumber is kept for compatibility
+  return QString("(function () {\n\
+  var bridge = null;\n\
+  window.api.config.onChange = function () {\n\
+    window.versionNumber += 1;\n\
+    if (bridge) {\n\
+      bridge.notifyChanged(window.versionNumber);\n\
+    }\n\
+  };\n\
+  new QWebChannel(qt.webChannelTransport, function (channel) {\n\
+    bridge = channel.objects.geometryEditorBridge;\n\
+    bridge.notifyChanged(window.versionNumber || 0);\n\
+  });\n\
+})();");
+}
+
+unsigned GeometryEditorBridge::versionNumber() const {
+  return m_versionNumber;
+}
+
+unsigned GeometryEditorBridge::reportedVersionNumber() const {
+  return m_reportedVersionNumber;
+}
+
+bool GeometryEditorBridge::hasPendingChange() const {
+  return m_versionNumber != m_reportedVersionNumber;
+}
+
+bool GeometryEditorBridge::pageConnected() const {
+  return m_pageConnected;
+}
+
+bool GeometryEditorBridge::takePendingChange() {
+  m_debounceTimer->stop();
+  if (!hasPendingChange()) {
+    return false;
+  }
+  m_reportedVersionNumber = m_versionNumber;
+  return true;
+}
+
+void GeometryEditorBridge::reset() {
+  m_debounceTimer->stop();
+  m_versionNumber = 0;
+  m_reportedVersionNumber = 0;
+  m_pageConnected = false;
+}
+
+bool GeometryEditorBridge::setSuspended(bool suspended) {
+  bool result = m_suspended;
+  m_suspended = suspended;
+  if (!m_suspended && hasPendingChange()) {
+    m_debounceTimer->start();
+  }
+  return result;
+}
+
+bool GeometryEditorBridge::suspended() const {
+  return m_suspended;
+}
+
+void GeometryEditorBridge::notifyChanged(unsigned versionNumber) {
+  m_pageConnected = true;
+  m_versionNumber = versionNumber;
+  if (hasPendingChange()) {
+    // restart, report once the page has been quiet for the debounce interval
+    m_debounceTimer->start();
+  } else {
+    m_debounceTimer->stop();
+  }
+}
+
+void GeometryEditorBridge::onDebounceTimeout() {
+  if (m_suspended) {
+    return;
+  }
+  if (takePendingChange()) {
+    emit changed();
+  }
+}
+
+}  // namespace openstudio
@@ -0,0 +1,105 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_GEOMETRYEDITORBRIDGE_HPP
+#define OPENSTUDIO_GEOMETRYEDITORBRIDGE_HPP
+
+#include <QObject>
+#include <QString>
+
+class QTimer;
+class QWebChannel;
+class QWebEnginePage;
+
+namespace openstudio {
+
+// Receives change notifications pushed by the geometry editor page over a QWebChannel
+// bursts of edits are debounced into a single changed signal
+class GeometryEditorBridge : public QObject
+{
+  Q_OBJECT
+
+ public:
+  static constexpr int defaultDebounceMSec = 500;
+
+  explicit GeometryEditorBridge(QObject* parent = nullptr, int debounceMSec = defaultDebounceMSec);
+
+  virtual ~GeometryEditorBridge();
+
+  // Registers the bridge on page's web channel and injects qwebchannel.js into it, must be called before the page loads
+  void attachToPage(QWebEnginePage* page);
+
+  // Hooks the editor's window.api.config.onChange to notifyChanged, run once the editor's api is loaded
+  static QString onChangeJavaScript();
+
+  // latest version reported by the page
+  unsigned versionNumber() const;
+
+  // version last reported through changed
+  unsigned reportedVersionNumber() const;
+
+  bool hasPendingChange() const;
+
+  // true once the page has called notifyChanged, until then versions are meaningless
+  bool pageConnected() const;
+
+  // marks the pending change as reported, returns false if there was none
+  bool takePendingChange();
+
+  // page was (re)loaded, it is not connected until it calls notifyChanged again
+  void reset();
+
+  // while suspended changes are kept pending, returns the previous state
+  bool setSuspended(bool suspended);
+
+  bool suspended() const;
+
+  // called from the page
+  Q_INVOKABLE void notifyChanged(unsigned versionNumber);
+
+ signals:
+
+  void changed();
+
+ private slots:
+
+  void onDebounceTimeout();
+
+ private:
+  QTimer* m_debounceTimer;
+  QWebChannel* m_channel;
+  unsigned m_versionNumber;
+  unsigned m_reportedVersionNumber;
+  bool m_suspended;
+  bool m_pageConnected;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_GEOMETRYEDITORBRIDGE_HPP
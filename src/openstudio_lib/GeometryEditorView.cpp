@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "GeometryEditorView.hpp"
+#include "GeometryEditorBridge.hpp"
 #include "GeometryPreviewView.hpp"
 #include "OSAppBase.hpp"
 #include "OSDocument.hpp"
@@ -98,11 +99,10 @@
 #include <QProcess>
 #include <QSettings>
 #include <QProcessEnvironment>
+#include <QtConcurrent>
 
 #include <boost/algorithm/string/predicate.hpp>
 
-const int CHECKFORUPDATEMSEC = 5000;
-
 namespace openstudio {
 
 QUrl getEmbeddedFileUrl(const QString& filename) {
@@ -146,9 +146,12 @@ DebugWebView::DebugWebView(const QString& debugPort, QWidget* parent) : QDialog(
 DebugWebView::~DebugWebView() {}
 
 BaseEditor::BaseEditor(bool isIP, const openstudio::model::Model& model, QWebEngineView* view, QWidget* t_parent)
-  : QObject(t_parent), m_editorLoaded(false), m_javascriptRunning(false), m_versionNumber(0), m_isIP(isIP), m_model(model), m_view(view) {
-  m_checkForUpdateTimer = new QTimer(this);
-  connect(m_checkForUpdateTimer, &QTimer::timeout, this, &BaseEditor::checkForUpdate);
+  : QObject(t_parent), m_editorLoaded(false), m_javascriptRunning(false), m_isIP(isIP), m_model(model), m_view(view) {
+  m_bridge = new GeometryEditorBridge(this);
+  connect(m_bridge, &GeometryEditorBridge::changed, this, &BaseEditor::onChanged);
+
+  // must be attached before the editor page loads
+  m_bridge->attachToPage(m_view->page());
 
   openstudio::OSAppBase* app = OSAppBase::instance();
   OS_ASSERT(app);
@@ -166,8 +169,8 @@ bool BaseEditor::javascriptRunning() const {
   return m_javascriptRunning;
 }
 
-bool BaseEditor::blockUpdateTimerSignals(bool block) {
-  return m_checkForUpdateTimer->blockSignals(block);
+bool BaseEditor::suspendChangeNotifications(bool suspend) {
+  return m_bridge->setSuspended(suspend);
 }
 
 model::Model BaseEditor::exportModel() const {
@@ -178,6 +181,10 @@ std::map<UUID, UUID> BaseEditor::exportModelHandleMapping() const {
   return m_exportModelHandleMapping;
 }
 
+bool BaseEditor::mergeIncremental(openstudio::model::Model& model) {
+  return false;
+}
+
 void BaseEditor::onChanged() {
   emit changed();
   //m_document->markAsModified();
@@ -320,6 +327,20 @@ void FloorspaceEditor::loadEditor() {
     }
   }
 
+  // push changes to the bridge, the page is new so it is not connected yet
+  {
+    OS_ASSERT(!m_javascriptRunning);
+
+    m_javascriptRunning = true;
+
+    m_bridge->reset();
+    QString javascript = GeometryEditorBridge::onChangeJavaScript();
+    m_view->page()->runJavaScript(javascript, [this](const QVariant& v) { m_javascriptRunning = false; });
+    while (m_javascriptRunning) {
+      OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
+    }
+  }
+
   // start the app
   {
     OS_ASSERT(!m_javascriptRunning);
@@ -426,15 +447,22 @@ document.head.appendChild(style);\n";
 
   m_editorLoaded = true;
 
-  // start checking for updates
-  m_versionNumber = 0;
-  m_checkForUpdateTimer->start(CHECKFORUPDATEMSEC);
+  // changes made by loading the floorplan are not edits
+  m_bridge->takePendingChange();
+  m_exportedVersionNumber.reset();
 }
 
 void FloorspaceEditor::doExport() {
   bool t = true;
 
+  // nothing changed in the page since the last export
+  if (m_bridge->pageConnected() && m_floorplan && !m_export.isNull() && m_exportedVersionNumber
+      && (*m_exportedVersionNumber == m_bridge->versionNumber())) {
+    return;
+  }
+
   if (m_editorLoaded && !m_javascriptRunning) {
+    unsigned versionNumber = m_bridge->versionNumber();
     m_javascriptRunning = true;
     m_document->disable();
     QString javascript = QString("JSON.stringify(window.api.exportFloorplan());");
@@ -451,8 +479,11 @@ void FloorspaceEditor::doExport() {
     std::string contents = m_export.value<QString>().toStdString();
     m_floorplan = FloorplanJS::load(contents);
 
-    if (!m_floorplan) {
+    if (m_floorplan) {
+      m_exportedVersionNumber = versionNumber;
+    } else {
       // DLM: This is an error
+      m_exportedVersionNumber.reset();
       t = false;
     }
 
@@ -486,169 +517,54 @@ void FloorspaceEditor::saveExport() {
 }
 
 void FloorspaceEditor::translateExport() {
-  model::ThreeJSReverseTranslator rt;
-  boost::optional<model::Model> model;
-  boost::optional<Handle> cloneDefaultConstructionSetHandle;
-  if (m_floorplan) {
-    ThreeScene scene = m_floorplan->toThreeScene(true);
-    model = rt.modelFromThreeJS(scene);
-
-    if (model) {
-      // set north axis, floorspace js northAxis is opposite of EnergyPlus's
-      model::Building building = model->getUniqueModelObject<model::Building>();
-      building.setName(m_originalBuildingName);
-      building.setNorthAxis(-m_floorplan->northAxis());
-
-      // synchronize latitude and longitude, floorspace does not set elevation when locating on map
-      model::Site site = model->getUniqueModelObject<model::Site>();
-      site.setName(m_originalSiteName);
-      double latitude = m_floorplan->latitude();
-      double longitude = m_floorplan->longitude();
-      if ((latitude != 0) && (longitude != 0)) {
-        site.setLatitude(latitude);
-        site.setLongitude(latitude);
-      }
-    }
-  } else {
+  m_changeSet.reset();
+
+  if (!m_floorplan) {
     // DLM: this is an error, the editor produced a JSON we can't read
+    m_exportModel = model::Model();
+    m_exportModelHandleMapping.clear();
+    return;
   }
 
+  // reverse translate and diff against a snapshot on a worker thread, the live model is only touched when merging
+  model::Model snapshot = m_model.clone(true).cast<model::Model>();
+  FloorplanJS floorplan = *m_floorplan;
+  std::string buildingName = m_originalBuildingName;
+  std::string siteName = m_originalSiteName;
+  boost::optional<Handle> defaultConstructionSetHandle;
+  if (m_originalDefaultConstructionSet) {
+    defaultConstructionSetHandle = m_originalDefaultConstructionSet->handle();
+  }
+
+  using TranslationResult = std::pair<FloorspaceTranslation, FloorspaceChangeSet>;
+  QFuture<TranslationResult> future = QtConcurrent::run([snapshot, floorplan, buildingName, siteName, defaultConstructionSetHandle]() {
+    TranslationResult result;
+    result.first = FloorspaceChangeSet::translate(floorplan, snapshot, buildingName, siteName, defaultConstructionSetHandle);
+    if (result.first.exportModel) {
+      result.second = FloorspaceChangeSet::compute(snapshot, *result.first.exportModel, result.first.handleMapping);
+    }
+    return result;
+  });
+  while (!future.isFinished()) {
+    OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
+  }
+  TranslationResult result = future.result();
+
   QString errorsAndWarnings;
-  for (const auto& error : rt.errors()) {
+  for (const auto& error : result.first.errors) {
     errorsAndWarnings += QString::fromStdString(error.logMessage() + "\n");
   }
-  for (const auto& warning : rt.warnings()) {
+  for (const auto& warning : result.first.warnings) {
     errorsAndWarnings += QString::fromStdString(warning.logMessage() + "\n");
   }
   if (!errorsAndWarnings.isEmpty()) {
     QMessageBox::warning(qobject_cast<QWidget*>(parent()), "Creating Model From Floorplan", errorsAndWarnings);
   }
 
-  if (model) {
-    m_exportModel = *model;
-    m_exportModelHandleMapping = rt.handleMapping();
-
-    // User cannot edit thermal zone for plenums in floorspace, a new thermal zone will always be created for each plenum
-    // if the associated space has a thermal zone in FloorplanJS::toThreeScene.  This was probably a bad decision, since
-    // the user cannot see or edit this zone we should not create it.  Created floorspace.js/issues/388 to better attach
-    // information related to plenum zones
-
-    // the exported plenum space is not matched to an existing space, so existing space will be replaced by exported space
-    // we can throw away the new plenum zone, it will not be mapped to anything
-    bool removedPlenumZones = false;
-    for (const auto& exportSpace : m_exportModel.getConcreteModelObjects<model::Space>()) {
-      if (boost::algorithm::ends_with(exportSpace.nameString(), "Plenum")) {
-        boost::optional<model::ThermalZone> exportThermalZone = exportSpace.thermalZone();
-        if (exportThermalZone && (exportThermalZone->spaces().size() == 1u)) {
-          exportThermalZone->remove();
-          removedPlenumZones = true;
-        }
-      }
-    }
-
-    if (removedPlenumZones) {
-      // attempt to match thermal zones for existing plenums with new plenums
-      for (const auto& space : m_model.getConcreteModelObjects<model::Space>()) {
-        boost::optional<model::Space> abovePlenumSpace;
-        boost::optional<model::Space> belowPlenumSpace;
-        for (const auto& surface : space.surfaces()) {
-          if (istringEqual(surface.surfaceType(), "RoofCeiling")) {
-            auto adjacentSurface = surface.adjacentSurface();
-            if (adjacentSurface) {
-              abovePlenumSpace = adjacentSurface->space();
-              if (abovePlenumSpace && !abovePlenumSpace->isPlenum() && !boost::algorithm::icontains(abovePlenumSpace->nameString(), "Plenum")) {
-                abovePlenumSpace.reset();
-              }
-            }
-          } else if (istringEqual(surface.surfaceType(), "Floor")) {
-            auto adjacentSurface = surface.adjacentSurface();
-            if (adjacentSurface) {
-              belowPlenumSpace = adjacentSurface->space();
-              if (belowPlenumSpace && !belowPlenumSpace->isPlenum() && !boost::algorithm::icontains(belowPlenumSpace->nameString(), "Plenum")) {
-                belowPlenumSpace.reset();
-              }
-            }
-          }
-        }
-
-        boost::optional<model::Space> exportSpace;
-        boost::optional<model::Space> exportAbovePlenumSpace;
-        boost::optional<model::Space> exportBelowPlenumSpace;
-        auto exportSpaceHandle = m_exportModelHandleMapping.find(space.handle());
-        if (exportSpaceHandle != m_exportModelHandleMapping.end()) {
-          exportSpace = m_exportModel.getModelObject<model::Space>(exportSpaceHandle->second);
-          if (exportSpace) {
-            for (const auto& surface : exportSpace->surfaces()) {
-              if (istringEqual(surface.surfaceType(), "RoofCeiling")) {
-                auto adjacentSurface = surface.adjacentSurface();
-                if (adjacentSurface) {
-                  exportAbovePlenumSpace = adjacentSurface->space();
-                  if (exportAbovePlenumSpace && !boost::algorithm::ends_with(exportAbovePlenumSpace->nameString(), "Plenum")) {
-                    exportAbovePlenumSpace.reset();
-                  }
-                }
-              } else if (istringEqual(surface.surfaceType(), "Floor")) {
-                auto adjacentSurface = surface.adjacentSurface();
-                if (adjacentSurface) {
-                  exportBelowPlenumSpace = adjacentSurface->space();
-                  if (exportBelowPlenumSpace && !boost::algorithm::ends_with(exportBelowPlenumSpace->nameString(), "Plenum")) {
-                    exportBelowPlenumSpace.reset();
-                  }
-                }
-              }
-            }
-          }
-        }
-
-        if (abovePlenumSpace && exportAbovePlenumSpace) {
-          boost::optional<model::ThermalZone> thermalZone = abovePlenumSpace->thermalZone();
-          if (thermalZone) {
-            auto exportThermalZoneHandle = m_exportModelHandleMapping.find(thermalZone->handle());
-            if (exportThermalZoneHandle != m_exportModelHandleMapping.end()) {
-              boost::optional<model::ThermalZone> exportThermalZone =
-                m_exportModel.getModelObject<model::ThermalZone>(exportThermalZoneHandle->second);
-              if (exportThermalZone) {
-                exportAbovePlenumSpace->setThermalZone(*exportThermalZone);
-              }
-            }
-          }
-        }
-
-        if (belowPlenumSpace && exportBelowPlenumSpace) {
-          boost::optional<model::ThermalZone> thermalZone = belowPlenumSpace->thermalZone();
-          if (thermalZone) {
-            auto exportThermalZoneHandle = m_exportModelHandleMapping.find(thermalZone->handle());
-            if (exportThermalZoneHandle != m_exportModelHandleMapping.end()) {
-              boost::optional<model::ThermalZone> exportThermalZone =
-                m_exportModel.getModelObject<model::ThermalZone>(exportThermalZoneHandle->second);
-              if (exportThermalZone) {
-                exportBelowPlenumSpace->setThermalZone(*exportThermalZone);
-              }
-            }
-          }
-        }
-      }
-    }
-
-    // manually add mappings between current model and new model for Site, Facility, and Building objects
-    m_exportModelHandleMapping[m_model.getUniqueModelObject<model::Site>().handle()] = m_exportModel.getUniqueModelObject<model::Site>().handle();
-    m_exportModelHandleMapping[m_model.getUniqueModelObject<model::Facility>().handle()] =
-      m_exportModel.getUniqueModelObject<model::Facility>().handle();
-    m_exportModelHandleMapping[m_model.getUniqueModelObject<model::Building>().handle()] =
-      m_exportModel.getUniqueModelObject<model::Building>().handle();
-
-    // restore properties on unique objects
-    if (m_originalDefaultConstructionSet) {
-      auto it = m_exportModelHandleMapping.find(m_originalDefaultConstructionSet->handle());
-      if (it != m_exportModelHandleMapping.end()) {
-        boost::optional<model::DefaultConstructionSet> exportDefaultConstructionSet =
-          m_exportModel.getModelObject<model::DefaultConstructionSet>(it->second);
-        if (exportDefaultConstructionSet) {
-          m_exportModel.getUniqueModelObject<model::Building>().setDefaultConstructionSet(*exportDefaultConstructionSet);
-        }
-      }
-    }
-
+  if (result.first.exportModel) {
+    m_exportModel = *result.first.exportModel;
+    m_exportModelHandleMapping = result.first.handleMapping;
+    m_changeSet = result.second;
   } else {
     // DLM: this is an error, either floorplan was empty or could not be translated
     m_exportModel = model::Model();
@@ -656,11 +572,23 @@ void FloorspaceEditor::translateExport() {
   }
 }
 
+bool FloorspaceEditor::mergeIncremental(openstudio::model::Model& model) {
+  if (!m_changeSet || !m_changeSet->isIncremental()) {
+    return false;
+  }
+  bool result = m_changeSet->apply(model, m_exportModel);
+  m_changeSet.reset();
+  return result;
+}
+
 void FloorspaceEditor::updateModel(const openstudio::model::Model& model) {
   if (m_floorplan) {
 
     m_model = model;
 
+    // handles change, next export must come from the page
+    m_exportedVersionNumber.reset();
+
     // make sure handles get updated in floorplan and the exported string
     model::FloorplanJSForwardTranslator ft;
     m_floorplan = ft.updateFloorplanJS(*m_floorplan, m_model, false);
@@ -693,45 +621,9 @@ void FloorspaceEditor::updateModel(const openstudio::model::Model& model) {
 }
 
 void FloorspaceEditor::checkForUpdate() {
-  if (!m_javascriptRunning) {
-    m_javascriptRunning = true;
-
-    // DLM: don't disable and enable the tabs, too distracting
-    //m_document->disable();
-
-    unsigned currentVersionNumber = m_versionNumber;
-
-    QString javascript = QString("window.versionNumber;");
-    m_view->page()->runJavaScript(javascript, [this](const QVariant& v) {
-      m_versionNumber = v.toUInt();
-      m_javascriptRunning = false;
-    });
-
-    // DLM: the javascript engine appears to stop when a file dialog is launched by the editor (e.g. to import an image)
-    int processEventsTime = 200;
-    boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
-    while (m_javascriptRunning) {
-      // if the javascript is taking too long to evaluate, bail out here
-      // DLM: multiply elapsed time by two, we want to make sure we have half of the time between update checks to process other events
-      int elapsed = 2 * (boost::posix_time::microsec_clock::universal_time() - start).total_milliseconds();
-      if (elapsed > CHECKFORUPDATEMSEC) {
-        break;
-      }
-      // DLM: instead ignore user events
-      // DLM: this is a problem during file dialogs launched by the editor
-      OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, processEventsTime);
-    }
-
-    //m_document->enable();
-
-    if (m_javascriptRunning) {
-      // DLM: do not set this to false, we will require the javascript to complete
-      //m_javascriptRunning = false;
-    } else {
-      if (currentVersionNumber != m_versionNumber) {
-        onChanged();
-      }
-    }
+  // report a change the page pushed that is still waiting on the debounce
+  if (m_bridge->takePendingChange()) {
+    onChanged();
   }
 }
 
@@ -782,8 +674,7 @@ void GbXmlEditor::loadEditor() {
   m_editorLoaded = true;
 
   // start checking for updates
-  //m_versionNumber = 0;
-  //m_checkForUpdateTimer->start(CHECKFORUPDATEMSEC);
+  //m_bridge->reset();
 }
 
 void GbXmlEditor::doExport() {
@@ -941,8 +832,7 @@ void IdfEditor::loadEditor() {
   m_editorLoaded = true;
 
   // start checking for updates
-  //m_versionNumber = 0;
-  //m_checkForUpdateTimer->start(CHECKFORUPDATEMSEC);
+  //m_bridge->reset();
 }
 
 void IdfEditor::doExport() {
@@ -1051,8 +941,7 @@ void OsmEditor::loadEditor() {
   m_editorLoaded = true;
 
   // start checking for updates
-  //m_versionNumber = 0;
-  //m_checkForUpdateTimer->start(CHECKFORUPDATEMSEC);
+  //m_bridge->reset();
 }
 
 void OsmEditor::doExport() {
@@ -1245,7 +1134,7 @@ EditorWebView::EditorWebView(bool isIP, const openstudio::model::Model& model, Q
 
 EditorWebView::~EditorWebView() {
   if (m_baseEditor && m_baseEditor->editorLoaded()) {
-    m_baseEditor->blockUpdateTimerSignals(true);
+    m_baseEditor->suspendChangeNotifications(true);
     m_baseEditor->checkForUpdate();
   }
   if (m_mergeWarn) {
@@ -1443,7 +1332,7 @@ void EditorWebView::previewExport() {
     // save the exported floorplan
     m_baseEditor->saveExport();
 
-    bool signalsBlocked = m_baseEditor->blockUpdateTimerSignals(true);
+    bool suspended = m_baseEditor->suspendChangeNotifications(true);
 
     PreviewWebView* webView = new PreviewWebView(m_isIP, temp);
     QLayout* layout = new QVBoxLayout();
@@ -1459,7 +1348,7 @@ void EditorWebView::previewExport() {
     delete webView;
     delete layout;
 
-    m_baseEditor->blockUpdateTimerSignals(signalsBlocked);
+    m_baseEditor->suspendChangeNotifications(suspended);
 
     m_document->enable();
     m_previewBtn->setEnabled(true);
@@ -1475,9 +1364,11 @@ void EditorWebView::mergeExport() {
     // translate the exported floorplan
     m_baseEditor->translateExport();
 
-    // merge export model into m_model
+    // merge export model into m_model, geometry only edits are applied without the full merge
     model::ModelMerger mm;
-    mm.mergeModels(m_model, m_baseEditor->exportModel(), m_baseEditor->exportModelHandleMapping());
+    if (!m_baseEditor->mergeIncremental(m_model)) {
+      mm.mergeModels(m_model, m_baseEditor->exportModel(), m_baseEditor->exportModelHandleMapping());
+    }
 
     QString errorsAndWarnings;
     for (const auto& error : mm.errors()) {
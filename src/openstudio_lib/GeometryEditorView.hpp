@@ -32,6 +32,7 @@
 
 #include "ModelObjectInspectorView.hpp"
 #include "ModelSubTabView.hpp"
+#include "FloorspaceMerge.hpp"
 #include "OSWebEnginePage.hpp"
 
 #include <openstudio/model/Model.hpp>
@@ -46,10 +47,11 @@
 
 class QComboBox;
 class QPushButton;
-class QTimer;
 
 namespace openstudio {
 
+class GeometryEditorBridge;
+
 class GeometryEditorView : public QWidget
 {
   Q_OBJECT
@@ -87,11 +89,14 @@ class BaseEditor : public QObject
 
   bool editorLoaded() const;
   bool javascriptRunning() const;
-  bool blockUpdateTimerSignals(bool block);
+  bool suspendChangeNotifications(bool suspend);
 
   model::Model exportModel() const;
   std::map<UUID, UUID> exportModelHandleMapping() const;
 
+  // merges the last translated export into model without ModelMerger if possible, returns false if a full merge is needed
+  virtual bool mergeIncremental(openstudio::model::Model& model);
+
  public slots:
   virtual void loadEditor() = 0;
   virtual void doExport() = 0;
@@ -109,7 +114,6 @@ class BaseEditor : public QObject
  protected:
   bool m_editorLoaded;
   bool m_javascriptRunning;
-  unsigned m_versionNumber;
 
   bool m_isIP;
   openstudio::model::Model m_model;
@@ -120,7 +124,9 @@ class BaseEditor : public QObject
   std::map<UUID, UUID> m_exportModelHandleMapping;
 
   std::shared_ptr<OSDocument> m_document;
-  QTimer* m_checkForUpdateTimer;
+
+  // page pushes change notifications through the bridge
+  GeometryEditorBridge* m_bridge;
 };
 
 class FloorspaceEditor : public BaseEditor
@@ -132,6 +138,8 @@ class FloorspaceEditor : public BaseEditor
                    QWidget* t_parent = nullptr);
   virtual ~FloorspaceEditor();
 
+  virtual bool mergeIncremental(openstudio::model::Model& model) override;
+
  public slots:
   virtual void loadEditor() override;
   virtual void doExport() override;
@@ -146,6 +154,8 @@ class FloorspaceEditor : public BaseEditor
   boost::optional<openstudio::model::DefaultConstructionSet> m_originalDefaultConstructionSet;
   openstudio::path m_floorplanPath;
   boost::optional<FloorplanJS> m_floorplan;
+  boost::optional<unsigned> m_exportedVersionNumber;
+  boost::optional<FloorspaceChangeSet> m_changeSet;
 };
 
 class GbXmlEditor : public BaseEditor
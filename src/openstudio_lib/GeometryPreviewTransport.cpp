@@ -0,0 +1,78 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "GeometryPreviewTransport.hpp"
+
+#include <openstudio/model/ThreeJSForwardTranslator.hpp>
+
+#include <openstudio/utilities/core/Assert.hpp>
+#include <openstudio/utilities/geometry/ThreeJS.hpp>
+
+namespace openstudio {
+
+GeometryPreviewTransport::GeometryPreviewTransport(QObject* parent, int chunkSize) : QObject(parent), m_chunkSize(chunkSize) {
+  OS_ASSERT(m_chunkSize > 0);
+}
+
+GeometryPreviewTransport::~GeometryPreviewTransport() {}
+
+QString GeometryPreviewTransport::translate(const model::Model& model, const std::function<void(double)>& updatePercentage) {
+  model::ThreeJSForwardTranslator ft;
+  ThreeScene scene = ft.modelToThreeJS(model, true, updatePercentage);  // triangulated
+  return QString::fromStdString(scene.toJSON(false));                   // no pretty print
+}
+
+void GeometryPreviewTransport::setJSON(const QString& json) {
+  m_json = json;
+}
+
+const QString& GeometryPreviewTransport::json() const {
+  return m_json;
+}
+
+int GeometryPreviewTransport::chunkSize() const {
+  return m_chunkSize;
+}
+
+int GeometryPreviewTransport::chunkCount() const {
+  return (m_json.size() + m_chunkSize - 1) / m_chunkSize;
+}
+
+QString GeometryPreviewTransport::chunk(int index) const {
+  if (index < 0 || index >= chunkCount()) {
+    return QString();
+  }
+  return m_json.mid(index * m_chunkSize, m_chunkSize);
+}
+
+void GeometryPreviewTransport::onSceneLoaded(bool ok) {
+  emit sceneLoaded(ok);
+}
+
+}  // namespace openstudio
@@ -0,0 +1,84 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_GEOMETRYPREVIEWTRANSPORT_HPP
+#define OPENSTUDIO_GEOMETRYPREVIEWTRANSPORT_HPP
+
+#include <openstudio/model/Model.hpp>
+
+#include <QObject>
+#include <QString>
+
+#include <functional>
+
+namespace openstudio {
+
+// Holds the ThreeJS scene for the geometry preview and hands it to the page in chunks over a QWebChannel,
+// passing the whole scene through runJavaScript stalls both processes for large models
+class GeometryPreviewTransport : public QObject
+{
+  Q_OBJECT
+
+ public:
+  static constexpr int defaultChunkSize = 1 << 20;
+
+  explicit GeometryPreviewTransport(QObject* parent = nullptr, int chunkSize = defaultChunkSize);
+
+  virtual ~GeometryPreviewTransport();
+
+  // triangulated ThreeJS translation of model, does not touch the gui so it may run on a worker thread
+  // model should be a snapshot that no other thread is modifying
+  static QString translate(const model::Model& model, const std::function<void(double)>& updatePercentage);
+
+  void setJSON(const QString& json);
+
+  const QString& json() const;
+
+  int chunkSize() const;
+
+  // called from the page
+  Q_INVOKABLE int chunkCount() const;
+
+  Q_INVOKABLE QString chunk(int index) const;
+
+  // ok is false if the page failed to build the scene
+  Q_INVOKABLE void onSceneLoaded(bool ok);
+
+ signals:
+
+  void sceneLoaded(bool ok);
+
+ private:
+  int m_chunkSize;
+  QString m_json;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_GEOMETRYPREVIEWTRANSPORT_HPP
@@ -28,24 +28,26 @@
 ***********************************************************************************************************************/
 
 #include "GeometryPreviewView.hpp"
+#include "GeometryPreviewTransport.hpp"
 #include "OSAppBase.hpp"
 #include "OSDocument.hpp"
 
 #include "../model_editor/Application.hpp"
 
 #include <openstudio/model/Model_Impl.hpp>
-#include <openstudio/model/ThreeJSForwardTranslator.hpp>
 
 #include <openstudio/utilities/core/Assert.hpp>
 #include <openstudio/utilities/idd/IddEnums.hxx>
 
 #include <QStackedWidget>
+#include <QTimer>
 #include <QVBoxLayout>
 #include <QLabel>
 #include <QPushButton>
 #include <QFile>
 #include <QWebEngineSettings>
 #include <QWebEngineScriptCollection>
+#include <QWebChannel>
 #include <QtConcurrent>
 
 using namespace std::placeholders;
@@ -103,6 +105,27 @@ PreviewWebView::PreviewWebView(bool isIP, const model::Model& model, QWidget* t_
   m_page = new OSWebEnginePage(this);
   m_view->setPage(m_page);  // note, view does not take ownership of page
 
+  // the scene is pulled by the page in chunks, see initFromChannel in geometry_preview.html
+  m_channel = new QWebChannel(this);
+  m_transport = new GeometryPreviewTransport(this);
+  m_channel->registerObject(QStringLiteral("previewTransport"), m_transport);
+  m_page->setWebChannel(m_channel);
+
+  connect(m_transport, &GeometryPreviewTransport::sceneLoaded, this, [this](bool ok) {
+    if (ok) {
+      onJavaScriptFinished(QVariant());
+    } else {
+      onSceneFailed();
+    }
+  });
+
+  m_sceneTimer = new QTimer(this);
+  m_sceneTimer->setSingleShot(true);
+  m_sceneTimer->setInterval(60000);
+  connect(m_sceneTimer, &QTimer::timeout, this, &PreviewWebView::onSceneFailed);
+  connect(this, &PreviewWebView::translateProgress, this, &PreviewWebView::onTranslateProgress, Qt::QueuedConnection);
+  connect(&m_translateWatcher, &QFutureWatcher<QString>::finished, this, &PreviewWebView::onTranslateFinished);
+
   connect(m_view, &QWebEngineView::loadFinished, this, &PreviewWebView::onLoadFinished);
   connect(m_view, &QWebEngineView::renderProcessTerminated, this, &PreviewWebView::onRenderProcessTerminated);
 
@@ -141,6 +164,8 @@ PreviewWebView::PreviewWebView(bool isIP, const model::Model& model, QWidget* t_
 }
 
 PreviewWebView::~PreviewWebView() {
+  // the translation thread reports progress through this
+  m_translateWatcher.waitForFinished();
   delete m_page;
   delete m_view;
 }
@@ -176,23 +201,41 @@ void PreviewWebView::onLoadFinished(bool ok) {
   }
 
   if (m_json.isEmpty()) {
-    std::function<void(double)> updatePercentage = std::bind(&PreviewWebView::onTranslateProgress, this, _1);
-    //ThreeScene scene = modelToThreeJS(m_model.clone(true).cast<model::Model>(), true, updatePercentage); // triangulated
-
-    model::ThreeJSForwardTranslator ft;
-    ThreeScene scene = ft.modelToThreeJS(m_model, true, updatePercentage);  // triangulated
-    std::string json = scene.toJSON(false);                                 // no pretty print
-    m_json = QString::fromStdString(json);
-  } else {
-    m_progressBar->setValue(90);
+    if (m_translateWatcher.isRunning()) {
+      // page was reloaded during translation, scene is sent when it finishes
+      return;
+    }
+
+    // translate a snapshot so the model can keep changing while the worker runs
+    model::Model snapshot = m_model.clone(true).cast<model::Model>();
+    std::function<void(double)> updatePercentage = [this](double percentage) { emit translateProgress(percentage); };
+    m_translateWatcher.setFuture(QtConcurrent::run(&GeometryPreviewTransport::translate, snapshot, updatePercentage));
+    return;
   }
 
+  m_progressBar->setValue(90);
+  sendScene();
+}
+
+void PreviewWebView::onTranslateFinished() {
+  m_json = m_translateWatcher.result();
+  m_transport->setJSON(m_json);
+  m_progressBar->setValue(90);
+  sendScene();
+}
+
+void PreviewWebView::sendScene() {
   // disable doc
   m_document->disable();
+  m_sceneTimer->start();
 
-  // call init and animate
-  QString javascript = QString("init(") + m_json + QString(");\n animate();\n initDatGui();");
-  m_view->page()->runJavaScript(javascript, [this](const QVariant& v) { onJavaScriptFinished(v); });
+  // page fetches the chunks, then calls init and animate. initFromChannel returns true once it has started,
+  // anything else means the script threw before the page could report back
+  m_view->page()->runJavaScript(QString("initFromChannel();"), [this](const QVariant& v) {
+    if (!v.toBool()) {
+      onSceneFailed();
+    }
+  });
 
   //javascript = QString("os_data.metadata.version");
   //m_view->page()->runJavaScript(javascript, [](const QVariant &v) { callWithResult(v.toString()); });
@@ -208,15 +251,29 @@ void PreviewWebView::onLoadFinished(bool ok) {
 
 void PreviewWebView::onTranslateProgress(double percentage) {
   m_progressBar->setValue(10 + 0.8 * percentage);
-  OSAppBase::instance()->processEvents(QEventLoop::ExcludeUserInputEvents, 200);
 }
 
 void PreviewWebView::onJavaScriptFinished(const QVariant& v) {
+  m_sceneTimer->stop();
   m_document->enable();
   m_progressBar->setValue(100);
   m_progressBar->setVisible(false);
 }
 
+void PreviewWebView::onSceneFailed() {
+  if (!m_sceneTimer->isActive()) {
+    // already finished or failed
+    return;
+  }
+  m_sceneTimer->stop();
+  LOG(Error, "The geometry preview page failed to load the scene");
+  m_document->enable();
+  m_progressBar->setValue(100);
+  m_progressBar->setStyleSheet("QProgressBar::chunk {background-color: #FF0000;}");
+  m_progressBar->setFormat("Error");
+  m_progressBar->setTextVisible(true);
+}
+
 void PreviewWebView::onRenderProcessTerminated(QWebEnginePage::RenderProcessTerminationStatus terminationStatus, int exitCode) {
   // qDebug() << "RenderProcessTerminationStatus: terminationStatus= " << terminationStatus << "exitCode=" << exitCode;
   m_progressBar->setValue(100);
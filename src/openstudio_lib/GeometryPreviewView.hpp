@@ -39,13 +39,17 @@
 #include <QWidget>
 #include <QWebEngineView>
 #include <QProgressBar>
+#include <QFutureWatcher>
 
 class QComboBox;
 class QPushButton;
+class QTimer;
+class QWebChannel;
 
 namespace openstudio {
 
 class OSDocument;
+class GeometryPreviewTransport;
 
 class GeometryPreviewView : public QWidget
 {
@@ -72,6 +76,10 @@ class PreviewWebView : public QWidget
  public slots:
   void onUnitSystemChange(bool t_isIP);
 
+ signals:
+  // emitted from the translation thread
+  void translateProgress(double percentage);
+
  private slots:
   void refreshClicked();
 
@@ -80,12 +88,16 @@ class PreviewWebView : public QWidget
   //void 	onLoadProgress(int progress);
   //void 	onLoadStarted();
   void onTranslateProgress(double percentage);
+  void onTranslateFinished();
   void onJavaScriptFinished(const QVariant& v);
+  void onSceneFailed();
   void onRenderProcessTerminated(QWebEnginePage::RenderProcessTerminationStatus terminationStatus, int exitCode);
 
  private:
   REGISTER_LOGGER("openstudio::PreviewWebView");
 
+  void sendScene();
+
   bool m_isIP;
   model::Model m_model;
 
@@ -96,7 +108,14 @@ class PreviewWebView : public QWidget
   OSWebEnginePage* m_page;
   std::shared_ptr<OSDocument> m_document;
 
+  QWebChannel* m_channel;
+  GeometryPreviewTransport* m_transport;
+  QFutureWatcher<QString> m_translateWatcher;
+
   QString m_json;
+
+  // re-enables the document if the page never reports the scene loaded
+  QTimer* m_sceneTimer;
 };
 
 }  // namespace openstudio
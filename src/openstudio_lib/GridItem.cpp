@@ -30,6 +30,7 @@
 #include "GridItem.hpp"
 #include "ServiceWaterGridItems.hpp"
 #include "IconLibrary.hpp"
+#include "PixmapRenderCache.hpp"
 #include "LoopScene.hpp"
 #include "SchedulesView.hpp"
 #include "OSDocument.hpp"
@@ -287,7 +288,11 @@ void ModelObjectGraphicsItem::dropEvent(QGraphicsSceneDragDropEvent* event) {
 
 // End move these to
 
-GridItem::GridItem(QGraphicsItem* parent) : ModelObjectGraphicsItem(parent), m_hLength(1), m_vLength(1) {}
+GridItem::GridItem(QGraphicsItem* parent) : ModelObjectGraphicsItem(parent), m_hLength(1), m_vLength(1) {
+  if (PixmapRenderCache::itemCachingEnabled()) {
+    setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+  }
+}
 
 QRectF GridItem::boundingRect() const {
   return QRectF(0, 0, m_hLength * 100, m_vLength * 100);
@@ -409,8 +414,7 @@ void HalfHeightOneThreeStraightItem::paint(QPainter* painter, const QStyleOption
   painter->drawLine(0, 25, 100, 25);
 
   if (modelObject()) {
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(37, 12, 25, 25, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(37, 12, 25, 25), modelObject()->iddObject().type().value());
   }
 }
 
@@ -1285,11 +1289,11 @@ void SystemCenterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*
   painter->setPen(QPen(Qt::black, 4, Qt::SolidLine, Qt::RoundCap));
   painter->drawLine(50, yOrigin, 50, yOrigin + 100);
   painter->drawLine((m_hLength - 1) * 100 + 50, yOrigin, (m_hLength - 1) * 100 + 50, yOrigin + 100);
-  painter->drawPixmap((m_hLength - 1) * 100 + 37.5, yOrigin + 25, 25, 25, QPixmap(":/images/arrow.png"));
+  PixmapRenderCache::drawPixmap(painter, QRectF((m_hLength - 1) * 100 + 37.5, yOrigin + 25, 25, 25), ":/images/arrow.png");
 
   if (m_supplyDualDuct) {
     painter->drawLine((m_hLength - 3) * 100 + 50, yOrigin, (m_hLength - 3) * 100 + 50, yOrigin + 50);
-    painter->drawPixmap((m_hLength - 3) * 100 + 37.5, yOrigin + 25, 25, 25, QPixmap(":/images/arrow.png"));
+    PixmapRenderCache::drawPixmap(painter, QRectF((m_hLength - 3) * 100 + 37.5, yOrigin + 25, 25, 25), ":/images/arrow.png");
   }
   if (m_demandDualDuct) {
     painter->drawLine((m_hLength - 3) * 100 + 50, yOrigin + 50, (m_hLength - 3) * 100 + 50, yOrigin + 100);
@@ -1299,7 +1303,7 @@ void SystemCenterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*
   painter->drawLine(0, yOrigin + 50, (m_hLength)*100, yOrigin + 50);
 
   painter->rotate(180);
-  painter->drawPixmap(-62, -(yOrigin + 75), 25, 25, QPixmap(":/images/arrow.png"));
+  PixmapRenderCache::drawPixmap(painter, QRectF(-62, -(yOrigin + 75), 25, 25), ":/images/arrow.png");
 
   painter->rotate(-180);
 
@@ -1408,8 +1412,7 @@ void OneThreeDualDuctMixerItem::paint(QPainter* painter, const QStyleOptionGraph
   painter->drawLine(100, 75, 75, 75);
 
   if (modelObject()) {
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(0, 0, 100, 100, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(0, 0, 100, 100), modelObject()->iddObject().type().value());
   }
 }
 
@@ -1428,8 +1431,7 @@ void OneThreeStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIt
   }
 
   if (modelObject()) {
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, 12, 75, 75), modelObject()->iddObject().type().value());
 
     //if(m_deleteAble)
     //{
@@ -1499,8 +1501,7 @@ void OneThreeWaterToAirItem::paint(QPainter* painter, const QStyleOptionGraphics
   }
 
   if (modelObject()) {
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, 12, 75, 75), modelObject()->iddObject().type().value());
 
     //if(m_deleteAble)
     //{
@@ -1570,8 +1571,7 @@ void OneThreeWaterToWaterItem::paint(QPainter* painter, const QStyleOptionGraphi
   }
 
   if (modelObject()) {
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, 12, 75, 75), modelObject()->iddObject().type().value());
 
     //if(m_deleteAble)
     //{
@@ -1611,8 +1611,7 @@ void TwoFourStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIte
     painter->translate(100, 0);
     painter->rotate(90);
 
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, 12, 75, 75), modelObject()->iddObject().type().value());
 
     painter->rotate(-90);
     painter->translate(-100, 0);
@@ -1650,8 +1649,7 @@ void OASupplyStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIt
     painter->translate(100, 0);
     painter->rotate(90);
 
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, 12, 75, 75), modelObject()->iddObject().type().value());
 
     painter->rotate(-90);
     painter->translate(-100, 0);
@@ -1702,8 +1700,7 @@ void OAReliefStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIt
     painter->translate(0, 100);
     painter->rotate(-90);
 
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, 12, 75, 75), modelObject()->iddObject().type().value());
 
     painter->rotate(90);
     painter->translate(0, -100);
@@ -1760,8 +1757,7 @@ void OAAirToAirItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* op
   painter->drawLine(150, 0, 150, 100);
 
   if (modelObject()) {
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(0, 0, 200, 100, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(0, 0, 200, 100), modelObject()->iddObject().type().value());
   }
 }
 
@@ -1938,8 +1934,7 @@ void FourTwoStraightItem::paint(QPainter* painter, const QStyleOptionGraphicsIte
     painter->translate(0, 100);
     painter->rotate(-90);
 
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, 12, 75, 75), modelObject()->iddObject().type().value());
 
     painter->rotate(90);
     painter->translate(0, -100);
@@ -2031,57 +2026,57 @@ void OneThreeNodeItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*
       for (auto it = _setpointManagers.begin(); it != _setpointManagers.end(); ++it) {
         if (it->controlVariable().find("Temperature") != std::string::npos) {
           if (it->iddObjectType() == SetpointManagerMixedAir::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_mixed.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_mixed.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneReheat::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_singlezone.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_singlezone.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneCooling::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_singlezone.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_singlezone.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHeating::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_singlezone.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_singlezone.png");
           } else if (it->iddObjectType() == SetpointManagerScheduled::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_scheduled.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_scheduled.png");
           } else if (it->iddObjectType() == SetpointManagerScheduledDualSetpoint::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_dual.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_dual.png");
           } else if (it->iddObjectType() == SetpointManagerWarmest::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_warmest.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_warmest.png");
           } else if (it->iddObjectType() == SetpointManagerColdest::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_coldest.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_coldest.png");
           } else if (it->iddObjectType() == SetpointManagerOutdoorAirReset::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_outdoorair.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_outdoorair.png");
           } else if (it->iddObjectType() == SetpointManagerFollowGroundTemperature::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_follow_ground_temp.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_follow_ground_temp.png");
           } else if (it->iddObjectType() == SetpointManagerFollowOutdoorAirTemperature::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_follow_outdoorair.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_follow_outdoorair.png");
           } else if (it->iddObjectType() == SetpointManagerFollowSystemNodeTemperature::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_follow_system_node.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_follow_system_node.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneCoolingAverage::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_cooling.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_multizone_cooling.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneHeatingAverage::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_heating.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_multizone_heating.png");
           } else if (it->iddObjectType() == SetpointManagerOutdoorAirPretreat::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_pretreat.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_pretreat.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneOneStageCooling::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_onestage_cooling.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_onestage_cooling.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneOneStageHeating::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_onestage_heating.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_onestage_heating.png");
           } else if (it->iddObjectType() == SetpointManagerWarmestTemperatureFlow::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_warmest_tempflow.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_warmest_tempflow.png");
           }
           break;
         } else {
           // These are the Humidty SPMs
           if (it->iddObjectType() == SetpointManagerMultiZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_humidity_max.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_multizone_humidity_max.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_humidity_min.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_multizone_humidity_min.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneMaximumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_maxhumidity_avg.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_multizone_maxhumidity_avg.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneMinimumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_multizone_minhumidity_avg.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_multizone_minhumidity_avg.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_max.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_singlezone_humidity_max.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(37, 13, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_min.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(37, 13, 25, 25), ":images/setpoint_singlezone_humidity_min.png");
           }
           break;
         }
@@ -2190,57 +2185,57 @@ void TwoFourNodeItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
       for (auto it = _setpointManagers.begin(); it != _setpointManagers.end(); ++it) {
         if (it->controlVariable().find("Temperature") != std::string::npos) {
           if (it->iddObjectType() == SetpointManagerMixedAir::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_mixed_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_mixed_right.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneReheat::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone_right.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneCooling::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone_right.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHeating::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone_right.png");
           } else if (it->iddObjectType() == SetpointManagerScheduled::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_scheduled_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_scheduled_right.png");
           } else if (it->iddObjectType() == SetpointManagerScheduledDualSetpoint::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_dual_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_dual_right.png");
           } else if (it->iddObjectType() == SetpointManagerWarmest::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_warmest_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_warmest_right.png");
           } else if (it->iddObjectType() == SetpointManagerColdest::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_coldest_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_coldest_right.png");
           } else if (it->iddObjectType() == SetpointManagerOutdoorAirReset::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_outdoorair_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_outdoorair_right.png");
           } else if (it->iddObjectType() == SetpointManagerFollowGroundTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_ground_temp_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_follow_ground_temp_right.png");
           } else if (it->iddObjectType() == SetpointManagerFollowOutdoorAirTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_outdoorair_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_follow_outdoorair_right.png");
           } else if (it->iddObjectType() == SetpointManagerFollowSystemNodeTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_system_node_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_follow_system_node_right.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneCoolingAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_cooling_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_cooling_right.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneHeatingAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_heating_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_heating_right.png");
           } else if (it->iddObjectType() == SetpointManagerOutdoorAirPretreat::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_pretreat_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_pretreat_right.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneOneStageCooling::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_onestage_cooling_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_onestage_cooling_right.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneOneStageHeating::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_onestage_heating_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_onestage_heating_right.png");
           } else if (it->iddObjectType() == SetpointManagerWarmestTemperatureFlow::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_warmest_tempflow_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_warmest_tempflow_right.png");
           }
           break;
         } else {
           // These are the humidity ones
           if (it->iddObjectType() == SetpointManagerMultiZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_humidity_max_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_humidity_max_right.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_humidity_min_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_humidity_min_right.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneMaximumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_maxhumidity_avg_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_maxhumidity_avg_right.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneMinimumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_minhumidity_avg_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_minhumidity_avg_right.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_max_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone_humidity_max_right.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_min_right.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone_humidity_min_right.png");
           }
           break;
         }
@@ -2298,57 +2293,57 @@ void OAStraightNodeItem::paint(QPainter* painter, const QStyleOptionGraphicsItem
       for (auto it = _setpointManagers.begin(); it != _setpointManagers.end(); ++it) {
         if (it->controlVariable().find("Temperature") != std::string::npos) {
           if (it->iddObjectType() == SetpointManagerMixedAir::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_mixed.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_mixed.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneReheat::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneCooling::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHeating::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone.png");
           } else if (it->iddObjectType() == SetpointManagerScheduled::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_scheduled.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_scheduled.png");
           } else if (it->iddObjectType() == SetpointManagerScheduledDualSetpoint::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_dual.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_dual.png");
           } else if (it->iddObjectType() == SetpointManagerWarmest::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_warmest.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_warmest.png");
           } else if (it->iddObjectType() == SetpointManagerColdest::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_coldest.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_coldest.png");
           } else if (it->iddObjectType() == SetpointManagerOutdoorAirReset::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_outdoorair.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_outdoorair.png");
           } else if (it->iddObjectType() == SetpointManagerFollowGroundTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_ground_temp.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_follow_ground_temp.png");
           } else if (it->iddObjectType() == SetpointManagerFollowOutdoorAirTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_outdoorair.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_follow_outdoorair.png");
           } else if (it->iddObjectType() == SetpointManagerFollowSystemNodeTemperature::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_follow_system_node.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_follow_system_node.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneCoolingAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_cooling.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_cooling.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneHeatingAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_heating.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_heating.png");
           } else if (it->iddObjectType() == SetpointManagerOutdoorAirPretreat::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_pretreat.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_pretreat.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneOneStageCooling::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_onestage_cooling.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_onestage_cooling.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneOneStageHeating::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_onestage_heating.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_onestage_heating.png");
           } else if (it->iddObjectType() == SetpointManagerWarmestTemperatureFlow::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_warmest_tempflow.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_warmest_tempflow.png");
           }
           break;
         } else {
           // These are the humidity ones
           if (it->iddObjectType() == SetpointManagerMultiZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_humidity_max.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_humidity_max.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_humidity_min.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_humidity_min.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneMaximumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_maxhumidity_avg.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_maxhumidity_avg.png");
           } else if (it->iddObjectType() == SetpointManagerMultiZoneMinimumHumidityAverage::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_multizone_minhumidity_avg.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_multizone_minhumidity_avg.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHumidityMaximum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_max.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone_humidity_max.png");
           } else if (it->iddObjectType() == SetpointManagerSingleZoneHumidityMinimum::iddObjectType()) {
-            painter->drawPixmap(62, 37, 25, 25, QPixmap(":images/setpoint_singlezone_humidity_min.png"));
+            PixmapRenderCache::drawPixmap(painter, QRectF(62, 37, 25, 25), ":images/setpoint_singlezone_humidity_min.png");
           }
           break;
         }
@@ -2374,8 +2369,7 @@ void OAMixerItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
   painter->drawLine(150, 50, 150, 0);
 
   if (modelObject()) {
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(0, 0, 200, 100, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(0, 0, 200, 100), modelObject()->iddObject().type().value());
   }
 }
 
@@ -2434,8 +2428,7 @@ void SplitterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
   int midpointIndex;
   if (m_numberBranches == 1) {
     midpointIndex = 0;
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, (midpointIndex * 100) + 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, (midpointIndex * 100) + 12, 75, 75), modelObject()->iddObject().type().value());
   } else {
     midpointIndex = m_numberBranches - 1;
   }
@@ -2570,8 +2563,7 @@ void SupplySplitterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem
     }
     painter->drawLine(50, m_baselineBranchPositions.front() * 100 + 50, 50, m_baselineBranchPositions.back() * 100 + 50);
   } else {
-    QPixmap qPixmap(":images/supply_splitter.png");
-    painter->drawPixmap(12, 12, 75, 75, qPixmap);
+    PixmapRenderCache::drawPixmap(painter, QRectF(12, 12, 75, 75), ":images/supply_splitter.png");
   }
   painter->drawLine(0, (midpointIndex * 100) + 50, 50, (midpointIndex * 100) + 50);
 }
@@ -2626,8 +2618,7 @@ void MixerItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
   int midpointIndex;
   if (m_numberBranches == 1) {
     midpointIndex = 0;
-    const QPixmap* qPixmap = IconLibrary::Instance().findIcon(modelObject()->iddObject().type().value());
-    painter->drawPixmap(12, (midpointIndex * 100) + 12, 75, 75, *qPixmap);
+    PixmapRenderCache::drawIcon(painter, QRectF(12, (midpointIndex * 100) + 12, 75, 75), modelObject()->iddObject().type().value());
   } else {
     midpointIndex = m_numberBranches - 1;
   }
@@ -2663,8 +2654,7 @@ void SupplyMixerItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
   int midpointIndex;
   if (m_numberBranches == 1) {
     midpointIndex = 0;
-    QPixmap qPixmap(":/images/supply_mixer.png");
-    painter->drawPixmap(12, (midpointIndex * 100) + 12, 75, 75, qPixmap);
+    PixmapRenderCache::drawPixmap(painter, QRectF(12, (midpointIndex * 100) + 12, 75, 75), ":/images/supply_mixer.png");
   } else {
     midpointIndex = m_numberBranches - 1;
   }
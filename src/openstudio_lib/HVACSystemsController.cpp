@@ -46,6 +46,7 @@
 #include "MainRightColumnController.hpp"
 #include "../shared_gui_components/OSViewSwitcher.hpp"
 #include <openstudio/model/ModelObject.hpp>
+#include <openstudio/model/ModelObject_Impl.hpp>
 #include <openstudio/model/HVACComponent.hpp>
 #include <openstudio/model/HVACComponent_Impl.hpp>
 #include <openstudio/model/WaterToAirComponent.hpp>
@@ -66,6 +67,8 @@
 #include <openstudio/model/AvailabilityManager_Impl.hpp>
 #include <openstudio/model/AvailabilityManagerAssignmentList.hpp>
 #include <openstudio/model/AvailabilityManagerAssignmentList_Impl.hpp>
+#include <openstudio/model/AvailabilityManagerNightCycle.hpp>
+#include <openstudio/model/AvailabilityManagerNightCycle_Impl.hpp>
 
 #include <openstudio/model/ChillerElectricEIR.hpp>
 #include <openstudio/model/BoilerHotWater.hpp>
@@ -134,6 +137,9 @@
 #include <QLayout>
 #include <QMutex>
 
+#include <unordered_map>
+#include <unordered_set>
+
 // Switch log Level in one go
 #define LOGLEVEL Trace
 
@@ -176,24 +182,22 @@ HVACSystemsController::HVACSystemsController(bool isIP, const model::Model& mode
   auto airloops = m_model.getModelObjects<model::AirLoopHVAC>();
   std::sort(airloops.begin(), airloops.end(), WorkspaceObjectNameLess());
   for (auto it = airloops.begin(); it != airloops.end(); ++it) {
-    // Trigger a full refresh if the airLoop name changes
+    // Move the airLoop to its sorted row if its name changes
     LOG(LOGLEVEL, "HVACSystemsController Ctor: Attaching name change for AirLoopHVAC " << it->nameString());
-    it->getImpl<detail::IdfObject_Impl>()
-      .get()
-      ->detail::IdfObject_Impl::onNameChange.connect<HVACSystemsController, &HVACSystemsController::repopulateSystemComboBox>(this);
+    connectSystemNameChange(*it);
   }
 
   auto plantloops = m_model.getModelObjects<model::PlantLoop>();
   std::sort(plantloops.begin(), plantloops.end(), WorkspaceObjectNameLess());
   for (auto it = plantloops.begin(); it != plantloops.end(); ++it) {
     LOG(LOGLEVEL, "HVACSystemsController Ctor: Attaching name change for PlantLoop " << it->nameString());
-    it->getImpl<detail::IdfObject_Impl>()
-      .get()
-      ->detail::IdfObject_Impl::onNameChange.connect<HVACSystemsController, &HVACSystemsController::repopulateSystemComboBox>(this);
+    connectSystemNameChange(*it);
   }
 
   m_updateMutex = new QMutex();
 
+  repopulateSystemComboBox();
+
   updateLater();
 }
 
@@ -225,41 +229,55 @@ model::Model HVACSystemsController::model() const {
   return m_model;
 }
 
+unsigned HVACSystemsController::systemRowChangeCount() const {
+  return m_systemRowChangeCount;
+}
+
 void HVACSystemsController::repopulateSystemComboBox() {
 
   LOG(LOGLEVEL, "repopulateSystemComboBox() called");
 
   QComboBox* systemComboBox = m_hvacSystemsView->hvacToolbarView->systemComboBox;
-  bool signalsAlreadyBlocked = systemComboBox->signalsBlocked();
 
-  // If not already blocked, we do it
-  if (!signalsAlreadyBlocked) {
-    // we want to avoid onSystemComboBoxIndexChanged that triggers setCurrentHandle With triggers update
-    // which will retrigger this very function...
-    systemComboBox->blockSignals(true);
-  }
+  // we want to avoid onSystemComboBoxIndexChanged that triggers setCurrentHandle With triggers update
+  bool signalsAlreadyBlocked = systemComboBox->blockSignals(true);
 
   // Repopulate
   systemComboBox->clear();
+  m_systemRows.clear();
 
   // Populate system combo box
   auto airloops = m_model.getModelObjects<model::AirLoopHVAC>();
   std::sort(airloops.begin(), airloops.end(), WorkspaceObjectNameLess());
   for (auto it = airloops.begin(); it != airloops.end(); ++it) {
+    m_systemRows[it->handle()] = systemComboBox->count();
     systemComboBox->addItem(QString::fromStdString(it->name().get()), toQString(it->handle()));
   }
+  m_airLoopRowCount = static_cast<int>(airloops.size());
 
   auto plantloops = m_model.getModelObjects<model::PlantLoop>();
   std::sort(plantloops.begin(), plantloops.end(), WorkspaceObjectNameLess());
   for (auto it = plantloops.begin(); it != plantloops.end(); ++it) {
+    m_systemRows[it->handle()] = systemComboBox->count();
     systemComboBox->addItem(QString::fromStdString(it->name().get()), toQString(it->handle()));
   }
+  m_plantLoopRowCount = static_cast<int>(plantloops.size());
+  m_systemRowChangeCount += static_cast<unsigned>(airloops.size() + plantloops.size());
 
   // TODO: When addressing issue #961 - HVAC Toolbar review, that's where you start
   systemComboBox->addItem("Service Hot Water", SHW);
   systemComboBox->addItem("Refrigeration", REFRIGERATION);
   systemComboBox->addItem("VRF", VRF);
 
+  setSystemComboBoxCurrentIndex();
+
+  // Don't forget to renable both the combobox AND the HVACSystemsController!
+  systemComboBox->blockSignals(signalsAlreadyBlocked);
+}
+
+void HVACSystemsController::setSystemComboBoxCurrentIndex() {
+  QComboBox* systemComboBox = m_hvacSystemsView->hvacToolbarView->systemComboBox;
+
   // Set system combo box current index
   QString handle = currentHandle();
   if (handle == SHW || m_model.getModelObject<model::WaterUseConnections>(toUUID(handle))) {
@@ -281,20 +299,117 @@ void HVACSystemsController::repopulateSystemComboBox() {
 
     systemComboBox->setCurrentIndex(index);
   } else {
-    int index = systemComboBox->findData(handle);
+    auto it = m_systemRows.find(toUUID(handle));
 
-    if (index >= 0) {
-      systemComboBox->setCurrentIndex(index);
+    if (it != m_systemRows.end()) {
+      systemComboBox->setCurrentIndex(it->second);
     } else {
       systemComboBox->setCurrentIndex(systemComboBox->findData(SHW));
     }
   }
+}
 
-  // Release if needed
-  if (!signalsAlreadyBlocked) {
-    // Don't forget to renable both the combobox AND the HVACSystemsController!
-    systemComboBox->blockSignals(false);
+void HVACSystemsController::insertSystemRow(const model::Loop& loop) {
+  if (m_systemRows.find(loop.handle()) != m_systemRows.end()) {
+    return;
   }
+
+  QComboBox* systemComboBox = m_hvacSystemsView->hvacToolbarView->systemComboBox;
+
+  bool isAirLoop = (loop.iddObjectType() == model::AirLoopHVAC::iddObjectType());
+  int first = isAirLoop ? 0 : m_airLoopRowCount;
+  int last = isAirLoop ? m_airLoopRowCount : m_airLoopRowCount + m_plantLoopRowCount;
+
+  // Rows of each block are sorted by name, binary search the insertion row
+  std::string name = loop.nameString();
+  while (first < last) {
+    int mid = first + (last - first) / 2;
+    if (istringLess(toString(systemComboBox->itemText(mid)), name)) {
+      first = mid + 1;
+    } else {
+      last = mid;
+    }
+  }
+
+  bool signalsAlreadyBlocked = systemComboBox->blockSignals(true);
+  systemComboBox->insertItem(first, QString::fromStdString(name), toQString(loop.handle()));
+  systemComboBox->blockSignals(signalsAlreadyBlocked);
+  ++m_systemRowChangeCount;
+
+  if (isAirLoop) {
+    ++m_airLoopRowCount;
+  } else {
+    ++m_plantLoopRowCount;
+  }
+
+  reindexSystemRows(first);
+}
+
+void HVACSystemsController::removeSystemRow(const Handle& handle) {
+  auto it = m_systemRows.find(handle);
+  if (it == m_systemRows.end()) {
+    return;
+  }
+
+  int row = it->second;
+  m_systemRows.erase(it);
+
+  QComboBox* systemComboBox = m_hvacSystemsView->hvacToolbarView->systemComboBox;
+  bool signalsAlreadyBlocked = systemComboBox->blockSignals(true);
+  systemComboBox->removeItem(row);
+  systemComboBox->blockSignals(signalsAlreadyBlocked);
+  ++m_systemRowChangeCount;
+
+  if (row < m_airLoopRowCount) {
+    --m_airLoopRowCount;
+  } else {
+    --m_plantLoopRowCount;
+  }
+
+  reindexSystemRows(row);
+}
+
+void HVACSystemsController::reindexSystemRows(int row) {
+  QComboBox* systemComboBox = m_hvacSystemsView->hvacToolbarView->systemComboBox;
+
+  int loopRowCount = m_airLoopRowCount + m_plantLoopRowCount;
+  for (int i = row; i < loopRowCount; ++i) {
+    m_systemRows[toUUID(systemComboBox->itemData(i).toString())] = i;
+  }
+}
+
+void HVACSystemsController::connectSystemNameChange(const model::Loop& loop) {
+  std::unique_ptr<SystemNameObserver>& observer = m_systemNameObservers[loop.handle()];
+  if (!observer) {
+    observer = std::make_unique<SystemNameObserver>(this, loop.handle());
+    loop.getImpl<detail::IdfObject_Impl>()
+      .get()
+      ->detail::IdfObject_Impl::onNameChange.connect<SystemNameObserver, &SystemNameObserver::onNameChange>(observer.get());
+  }
+}
+
+void HVACSystemsController::onSystemNameChanged(const Handle& handle) {
+  auto it = m_systemRows.find(handle);
+  if (it == m_systemRows.end()) {
+    return;
+  }
+
+  QComboBox* systemComboBox = m_hvacSystemsView->hvacToolbarView->systemComboBox;
+
+  auto loop = m_model.getModelObject<model::Loop>(handle);
+  if (!loop || systemComboBox->itemText(it->second) == QString::fromStdString(loop->nameString())) {
+    return;
+  }
+
+  LOG(LOGLEVEL, "onSystemNameChanged: moving renamed loop " << loop->nameString());
+
+  QVariant currentData = systemComboBox->currentData();
+  removeSystemRow(handle);
+  insertSystemRow(loop.get());
+
+  bool signalsAlreadyBlocked = systemComboBox->blockSignals(true);
+  systemComboBox->setCurrentIndex(systemComboBox->findData(currentData));
+  systemComboBox->blockSignals(signalsAlreadyBlocked);
 }
 
 void HVACSystemsController::update() {
@@ -313,8 +428,8 @@ void HVACSystemsController::update() {
     LOG(LOGLEVEL, "update() called");
     systemComboBox->blockSignals(true);
 
-    // Repopulate
-    repopulateSystemComboBox();
+    // Rows are kept in sync by onObjectAdded / onObjectRemoved / onSystemNameChanged, only the selection can be stale
+    setSystemComboBoxCurrentIndex();
 
     // Show layout
     QString handle = currentHandle();
@@ -460,40 +575,43 @@ std::shared_ptr<HVACControlsController> HVACSystemsController::hvacControlsContr
   return m_hvacControlsController;
 }
 
-std::vector<IddObjectType> HVACSystemsController::systemComboBoxTypes() const {
-  std::vector<IddObjectType> types;
+bool HVACSystemsController::isSystemComboBoxType(const IddObjectType& type) {
+  static const std::unordered_set<int> types{model::AirLoopHVAC::iddObjectType().value(), model::PlantLoop::iddObjectType().value()};
 
-  types.push_back(model::AirLoopHVAC::iddObjectType());
-  types.push_back(model::PlantLoop::iddObjectType());
-
-  return types;
+  return types.count(type.value()) != 0;
 }
 
 void HVACSystemsController::onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type,
                                           const openstudio::UUID& uuid) {
-  std::vector<IddObjectType> types = systemComboBoxTypes();
-
-  auto newObjectIddType = workspaceObject.cast<model::ModelObject>().iddObjectType();
-  if (std::find(types.begin(), types.end(), newObjectIddType) != types.end()) {
-    updateLater();
+  // Most added objects are components, not systems, and don't affect the system combo box
+  if (!isSystemComboBoxType(type)) {
+    return;
   }
 
-  // If it's a Loop, we trigger a repopulation of the System Combobox upon name change
-  if ((newObjectIddType == model::PlantLoop::iddObjectType()) || (newObjectIddType == model::AirLoopHVAC::iddObjectType())) {
-    LOG(LOGLEVEL, "onObjectAdded: Attaching name change for " << workspaceObject.briefDescription());
-    workspaceObject.getImpl<detail::IdfObject_Impl>()
-      .get()
-      ->detail::IdfObject_Impl::onNameChange.connect<HVACSystemsController, &HVACSystemsController::repopulateSystemComboBox>(this);
+  auto loop = workspaceObject.optionalCast<model::Loop>();
+  if (!loop) {
+    return;
   }
+
+  insertSystemRow(loop.get());
+
+  // If it's a Loop, we move its row in the System Combobox upon name change
+  LOG(LOGLEVEL, "onObjectAdded: Attaching name change for " << workspaceObject.briefDescription());
+  connectSystemNameChange(loop.get());
+
+  updateLater();
 }
 
 void HVACSystemsController::onObjectRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type,
                                             const openstudio::UUID& uuid) {
-  std::vector<IddObjectType> types = systemComboBoxTypes();
-
-  if (std::find(types.begin(), types.end(), workspaceObject.cast<model::ModelObject>().iddObjectType()) != types.end()) {
-    updateLater();
+  if (!isSystemComboBoxType(type)) {
+    return;
   }
+
+  removeSystemRow(uuid);
+  m_systemNameObservers.erase(uuid);
+
+  updateLater();
 }
 
 void HVACSystemsController::onObjectChanged() {}
@@ -916,6 +1034,16 @@ HVACControlsController::HVACControlsController(HVACSystemsController* hvacSystem
     m_hvacPlantLoopControlsView(new HVACPlantLoopControlsView()),
     m_noControlsView(new NoControlsView()),
     m_hvacSystemsController(hvacSystemsController) {
+  model::Model t_model = m_hvacSystemsController->model();
+
+  t_model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.connect<HVACControlsController, &HVACControlsController::onObjectAdded>(this);
+
+  t_model.getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObject.connect<HVACControlsController, &HVACControlsController::onObjectRemoved>(
+    this);
+
+  connect(m_hvacAirLoopControlsView->nightCycleComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
+          &HVACControlsController::onNightCycleComboBoxIndexChanged);
+
   updateLater();
 }
 
@@ -990,434 +1118,549 @@ NoControlsView* HVACControlsController::noControlsView() const {
   return m_noControlsView;
 }
 
+template <void (HVACControlsController::*Slot)()>
+void HVACControlsController::watchObject(Section section, const model::ModelObject& modelObject) {
+  modelObject.getImpl<model::detail::ModelObject_Impl>().get()->onChange.connect<HVACControlsController, Slot>(this);
+
+  m_watchedObjects[section].push_back(modelObject);
+}
+
+template <void (HVACControlsController::*Slot)()>
+void HVACControlsController::unwatchObjects(Section section) {
+  for (const auto& modelObject : m_watchedObjects[section]) {
+    modelObject.getImpl<model::detail::ModelObject_Impl>().get()->onChange.disconnect<HVACControlsController, Slot>(this);
+  }
+
+  m_watchedObjects[section].clear();
+}
+
 void HVACControlsController::update() {
-  if (m_dirty) {
+  if (m_dirtySections == 0) {
+    return;
+  }
 
-    // If we're looking at an AirLoopHVAC
-    if (boost::optional<model::AirLoopHVAC> t_airLoopHVAC = airLoopHVAC()) {
+  // A different loop is displayed, every section has to be bound again
+  boost::optional<model::Loop> loop = m_hvacSystemsController->currentLoop();
+  if ((loop.is_initialized() != m_loop.is_initialized()) || (loop && loop->handle() != m_loop->handle())) {
+    if (m_loop) {
+      m_loop->getImpl<detail::IdfObject_Impl>()
+        .get()
+        ->detail::IdfObject_Impl::onNameChange.disconnect<HVACControlsController, &HVACControlsController::onLoopNameChanged>(this);
+    }
 
-      m_hvacAirLoopControlsView->setUpdatesEnabled(false);
+    m_loop = loop;
+    m_dirtySections = AllSections;
 
-      if (m_mechanicalVentilationView) {
-        delete m_mechanicalVentilationView;
-      }
-      if (m_singleZoneReheatSPMView) {
-        delete m_singleZoneReheatSPMView;
-      }
-      if (m_noSupplyAirTempControlView) {
-        delete m_noSupplyAirTempControlView;
-      }
-      if (m_noMechanicalVentilationView) {
-        delete m_noMechanicalVentilationView;
-      }
-      if (m_systemAvailabilityDropZone) {
-        delete m_systemAvailabilityDropZone;
-      }
-      if (m_supplyAirTempScheduleDropZone) {
-        delete m_supplyAirTempScheduleDropZone;
-      }
-      if (m_availabilityManagerDropZone) {
-        delete m_availabilityManagerDropZone;
-      }
-      if (m_followOATempSPMView) {
-        delete m_followOATempSPMView;
-      }
-      if (m_oaResetSPMView) {
-        delete m_oaResetSPMView;
-      }
-      if (m_scheduledSPMView) {
-        delete m_scheduledSPMView;
-      }
-      if (m_airLoopHVACUnitaryHeatPumpAirToAirControlView) {
-        delete m_airLoopHVACUnitaryHeatPumpAirToAirControlView;
-      }
+    if (m_loop) {
+      m_loop->getImpl<detail::IdfObject_Impl>()
+        .get()
+        ->detail::IdfObject_Impl::onNameChange.connect<HVACControlsController, &HVACControlsController::onLoopNameChanged>(this);
+    }
+  }
 
-      m_hvacAirLoopControlsView->nightCycleComboBox->setEnabled(false);
+  unsigned sections = m_dirtySections;
+  m_dirtySections = 0;
 
-      QString title;
-      title.append(QString::fromStdString(t_airLoopHVAC->name().get()));
-      m_hvacAirLoopControlsView->systemNameLabel->setText(title);
+  // If we're looking at an AirLoopHVAC
+  if (boost::optional<model::AirLoopHVAC> t_airLoopHVAC = airLoopHVAC()) {
 
-      // Cooling Type
+    m_hvacAirLoopControlsView->setUpdatesEnabled(false);
 
-      m_hvacAirLoopControlsView->coolingTypeLabel->setText("Unclassified Cooling Type");
+    if (sections & NameSection) {
+      refreshAirLoopName(t_airLoopHVAC.get());
+    }
+    if (sections & CoolingHeatingTypeSection) {
+      refreshCoolingHeatingType(t_airLoopHVAC.get());
+    }
+    if (sections & HVACOperationSection) {
+      refreshHVACOperation(t_airLoopHVAC.get());
+    }
+    if (sections & NightCycleSection) {
+      refreshNightCycle(t_airLoopHVAC.get());
+    }
+    if (sections & VentilationSection) {
+      refreshVentilation(t_airLoopHVAC.get());
+    }
+    if (sections & SupplyAirTemperatureSection) {
+      refreshSupplyAirTemperature(t_airLoopHVAC.get());
+    }
+    if (sections & AvailabilityManagerSection) {
+      refreshAvailabilityManagers(t_airLoopHVAC.get());
+    }
 
-      std::vector<model::ModelObject> modelObjects = t_airLoopHVAC->supplyComponents(model::CoilCoolingDXSingleSpeed::iddObjectType());
-      if (modelObjects.size() > 0) {
-        m_hvacAirLoopControlsView->coolingTypeLabel->setText("DX Cooling");
-      }
+    m_hvacAirLoopControlsView->setUpdatesEnabled(true);
 
-      modelObjects = t_airLoopHVAC->supplyComponents(model::CoilCoolingDXTwoSpeed::iddObjectType());
-      if (modelObjects.size() > 0) {
-        m_hvacAirLoopControlsView->coolingTypeLabel->setText("DX Cooling");
-      }
+  }
 
-      modelObjects = t_airLoopHVAC->supplyComponents(model::CoilCoolingWater::iddObjectType());
-      if (modelObjects.size() > 0) {
-        m_hvacAirLoopControlsView->coolingTypeLabel->setText("Chilled Water");
-      }
+  // Else if a plantLoop
+  else if (boost::optional<model::PlantLoop> t_plantLoop = plantLoop()) {
 
-      modelObjects = t_airLoopHVAC->supplyComponents(model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType());
-      if (modelObjects.size() > 0) {
-        m_hvacAirLoopControlsView->coolingTypeLabel->setText("DX Cooling");
-      }
+    m_hvacPlantLoopControlsView->setUpdatesEnabled(false);
 
-      // Heating Type
+    if (m_systemAvailabilityDropZone) {
+      delete m_systemAvailabilityDropZone;
+    }
 
-      m_hvacAirLoopControlsView->heatingTypeLabel->setText("Unclassified Heating Type");
+    if (sections & NameSection) {
+      refreshPlantLoopName(t_plantLoop.get());
+    }
+    if (sections & PlantComponentsSection) {
+      refreshPlantComponents(t_plantLoop.get());
+    }
+    if (sections & AvailabilityManagerSection) {
+      refreshAvailabilityManagers(t_plantLoop.get());
+    }
 
-      modelObjects = t_airLoopHVAC->supplyComponents(model::CoilHeatingGas::iddObjectType());
-      if (modelObjects.size() > 0) {
-        m_hvacAirLoopControlsView->heatingTypeLabel->setText("Gas Heating");
-      }
+    m_hvacPlantLoopControlsView->setUpdatesEnabled(true);
+  }
+}
 
-      modelObjects = t_airLoopHVAC->supplyComponents(model::CoilHeatingElectric::iddObjectType());
-      if (modelObjects.size() > 0) {
-        m_hvacAirLoopControlsView->heatingTypeLabel->setText("Electric Heating");
-      }
+void HVACControlsController::refreshAirLoopName(const model::AirLoopHVAC& airLoopHVAC) {
+  ++m_sectionRefreshCounts[NameSection];
 
-      modelObjects = t_airLoopHVAC->supplyComponents(model::CoilHeatingWater::iddObjectType());
-      if (modelObjects.size() > 0) {
-        m_hvacAirLoopControlsView->heatingTypeLabel->setText("Hot Water");
-      }
+  m_hvacAirLoopControlsView->systemNameLabel->setText(QString::fromStdString(airLoopHVAC.nameString()));
+}
 
-      modelObjects = t_airLoopHVAC->supplyComponents(model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType());
-      if (modelObjects.size() > 0) {
-        m_hvacAirLoopControlsView->heatingTypeLabel->setText("Air Source Heat Pump");
-      }
+void HVACControlsController::refreshCoolingHeatingType(const model::AirLoopHVAC& airLoopHVAC) {
+  ++m_sectionRefreshCounts[CoolingHeatingTypeSection];
 
-      // HVAC Operation Schedule
+  // Cooling Type
 
-      auto systemAvailabilityVectorController = new SystemAvailabilityVectorController();
-      systemAvailabilityVectorController->attach(t_airLoopHVAC.get());
-      m_systemAvailabilityDropZone = new OSDropZone(systemAvailabilityVectorController);
-      m_systemAvailabilityDropZone->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-      m_systemAvailabilityDropZone->setMinItems(1);
-      m_systemAvailabilityDropZone->setMaxItems(1);
-      m_systemAvailabilityDropZone->setItemsRemoveable(false);
-      m_systemAvailabilityDropZone->setAcceptDrops(true);
-      m_systemAvailabilityDropZone->setItemsAcceptDrops(true);
-      m_systemAvailabilityDropZone->setEnabled(true);
-      m_hvacAirLoopControlsView->hvacOperationViewSwitcher->setView(m_systemAvailabilityDropZone);
+  m_hvacAirLoopControlsView->coolingTypeLabel->setText("Unclassified Cooling Type");
 
-      // Allow clicking on the Schedule to see it in the right column inspector
-      connect(m_systemAvailabilityDropZone.data(), &OSDropZone::itemClicked, systemAvailabilityVectorController,
-              &SystemAvailabilityVectorController::onDropZoneItemClicked);
+  std::vector<model::ModelObject> modelObjects = airLoopHVAC.supplyComponents(model::CoilCoolingDXSingleSpeed::iddObjectType());
+  if (modelObjects.size() > 0) {
+    m_hvacAirLoopControlsView->coolingTypeLabel->setText("DX Cooling");
+  }
 
-      // Night Cycle Control
+  modelObjects = airLoopHVAC.supplyComponents(model::CoilCoolingDXTwoSpeed::iddObjectType());
+  if (modelObjects.size() > 0) {
+    m_hvacAirLoopControlsView->coolingTypeLabel->setText("DX Cooling");
+  }
 
-      m_hvacAirLoopControlsView->nightCycleComboBox->setEnabled(true);
+  modelObjects = airLoopHVAC.supplyComponents(model::CoilCoolingWater::iddObjectType());
+  if (modelObjects.size() > 0) {
+    m_hvacAirLoopControlsView->coolingTypeLabel->setText("Chilled Water");
+  }
 
-      std::string nightCycleControlType = t_airLoopHVAC->nightCycleControlType();
+  modelObjects = airLoopHVAC.supplyComponents(model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType());
+  if (modelObjects.size() > 0) {
+    m_hvacAirLoopControlsView->coolingTypeLabel->setText("DX Cooling");
+  }
 
-      int nightCycleSelectorIndex = m_hvacAirLoopControlsView->nightCycleComboBox->findData(QString::fromStdString(nightCycleControlType));
+  // Heating Type
 
-      m_hvacAirLoopControlsView->nightCycleComboBox->setCurrentIndex(nightCycleSelectorIndex);
+  m_hvacAirLoopControlsView->heatingTypeLabel->setText("Unclassified Heating Type");
 
-      connect(m_hvacAirLoopControlsView->nightCycleComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
-              &HVACControlsController::onNightCycleComboBoxIndexChanged);
+  modelObjects = airLoopHVAC.supplyComponents(model::CoilHeatingGas::iddObjectType());
+  if (modelObjects.size() > 0) {
+    m_hvacAirLoopControlsView->heatingTypeLabel->setText("Gas Heating");
+  }
 
-      // Mechanical Ventilation
+  modelObjects = airLoopHVAC.supplyComponents(model::CoilHeatingElectric::iddObjectType());
+  if (modelObjects.size() > 0) {
+    m_hvacAirLoopControlsView->heatingTypeLabel->setText("Electric Heating");
+  }
 
-      if (boost::optional<model::AirLoopHVACOutdoorAirSystem> oaSystem = t_airLoopHVAC->airLoopHVACOutdoorAirSystem()) {
-        model::ControllerOutdoorAir controllerOutdoorAir = oaSystem->getControllerOutdoorAir();
+  modelObjects = airLoopHVAC.supplyComponents(model::CoilHeatingWater::iddObjectType());
+  if (modelObjects.size() > 0) {
+    m_hvacAirLoopControlsView->heatingTypeLabel->setText("Hot Water");
+  }
 
-        model::ControllerMechanicalVentilation controllerMechanicalVentilation = controllerOutdoorAir.controllerMechanicalVentilation();
+  modelObjects = airLoopHVAC.supplyComponents(model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType());
+  if (modelObjects.size() > 0) {
+    m_hvacAirLoopControlsView->heatingTypeLabel->setText("Air Source Heat Pump");
+  }
+}
 
-        m_mechanicalVentilationView = new MechanicalVentilationView();
+void HVACControlsController::refreshHVACOperation(const model::AirLoopHVAC& airLoopHVAC) {
+  ++m_sectionRefreshCounts[HVACOperationSection];
 
-        m_hvacAirLoopControlsView->ventilationViewSwitcher->setView(m_mechanicalVentilationView);
+  if (m_systemAvailabilityDropZone) {
+    delete m_systemAvailabilityDropZone;
+  }
 
-        // Economizer Control Type
+  // HVAC Operation Schedule, the vector controller keeps the drop zone in sync afterwards
 
-        connect(m_mechanicalVentilationView->economizerComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
-                &HVACControlsController::onEconomizerComboBoxIndexChanged);
+  auto systemAvailabilityVectorController = new SystemAvailabilityVectorController();
+  systemAvailabilityVectorController->attach(airLoopHVAC);
+  m_systemAvailabilityDropZone = new OSDropZone(systemAvailabilityVectorController);
+  m_systemAvailabilityDropZone->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+  m_systemAvailabilityDropZone->setMinItems(1);
+  m_systemAvailabilityDropZone->setMaxItems(1);
+  m_systemAvailabilityDropZone->setItemsRemoveable(false);
+  m_systemAvailabilityDropZone->setAcceptDrops(true);
+  m_systemAvailabilityDropZone->setItemsAcceptDrops(true);
+  m_systemAvailabilityDropZone->setEnabled(true);
+  m_hvacAirLoopControlsView->hvacOperationViewSwitcher->setView(m_systemAvailabilityDropZone);
 
-        std::string economizerControlType = controllerOutdoorAir.getEconomizerControlType();
+  // Allow clicking on the Schedule to see it in the right column inspector
+  connect(m_systemAvailabilityDropZone.data(), &OSDropZone::itemClicked, systemAvailabilityVectorController,
+          &SystemAvailabilityVectorController::onDropZoneItemClicked);
+}
 
-        int economizerIndex = m_mechanicalVentilationView->economizerComboBox->findData(QString::fromStdString(economizerControlType));
+void HVACControlsController::refreshNightCycle(const model::AirLoopHVAC& airLoopHVAC) {
+  ++m_sectionRefreshCounts[NightCycleSection];
 
-        m_mechanicalVentilationView->economizerComboBox->setCurrentIndex(economizerIndex);
+  // The night cycle control type is stored on the AvailabilityManagerNightCycle of the loop
+  unwatchObjects<&HVACControlsController::onNightCycleChanged>(NightCycleSection);
+  for (const auto& availabilityManager : airLoopHVAC.availabilityManagers()) {
+    if (availabilityManager.iddObjectType() == model::AvailabilityManagerNightCycle::iddObjectType()) {
+      watchObject<&HVACControlsController::onNightCycleChanged>(NightCycleSection, availabilityManager);
+    }
+  }
 
-        // Ventilation Calculation Method
+  std::string nightCycleControlType = airLoopHVAC.nightCycleControlType();
 
-        connect(m_mechanicalVentilationView->ventilationCalcMethodComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
-                this, &HVACControlsController::onVentilationCalcMethodComboBoxIndexChanged);
+  int nightCycleSelectorIndex = m_hvacAirLoopControlsView->nightCycleComboBox->findData(QString::fromStdString(nightCycleControlType));
 
-        std::string ventilationMethod = controllerMechanicalVentilation.systemOutdoorAirMethod();
+  bool signalsAlreadyBlocked = m_hvacAirLoopControlsView->nightCycleComboBox->blockSignals(true);
+  m_hvacAirLoopControlsView->nightCycleComboBox->setCurrentIndex(nightCycleSelectorIndex);
+  m_hvacAirLoopControlsView->nightCycleComboBox->blockSignals(signalsAlreadyBlocked);
 
-        int ventilationMethodIndex = m_mechanicalVentilationView->ventilationCalcMethodComboBox->findData(QString::fromStdString(ventilationMethod));
+  m_hvacAirLoopControlsView->nightCycleComboBox->setEnabled(true);
+}
 
-        m_mechanicalVentilationView->ventilationCalcMethodComboBox->setCurrentIndex(ventilationMethodIndex);
+void HVACControlsController::refreshVentilation(const model::AirLoopHVAC& airLoopHVAC) {
+  ++m_sectionRefreshCounts[VentilationSection];
 
-        // Demand Controlled Ventilation
+  boost::optional<model::AirLoopHVACOutdoorAirSystem> oaSystem = airLoopHVAC.airLoopHVACOutdoorAirSystem();
 
-        // m_mechanicalVentilationView->dcvButton->bind(controllerMechanicalVentilation,"demandControlledVentilation");
-        m_mechanicalVentilationView->dcvButton->bind(
-          controllerMechanicalVentilation,
-          std::bind(&model::ControllerMechanicalVentilation::demandControlledVentilation, controllerMechanicalVentilation),
-          boost::optional<BoolSetter>(std::bind(&model::ControllerMechanicalVentilation::setDemandControlledVentilationNoFail,
-                                                controllerMechanicalVentilation, std::placeholders::_1)),
-          boost::optional<NoFailAction>(
-            std::bind(&model::ControllerMechanicalVentilation::resetDemandControlledVentilation, controllerMechanicalVentilation)),
-          boost::optional<BasicQuery>(
-            std::bind(&model::ControllerMechanicalVentilation::isDemandControlledVentilationDefaulted, controllerMechanicalVentilation)));
-      } else {
-        m_noMechanicalVentilationView = new NoMechanicalVentilationView();
+  if (!oaSystem) {
+    unwatchObjects<&HVACControlsController::onVentilationChanged>(VentilationSection);
 
-        m_hvacAirLoopControlsView->ventilationViewSwitcher->setView(m_noMechanicalVentilationView);
-      }
+    if (m_mechanicalVentilationView) {
+      delete m_mechanicalVentilationView;
+    }
 
-      // Supply Air Temperature
-      boost::optional<model::SetpointManager> _spm;
-      std::vector<model::SetpointManager> _setpointManagers = t_airLoopHVAC->supplyOutletNode().setpointManagers();
-      for (auto it = _setpointManagers.begin(); it != _setpointManagers.end(); ++it) {
-        if (istringEqual("Temperature", it->controlVariable())) {
-          _spm = *it;
-          break;
-        }
-      }
+    if (!m_noMechanicalVentilationView) {
+      m_noMechanicalVentilationView = new NoMechanicalVentilationView();
 
-      boost::optional<model::SetpointManagerSingleZoneReheat> spmSZR;
-      boost::optional<model::SetpointManagerScheduled> spmS;
-      boost::optional<model::SetpointManagerFollowOutdoorAirTemperature> spmFOAT;
-      boost::optional<model::SetpointManagerOutdoorAirReset> spmOAR;
+      m_hvacAirLoopControlsView->ventilationViewSwitcher->setView(m_noMechanicalVentilationView);
+    }
 
-      if (_spm && (spmSZR = _spm->optionalCast<model::SetpointManagerSingleZoneReheat>())) {
-        m_singleZoneReheatSPMView = new SingleZoneReheatSPMView();
+    return;
+  }
 
-        m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_singleZoneReheatSPMView);
+  model::ControllerOutdoorAir controllerOutdoorAir = oaSystem->getControllerOutdoorAir();
 
-        std::vector<model::ThermalZone> thermalZones = t_airLoopHVAC->thermalZones();
+  model::ControllerMechanicalVentilation controllerMechanicalVentilation = controllerOutdoorAir.controllerMechanicalVentilation();
 
-        for (std::vector<model::ThermalZone>::const_iterator it = thermalZones.begin(); it != thermalZones.end(); ++it) {
-          m_singleZoneReheatSPMView->controlZoneComboBox->addItem(QString::fromStdString(it->name().get()), toQString(it->handle()));
-        }
+  // Only rebuild the view if the controllers it is bound to changed, otherwise just sync the combo boxes
+  const std::vector<model::ModelObject>& watchedObjects = m_watchedObjects[VentilationSection];
+  bool sameControllers = (watchedObjects.size() == 2) && (watchedObjects[0].handle() == controllerOutdoorAir.handle())
+                         && (watchedObjects[1].handle() == controllerMechanicalVentilation.handle());
 
-        m_singleZoneReheatSPMView->controlZoneComboBox->addItem("", toQString(UUID()));
+  if (!m_mechanicalVentilationView || !sameControllers) {
+    unwatchObjects<&HVACControlsController::onVentilationChanged>(VentilationSection);
+    watchObject<&HVACControlsController::onVentilationChanged>(VentilationSection, controllerOutdoorAir);
+    watchObject<&HVACControlsController::onVentilationChanged>(VentilationSection, controllerMechanicalVentilation);
 
-        if (boost::optional<model::ThermalZone> tz = spmSZR->controlZone()) {
-          int index = m_singleZoneReheatSPMView->controlZoneComboBox->findData(toQString(tz->handle()));
+    if (m_mechanicalVentilationView) {
+      delete m_mechanicalVentilationView;
+    }
+    if (m_noMechanicalVentilationView) {
+      delete m_noMechanicalVentilationView;
+    }
 
-          if (index > -1) {
-            m_singleZoneReheatSPMView->controlZoneComboBox->setCurrentIndex(index);
-          } else {
-            m_singleZoneReheatSPMView->controlZoneComboBox->addItem(QString::fromStdString(tz->name().get()), toQString(tz->handle()));
+    m_mechanicalVentilationView = new MechanicalVentilationView();
 
-            int i = m_singleZoneReheatSPMView->controlZoneComboBox->count() - 1;
+    m_hvacAirLoopControlsView->ventilationViewSwitcher->setView(m_mechanicalVentilationView);
 
-            m_singleZoneReheatSPMView->controlZoneComboBox->setCurrentIndex(i);
-          }
-        } else {
-          int index = m_singleZoneReheatSPMView->controlZoneComboBox->findData(toQString(UUID()));
+    connect(m_mechanicalVentilationView->economizerComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
+            &HVACControlsController::onEconomizerComboBoxIndexChanged);
 
-          OS_ASSERT(index > -1);
+    connect(m_mechanicalVentilationView->ventilationCalcMethodComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
+            &HVACControlsController::onVentilationCalcMethodComboBoxIndexChanged);
 
-          m_singleZoneReheatSPMView->controlZoneComboBox->setCurrentIndex(index);
-        }
+    // Demand Controlled Ventilation
 
-        connect(m_singleZoneReheatSPMView->controlZoneComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
-                &HVACControlsController::onControlZoneComboBoxChanged);
-      } else if (_spm && (spmS = _spm->optionalCast<model::SetpointManagerScheduled>())) {
-        m_scheduledSPMView = new ScheduledSPMView();
-
-        m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_scheduledSPMView);
-
-        auto supplyAirTempScheduleVectorController = new SupplyAirTempScheduleVectorController();
-        supplyAirTempScheduleVectorController->attach(spmS.get());
-        m_supplyAirTempScheduleDropZone = new OSDropZone(supplyAirTempScheduleVectorController);
-        m_supplyAirTempScheduleDropZone->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-        m_supplyAirTempScheduleDropZone->setMinItems(1);
-        m_supplyAirTempScheduleDropZone->setMaxItems(1);
-        m_supplyAirTempScheduleDropZone->setItemsRemoveable(false);
-        m_supplyAirTempScheduleDropZone->setAcceptDrops(true);
-        m_supplyAirTempScheduleDropZone->setItemsAcceptDrops(true);
-        m_supplyAirTempScheduleDropZone->setEnabled(true);
-        m_scheduledSPMView->supplyAirTemperatureViewSwitcher->setView(m_supplyAirTempScheduleDropZone);
-
-        // Allow clicking on the Schedule to see it in the right column inspector
-        connect(m_supplyAirTempScheduleDropZone.data(), &OSDropZone::itemClicked, supplyAirTempScheduleVectorController,
-                &SupplyAirTempScheduleVectorController::onDropZoneItemClicked);
-      } else if (_spm && (_spm->optionalCast<model::SetpointManagerFollowOutdoorAirTemperature>())) {
-        m_followOATempSPMView = new FollowOATempSPMView();
-
-        m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_followOATempSPMView);
-      } else if (_spm && (_spm->optionalCast<model::SetpointManagerOutdoorAirReset>())) {
-        m_oaResetSPMView = new OAResetSPMView();
-
-        m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_oaResetSPMView);
-      } else if (t_airLoopHVAC->supplyComponents(model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType()).size() > 0) {
-        model::AirLoopHVACUnitaryHeatPumpAirToAir hp = t_airLoopHVAC->supplyComponents(model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType())
-                                                         .back()
-                                                         .cast<model::AirLoopHVACUnitaryHeatPumpAirToAir>();
-
-        m_airLoopHVACUnitaryHeatPumpAirToAirControlView = new AirLoopHVACUnitaryHeatPumpAirToAirControlView();
-
-        m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_airLoopHVACUnitaryHeatPumpAirToAirControlView);
-
-        std::vector<model::ThermalZone> thermalZones = t_airLoopHVAC->thermalZones();
-
-        for (std::vector<model::ThermalZone>::const_iterator it = thermalZones.begin(); it != thermalZones.end(); ++it) {
-          m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->addItem(QString::fromStdString(it->name().get()),
-                                                                                        toQString(it->handle()));
-        }
+    // m_mechanicalVentilationView->dcvButton->bind(controllerMechanicalVentilation,"demandControlledVentilation");
+    m_mechanicalVentilationView->dcvButton->bind(
+      controllerMechanicalVentilation,
+      std::bind(&model::ControllerMechanicalVentilation::demandControlledVentilation, controllerMechanicalVentilation),
+      boost::optional<BoolSetter>(std::bind(&model::ControllerMechanicalVentilation::setDemandControlledVentilationNoFail,
+                                            controllerMechanicalVentilation, std::placeholders::_1)),
+      boost::optional<NoFailAction>(std::bind(&model::ControllerMechanicalVentilation::resetDemandControlledVentilation, controllerMechanicalVentilation)),
+      boost::optional<BasicQuery>(
+        std::bind(&model::ControllerMechanicalVentilation::isDemandControlledVentilationDefaulted, controllerMechanicalVentilation)));
+  }
 
-        m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->addItem("", toQString(UUID()));
+  // Economizer Control Type
 
-        if (boost::optional<model::ThermalZone> tz = hp.controllingZone()) {
-          int index = m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->findData(toQString(tz->handle()));
+  std::string economizerControlType = controllerOutdoorAir.getEconomizerControlType();
 
-          if (index > -1) {
-            m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->setCurrentIndex(index);
-          } else {
-            m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->addItem(QString::fromStdString(tz->name().get()),
-                                                                                          toQString(tz->handle()));
+  int economizerIndex = m_mechanicalVentilationView->economizerComboBox->findData(QString::fromStdString(economizerControlType));
 
-            int i = m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->count() - 1;
+  bool signalsAlreadyBlocked = m_mechanicalVentilationView->economizerComboBox->blockSignals(true);
+  m_mechanicalVentilationView->economizerComboBox->setCurrentIndex(economizerIndex);
+  m_mechanicalVentilationView->economizerComboBox->blockSignals(signalsAlreadyBlocked);
 
-            m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->setCurrentIndex(i);
-          }
-        } else {
-          int index = m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->findData(toQString(UUID()));
+  // Ventilation Calculation Method
 
-          OS_ASSERT(index > -1);
+  std::string ventilationMethod = controllerMechanicalVentilation.systemOutdoorAirMethod();
 
-          m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->setCurrentIndex(index);
-        }
+  int ventilationMethodIndex = m_mechanicalVentilationView->ventilationCalcMethodComboBox->findData(QString::fromStdString(ventilationMethod));
+
+  signalsAlreadyBlocked = m_mechanicalVentilationView->ventilationCalcMethodComboBox->blockSignals(true);
+  m_mechanicalVentilationView->ventilationCalcMethodComboBox->setCurrentIndex(ventilationMethodIndex);
+  m_mechanicalVentilationView->ventilationCalcMethodComboBox->blockSignals(signalsAlreadyBlocked);
+}
+
+void HVACControlsController::refreshSupplyAirTemperature(const model::AirLoopHVAC& airLoopHVAC) {
+  ++m_sectionRefreshCounts[SupplyAirTemperatureSection];
+
+  unwatchObjects<&HVACControlsController::onSupplyAirTemperatureChanged>(SupplyAirTemperatureSection);
+
+  if (m_singleZoneReheatSPMView) {
+    delete m_singleZoneReheatSPMView;
+  }
+  if (m_noSupplyAirTempControlView) {
+    delete m_noSupplyAirTempControlView;
+  }
+  if (m_supplyAirTempScheduleDropZone) {
+    delete m_supplyAirTempScheduleDropZone;
+  }
+  if (m_followOATempSPMView) {
+    delete m_followOATempSPMView;
+  }
+  if (m_oaResetSPMView) {
+    delete m_oaResetSPMView;
+  }
+  if (m_scheduledSPMView) {
+    delete m_scheduledSPMView;
+  }
+  if (m_airLoopHVACUnitaryHeatPumpAirToAirControlView) {
+    delete m_airLoopHVACUnitaryHeatPumpAirToAirControlView;
+  }
+
+  // Supply Air Temperature
+  boost::optional<model::SetpointManager> _spm;
+  std::vector<model::SetpointManager> _setpointManagers = airLoopHVAC.supplyOutletNode().setpointManagers();
+  for (auto it = _setpointManagers.begin(); it != _setpointManagers.end(); ++it) {
+    if (istringEqual("Temperature", it->controlVariable())) {
+      _spm = *it;
+      break;
+    }
+  }
+
+  if (_spm) {
+    watchObject<&HVACControlsController::onSupplyAirTemperatureChanged>(SupplyAirTemperatureSection, _spm.get());
+  }
+
+  boost::optional<model::SetpointManagerSingleZoneReheat> spmSZR;
+  boost::optional<model::SetpointManagerScheduled> spmS;
+
+  if (_spm && (spmSZR = _spm->optionalCast<model::SetpointManagerSingleZoneReheat>())) {
+    m_singleZoneReheatSPMView = new SingleZoneReheatSPMView();
+
+    m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_singleZoneReheatSPMView);
+
+    std::vector<model::ThermalZone> thermalZones = airLoopHVAC.thermalZones();
+
+    for (std::vector<model::ThermalZone>::const_iterator it = thermalZones.begin(); it != thermalZones.end(); ++it) {
+      m_singleZoneReheatSPMView->controlZoneComboBox->addItem(QString::fromStdString(it->name().get()), toQString(it->handle()));
+    }
+
+    m_singleZoneReheatSPMView->controlZoneComboBox->addItem("", toQString(UUID()));
+
+    if (boost::optional<model::ThermalZone> tz = spmSZR->controlZone()) {
+      int index = m_singleZoneReheatSPMView->controlZoneComboBox->findData(toQString(tz->handle()));
 
-        connect(m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox,
-                static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
-                &HVACControlsController::onUnitaryHeatPumpControlZoneChanged);
+      if (index > -1) {
+        m_singleZoneReheatSPMView->controlZoneComboBox->setCurrentIndex(index);
       } else {
-        m_noSupplyAirTempControlView = new NoSupplyAirTempControlView();
+        m_singleZoneReheatSPMView->controlZoneComboBox->addItem(QString::fromStdString(tz->name().get()), toQString(tz->handle()));
 
-        m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_noSupplyAirTempControlView);
+        int i = m_singleZoneReheatSPMView->controlZoneComboBox->count() - 1;
+
+        m_singleZoneReheatSPMView->controlZoneComboBox->setCurrentIndex(i);
       }
+    } else {
+      int index = m_singleZoneReheatSPMView->controlZoneComboBox->findData(toQString(UUID()));
+
+      OS_ASSERT(index > -1);
+
+      m_singleZoneReheatSPMView->controlZoneComboBox->setCurrentIndex(index);
+    }
+
+    connect(m_singleZoneReheatSPMView->controlZoneComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
+            &HVACControlsController::onControlZoneComboBoxChanged);
+  } else if (_spm && (spmS = _spm->optionalCast<model::SetpointManagerScheduled>())) {
+    m_scheduledSPMView = new ScheduledSPMView();
+
+    m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_scheduledSPMView);
+
+    auto supplyAirTempScheduleVectorController = new SupplyAirTempScheduleVectorController();
+    supplyAirTempScheduleVectorController->attach(spmS.get());
+    m_supplyAirTempScheduleDropZone = new OSDropZone(supplyAirTempScheduleVectorController);
+    m_supplyAirTempScheduleDropZone->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+    m_supplyAirTempScheduleDropZone->setMinItems(1);
+    m_supplyAirTempScheduleDropZone->setMaxItems(1);
+    m_supplyAirTempScheduleDropZone->setItemsRemoveable(false);
+    m_supplyAirTempScheduleDropZone->setAcceptDrops(true);
+    m_supplyAirTempScheduleDropZone->setItemsAcceptDrops(true);
+    m_supplyAirTempScheduleDropZone->setEnabled(true);
+    m_scheduledSPMView->supplyAirTemperatureViewSwitcher->setView(m_supplyAirTempScheduleDropZone);
+
+    // Allow clicking on the Schedule to see it in the right column inspector
+    connect(m_supplyAirTempScheduleDropZone.data(), &OSDropZone::itemClicked, supplyAirTempScheduleVectorController,
+            &SupplyAirTempScheduleVectorController::onDropZoneItemClicked);
+  } else if (_spm && (_spm->optionalCast<model::SetpointManagerFollowOutdoorAirTemperature>())) {
+    m_followOATempSPMView = new FollowOATempSPMView();
 
-      // AVM List
-      auto availabilityManagerObjectVectorController = new AvailabilityManagerObjectVectorController();
-      availabilityManagerObjectVectorController->attach(t_airLoopHVAC.get());
-      m_availabilityManagerDropZone = new OSDropZone(availabilityManagerObjectVectorController, "Drag From Library", QSize(0, 0), false);
-      m_availabilityManagerDropZone->setFixedSize(QSize(OSItem::ITEM_WIDTH + 20, 10 * 50));
-      m_availabilityManagerDropZone->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-      m_availabilityManagerDropZone->setMinItems(0);
-      m_availabilityManagerDropZone->setMaxItems(10);
-      m_availabilityManagerDropZone->setItemsRemoveable(true);
-      m_availabilityManagerDropZone->setAcceptDrops(true);
-      m_availabilityManagerDropZone->setItemsAcceptDrops(true);
-      m_availabilityManagerDropZone->setEnabled(true);
-      m_availabilityManagerDropZone->setItemsDraggable(true);
-      m_hvacAirLoopControlsView->availabilityManagerViewSwitcher->setView(m_availabilityManagerDropZone);
+    m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_followOATempSPMView);
+  } else if (_spm && (_spm->optionalCast<model::SetpointManagerOutdoorAirReset>())) {
+    m_oaResetSPMView = new OAResetSPMView();
 
-      // When clicking on the drop zone item, pull it on the MainRightColumnController
-      connect(m_availabilityManagerDropZone.data(), &OSDropZone::itemClicked, availabilityManagerObjectVectorController,
-              &AvailabilityManagerObjectVectorController::onDropZoneItemClicked);
+    m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_oaResetSPMView);
+  } else if (airLoopHVAC.supplyComponents(model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType()).size() > 0) {
+    model::AirLoopHVACUnitaryHeatPumpAirToAir hp = airLoopHVAC.supplyComponents(model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType())
+                                                     .back()
+                                                     .cast<model::AirLoopHVACUnitaryHeatPumpAirToAir>();
 
-      m_hvacAirLoopControlsView->setUpdatesEnabled(true);
+    watchObject<&HVACControlsController::onSupplyAirTemperatureChanged>(SupplyAirTemperatureSection, hp);
 
+    m_airLoopHVACUnitaryHeatPumpAirToAirControlView = new AirLoopHVACUnitaryHeatPumpAirToAirControlView();
+
+    m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_airLoopHVACUnitaryHeatPumpAirToAirControlView);
+
+    std::vector<model::ThermalZone> thermalZones = airLoopHVAC.thermalZones();
+
+    for (std::vector<model::ThermalZone>::const_iterator it = thermalZones.begin(); it != thermalZones.end(); ++it) {
+      m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->addItem(QString::fromStdString(it->name().get()),
+                                                                                    toQString(it->handle()));
     }
 
-    // Else if a plantLoop
-    else if (boost::optional<model::PlantLoop> t_plantLoop = plantLoop()) {
+    m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->addItem("", toQString(UUID()));
 
-      m_hvacPlantLoopControlsView->setUpdatesEnabled(false);
+    if (boost::optional<model::ThermalZone> tz = hp.controllingZone()) {
+      int index = m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->findData(toQString(tz->handle()));
 
-      if (m_systemAvailabilityDropZone) {
-        delete m_systemAvailabilityDropZone;
-      }
+      if (index > -1) {
+        m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->setCurrentIndex(index);
+      } else {
+        m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->addItem(QString::fromStdString(tz->name().get()),
+                                                                                      toQString(tz->handle()));
 
-      QString title;
-      title.append(QString::fromStdString(t_plantLoop->name().get()));
-      m_hvacPlantLoopControlsView->systemNameLabel->setText(title);
-
-      openstudio::energyplus::ComponentType plType = openstudio::energyplus::plantLoopType(t_plantLoop.get());
-
-      if (plType == openstudio::energyplus::ComponentType::BOTH) {
-        m_hvacPlantLoopControlsView->plantLoopTypeLabel->setText("Both");
-        m_hvacPlantLoopControlsView->plantLoopTypeLabel->setStyleSheet("QLabel { color : orange; }");
-      } else if (plType == openstudio::energyplus::ComponentType::HEATING) {
-        m_hvacPlantLoopControlsView->plantLoopTypeLabel->setText("Heating");
-        m_hvacPlantLoopControlsView->plantLoopTypeLabel->setStyleSheet("QLabel { color : red; }");
-
-      } else if (plType == openstudio::energyplus::ComponentType::COOLING) {
-        m_hvacPlantLoopControlsView->plantLoopTypeLabel->setText("Cooling");
-        m_hvacPlantLoopControlsView->plantLoopTypeLabel->setStyleSheet("QLabel { color : blue; }");
-      } else if (plType == openstudio::energyplus::ComponentType::NONE) {
-        m_hvacPlantLoopControlsView->plantLoopTypeLabel->setText("None");
-        m_hvacPlantLoopControlsView->plantLoopTypeLabel->setStyleSheet("QLabel { color : black; }");
-      }
+        int i = m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->count() - 1;
 
-      // Heating Components
-      QString heatingComps("<ul>");
-      // std::vector<model::HVACComponent> heatingComponents = openstudio::energyplus::heatingComponents(t_plantLoop.get());
-      for (const model::HVACComponent& hc : openstudio::energyplus::heatingComponents(t_plantLoop.get())) {
-        heatingComps.append("<li>");
-        heatingComps.append(QString::fromStdString(hc.nameString()));
-        heatingComps.append("</li>");
-      }
-      heatingComps.append("</ul>");
-      m_hvacPlantLoopControlsView->heatingComponentsLabel->setText(heatingComps);
-
-      // Cooling Components
-      QString coolingComps("<ul>");
-      // std::vector<model::HVACComponent> coolingComponents = openstudio::energyplus::coolingComponents(t_plantLoop.get());
-      for (const model::HVACComponent& hc : openstudio::energyplus::coolingComponents(t_plantLoop.get())) {
-        coolingComps.append("<li>");
-        coolingComps.append(QString::fromStdString(hc.nameString()));
-        coolingComps.append("</li>");
-      }
-      coolingComps.append("</ul>");
-      m_hvacPlantLoopControlsView->coolingComponentsLabel->setText(coolingComps);
-
-      // Setpoint Components
-      QString setpointComps("<ul>");
-      // std::vector<model::HVACComponent> setpointComponents = openstudio::energyplus::setpointComponents(t_plantLoop.get());
-      for (const model::HVACComponent& hc : openstudio::energyplus::setpointComponents(t_plantLoop.get())) {
-        setpointComps.append("<li>");
-        setpointComps.append(QString::fromStdString(hc.nameString()));
-        setpointComps.append("</li>");
-      }
-      setpointComps.append("</ul>");
-      m_hvacPlantLoopControlsView->setpointComponentsLabel->setText(setpointComps);
-
-      // Uncontrolled Components
-      QString uncontrolledComps("<ul>");
-      // std::vector<model::HVACComponent> uncontrolledComponents = openstudio::energyplus::uncontrolledComponents(t_plantLoop.get());
-      for (const model::HVACComponent& hc : openstudio::energyplus::uncontrolledComponents(t_plantLoop.get())) {
-        uncontrolledComps.append("<li>");
-        uncontrolledComps.append(QString::fromStdString(hc.nameString()));
-        uncontrolledComps.append("</li>");
+        m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->setCurrentIndex(i);
       }
-      uncontrolledComps.append("</ul>");
-      m_hvacPlantLoopControlsView->uncontrolledComponentsLabel->setText(uncontrolledComps);
+    } else {
+      int index = m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->findData(toQString(UUID()));
 
-      // AvailabilityManagers
+      OS_ASSERT(index > -1);
 
-      auto availabilityManagerObjectVectorController = new AvailabilityManagerObjectVectorController();
-      availabilityManagerObjectVectorController->attach(t_plantLoop.get());
-      // m_availabilityManagerDropZone = new OSDropZone(availabilityManagerObjectVectorController);
-      m_availabilityManagerDropZone = new OSDropZone(availabilityManagerObjectVectorController, "Drag From Library", QSize(0, 0), false);
+      m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox->setCurrentIndex(index);
+    }
 
-      m_availabilityManagerDropZone->setFixedSize(QSize(OSItem::ITEM_WIDTH + 20, 10 * 50));
-      m_availabilityManagerDropZone->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
-      m_availabilityManagerDropZone->setMinItems(0);
-      m_availabilityManagerDropZone->setMaxItems(10);
-      m_availabilityManagerDropZone->setItemsRemoveable(true);
-      m_availabilityManagerDropZone->setAcceptDrops(true);
-      m_availabilityManagerDropZone->setItemsAcceptDrops(true);
-      m_availabilityManagerDropZone->setEnabled(true);
-      m_availabilityManagerDropZone->setItemsDraggable(true);
-      m_hvacPlantLoopControlsView->availabilityManagerViewSwitcher->setView(m_availabilityManagerDropZone);
+    connect(m_airLoopHVACUnitaryHeatPumpAirToAirControlView->controlZoneComboBox,
+            static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this, &HVACControlsController::onUnitaryHeatPumpControlZoneChanged);
+  } else {
+    m_noSupplyAirTempControlView = new NoSupplyAirTempControlView();
 
-      // When clicking on the drop zone item, pull it on the MainRightColumnController
-      connect(m_availabilityManagerDropZone.data(), &OSDropZone::itemClicked, availabilityManagerObjectVectorController,
-              &AvailabilityManagerObjectVectorController::onDropZoneItemClicked);
+    m_hvacAirLoopControlsView->supplyAirTemperatureViewSwitcher->setView(m_noSupplyAirTempControlView);
+  }
+}
 
-      m_hvacPlantLoopControlsView->setUpdatesEnabled(true);
-    }
+void HVACControlsController::refreshAvailabilityManagers(const model::Loop& loop) {
+  ++m_sectionRefreshCounts[AvailabilityManagerSection];
 
-    m_dirty = false;
+  if (m_availabilityManagerDropZone) {
+    delete m_availabilityManagerDropZone;
+  }
+
+  // AVM List, the vector controller keeps the drop zone in sync afterwards
+  auto availabilityManagerObjectVectorController = new AvailabilityManagerObjectVectorController();
+  availabilityManagerObjectVectorController->attach(loop);
+  m_availabilityManagerDropZone = new OSDropZone(availabilityManagerObjectVectorController, "Drag From Library", QSize(0, 0), false);
+  m_availabilityManagerDropZone->setFixedSize(QSize(OSItem::ITEM_WIDTH + 20, 10 * 50));
+  m_availabilityManagerDropZone->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
+  m_availabilityManagerDropZone->setMinItems(0);
+  m_availabilityManagerDropZone->setMaxItems(10);
+  m_availabilityManagerDropZone->setItemsRemoveable(true);
+  m_availabilityManagerDropZone->setAcceptDrops(true);
+  m_availabilityManagerDropZone->setItemsAcceptDrops(true);
+  m_availabilityManagerDropZone->setEnabled(true);
+  m_availabilityManagerDropZone->setItemsDraggable(true);
+
+  if (loop.optionalCast<model::AirLoopHVAC>()) {
+    m_hvacAirLoopControlsView->availabilityManagerViewSwitcher->setView(m_availabilityManagerDropZone);
+  } else {
+    m_hvacPlantLoopControlsView->availabilityManagerViewSwitcher->setView(m_availabilityManagerDropZone);
+  }
+
+  // When clicking on the drop zone item, pull it on the MainRightColumnController
+  connect(m_availabilityManagerDropZone.data(), &OSDropZone::itemClicked, availabilityManagerObjectVectorController,
+          &AvailabilityManagerObjectVectorController::onDropZoneItemClicked);
+}
+
+void HVACControlsController::refreshPlantLoopName(const model::PlantLoop& plantLoop) {
+  ++m_sectionRefreshCounts[NameSection];
+
+  m_hvacPlantLoopControlsView->systemNameLabel->setText(QString::fromStdString(plantLoop.nameString()));
+}
+
+void HVACControlsController::refreshPlantComponents(const model::PlantLoop& plantLoop) {
+  ++m_sectionRefreshCounts[PlantComponentsSection];
+
+  openstudio::energyplus::ComponentType plType = openstudio::energyplus::plantLoopType(plantLoop);
+
+  if (plType == openstudio::energyplus::ComponentType::BOTH) {
+    m_hvacPlantLoopControlsView->plantLoopTypeLabel->setText("Both");
+    m_hvacPlantLoopControlsView->plantLoopTypeLabel->setStyleSheet("QLabel { color : orange; }");
+  } else if (plType == openstudio::energyplus::ComponentType::HEATING) {
+    m_hvacPlantLoopControlsView->plantLoopTypeLabel->setText("Heating");
+    m_hvacPlantLoopControlsView->plantLoopTypeLabel->setStyleSheet("QLabel { color : red; }");
+
+  } else if (plType == openstudio::energyplus::ComponentType::COOLING) {
+    m_hvacPlantLoopControlsView->plantLoopTypeLabel->setText("Cooling");
+    m_hvacPlantLoopControlsView->plantLoopTypeLabel->setStyleSheet("QLabel { color : blue; }");
+  } else if (plType == openstudio::energyplus::ComponentType::NONE) {
+    m_hvacPlantLoopControlsView->plantLoopTypeLabel->setText("None");
+    m_hvacPlantLoopControlsView->plantLoopTypeLabel->setStyleSheet("QLabel { color : black; }");
+  }
+
+  // Heating Components
+  QString heatingComps("<ul>");
+  for (const model::HVACComponent& hc : openstudio::energyplus::heatingComponents(plantLoop)) {
+    heatingComps.append("<li>");
+    heatingComps.append(QString::fromStdString(hc.nameString()));
+    heatingComps.append("</li>");
+  }
+  heatingComps.append("</ul>");
+  m_hvacPlantLoopControlsView->heatingComponentsLabel->setText(heatingComps);
+
+  // Cooling Components
+  QString coolingComps("<ul>");
+  for (const model::HVACComponent& hc : openstudio::energyplus::coolingComponents(plantLoop)) {
+    coolingComps.append("<li>");
+    coolingComps.append(QString::fromStdString(hc.nameString()));
+    coolingComps.append("</li>");
+  }
+  coolingComps.append("</ul>");
+  m_hvacPlantLoopControlsView->coolingComponentsLabel->setText(coolingComps);
+
+  // Setpoint Components
+  QString setpointComps("<ul>");
+  for (const model::HVACComponent& hc : openstudio::energyplus::setpointComponents(plantLoop)) {
+    setpointComps.append("<li>");
+    setpointComps.append(QString::fromStdString(hc.nameString()));
+    setpointComps.append("</li>");
+  }
+  setpointComps.append("</ul>");
+  m_hvacPlantLoopControlsView->setpointComponentsLabel->setText(setpointComps);
+
+  // Uncontrolled Components
+  QString uncontrolledComps("<ul>");
+  for (const model::HVACComponent& hc : openstudio::energyplus::uncontrolledComponents(plantLoop)) {
+    uncontrolledComps.append("<li>");
+    uncontrolledComps.append(QString::fromStdString(hc.nameString()));
+    uncontrolledComps.append("</li>");
   }
+  uncontrolledComps.append("</ul>");
+  m_hvacPlantLoopControlsView->uncontrolledComponentsLabel->setText(uncontrolledComps);
 }
 
 void HVACControlsController::onEconomizerComboBoxIndexChanged(int index) {
@@ -1519,9 +1762,94 @@ void HVACControlsController::onUnitaryHeatPumpControlZoneChanged(int index) {
 }
 
 void HVACControlsController::updateLater() {
-  m_dirty = true;
+  updateSectionsLater(AllSections);
+}
+
+void HVACControlsController::updateSectionsLater(unsigned sections) {
+  bool scheduled = (m_dirtySections != 0);
+
+  m_dirtySections |= sections;
+
+  if (!scheduled && m_dirtySections != 0) {
+    QTimer::singleShot(0, this, &HVACControlsController::update);
+  }
+}
+
+void HVACControlsController::refreshNow() {
+  update();
+}
+
+unsigned HVACControlsController::sectionRefreshCount(Section section) const {
+  auto it = m_sectionRefreshCounts.find(section);
+  return (it != m_sectionRefreshCounts.end()) ? it->second : 0u;
+}
+
+unsigned HVACControlsController::sectionsForObject(const WorkspaceObject& workspaceObject) {
+  static const std::unordered_map<int, unsigned> sectionsByType{
+    {model::CoilCoolingDXSingleSpeed::iddObjectType().value(), CoolingHeatingTypeSection},
+    {model::CoilCoolingDXTwoSpeed::iddObjectType().value(), CoolingHeatingTypeSection},
+    {model::CoilCoolingWater::iddObjectType().value(), CoolingHeatingTypeSection},
+    {model::CoilHeatingGas::iddObjectType().value(), CoolingHeatingTypeSection},
+    {model::CoilHeatingElectric::iddObjectType().value(), CoolingHeatingTypeSection},
+    {model::CoilHeatingWater::iddObjectType().value(), CoolingHeatingTypeSection},
+    {model::AirLoopHVACUnitaryHeatPumpAirToAir::iddObjectType().value(), CoolingHeatingTypeSection | SupplyAirTemperatureSection},
+    {model::AvailabilityManagerAssignmentList::iddObjectType().value(), NightCycleSection},
+    {model::AirLoopHVACOutdoorAirSystem::iddObjectType().value(), VentilationSection},
+    {model::ControllerOutdoorAir::iddObjectType().value(), VentilationSection},
+    {model::ControllerMechanicalVentilation::iddObjectType().value(), VentilationSection},
+    // Zones served by the air loop populate the control zone combo boxes
+    {model::ThermalZone::iddObjectType().value(), SupplyAirTemperatureSection},
+    {model::Node::iddObjectType().value(), SupplyAirTemperatureSection},
+  };
+
+  unsigned sections = 0;
+
+  auto it = sectionsByType.find(workspaceObject.iddObject().type().value());
+  if (it != sectionsByType.end()) {
+    sections |= it->second;
+  }
+
+  if (workspaceObject.optionalCast<model::SetpointManager>()) {
+    sections |= SupplyAirTemperatureSection;
+  } else if (workspaceObject.optionalCast<model::AvailabilityManager>()) {
+    sections |= NightCycleSection;
+  }
+
+  if (workspaceObject.optionalCast<model::HVACComponent>()) {
+    sections |= PlantComponentsSection;
+  }
+
+  return sections;
+}
+
+void HVACControlsController::onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type,
+                                           const openstudio::UUID& uuid) {
+  if (m_loop) {
+    updateSectionsLater(sectionsForObject(workspaceObject));
+  }
+}
+
+void HVACControlsController::onObjectRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type,
+                                             const openstudio::UUID& uuid) {
+  if (m_loop) {
+    updateSectionsLater(sectionsForObject(workspaceObject));
+  }
+}
+
+void HVACControlsController::onLoopNameChanged() {
+  updateSectionsLater(NameSection);
+}
+
+void HVACControlsController::onNightCycleChanged() {
+  updateSectionsLater(NightCycleSection);
+}
+
+void HVACControlsController::onVentilationChanged() {
+  updateSectionsLater(VentilationSection);
+}
 
-  QTimer::singleShot(0, this, &HVACControlsController::update);
+void HVACControlsController::onSupplyAirTemperatureChanged() {
+  updateSectionsLater(SupplyAirTemperatureSection);
 }
 
 HVACLayoutController::HVACLayoutController(HVACSystemsController* hvacSystemsController)
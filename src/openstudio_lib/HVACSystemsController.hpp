@@ -37,6 +37,8 @@
 #include "ModelObjectItem.hpp"
 #include "ModelObjectVectorController.hpp"
 #include <boost/smart_ptr.hpp>
+#include <map>
+#include <memory>
 #include "SOConstants.hpp"
 #include "../shared_gui_components/OSQObjectController.hpp"
 #include "OSItem.hpp"
@@ -119,6 +121,9 @@ class HVACSystemsController : public QObject, public Nano::Observer
 
   void clearSceneSelection();
 
+  // Number of loop rows inserted in or removed from the SystemComboBox, including the rows filled on construction
+  unsigned systemRowChangeCount() const;
+
  public slots:
 
   void updateLater();
@@ -129,8 +134,8 @@ class HVACSystemsController : public QObject, public Nano::Observer
 
   void update();
 
-  // Trigger repopulation of the SystemComboBox only
-  // Will be connected to Plant/AirLoop name IdfObject name change and also called by (full) update
+  // Clear and refill the SystemComboBox from the model, only done once on construction
+  // Afterwards loops are inserted, removed and renamed one row at a time
   void repopulateSystemComboBox();
 
   void addToModel(AddToModelEnum addToModelEnum);
@@ -160,7 +165,37 @@ class HVACSystemsController : public QObject, public Nano::Observer
  private:
   REGISTER_LOGGER("openstudio.openstudio_lib.HVACSystemsController");
 
-  std::vector<IddObjectType> systemComboBoxTypes() const;
+  static bool isSystemComboBoxType(const IddObjectType& type);
+
+  void setSystemComboBoxCurrentIndex();
+
+  // IdfObject_Impl::onNameChange does not say which object was renamed, so each loop gets an observer forwarding its handle
+  class SystemNameObserver : public Nano::Observer
+  {
+   public:
+    SystemNameObserver(HVACSystemsController* controller, const Handle& handle) : m_controller(controller), m_handle(handle) {}
+
+    void onNameChange() {
+      m_controller->onSystemNameChanged(m_handle);
+    }
+
+   private:
+    HVACSystemsController* m_controller;
+    Handle m_handle;
+  };
+
+  // Observe the name of a Plant/AirLoop, done once per loop
+  void connectSystemNameChange(const model::Loop& loop);
+
+  // Moves a renamed loop to its sorted row
+  void onSystemNameChanged(const Handle& handle);
+
+  void insertSystemRow(const model::Loop& loop);
+
+  void removeSystemRow(const Handle& handle);
+
+  // Refresh the handle to row index starting at row
+  void reindexSystemRows(int row);
 
   QPointer<HVACSystemsView> m_hvacSystemsView;
 
@@ -184,6 +219,17 @@ class HVACSystemsController : public QObject, public Nano::Observer
 
   bool m_isIP;
 
+  // Loops in the SystemComboBox by handle, air loops come first then plant loops, each sorted by name
+  std::map<Handle, int> m_systemRows;
+
+  int m_airLoopRowCount = 0;
+
+  int m_plantLoopRowCount = 0;
+
+  std::map<Handle, std::unique_ptr<SystemNameObserver>> m_systemNameObservers;
+
+  unsigned m_systemRowChangeCount = 0;
+
  signals:
 
   void toggleUnitsClicked(bool displayIP);
@@ -208,14 +254,47 @@ class HVACControlsController : public QObject, public Nano::Observer
 
   boost::optional<model::PlantLoop> plantLoop() const;
 
+  // Sections of the controls views, each one is refreshed on its own when the objects it displays change
+  enum Section : unsigned
+  {
+    NameSection = 0x01,
+    CoolingHeatingTypeSection = 0x02,
+    HVACOperationSection = 0x04,
+    NightCycleSection = 0x08,
+    VentilationSection = 0x10,
+    SupplyAirTemperatureSection = 0x20,
+    AvailabilityManagerSection = 0x40,
+    PlantComponentsSection = 0x80,
+    AllSections = 0xFF
+  };
+
+  // Refresh the dirty sections without waiting for the event loop
+  void refreshNow();
+
+  // Number of times a section was refreshed
+  unsigned sectionRefreshCount(Section section) const;
+
  public slots:
 
+  // Refresh all sections
   void updateLater();
 
  private slots:
 
   void update();
 
+  void onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+  void onObjectRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+  void onLoopNameChanged();
+
+  void onNightCycleChanged();
+
+  void onVentilationChanged();
+
+  void onSupplyAirTemperatureChanged();
+
   void onEconomizerComboBoxIndexChanged(int index);
 
   void onVentilationCalcMethodComboBoxIndexChanged(int index);
@@ -259,7 +338,44 @@ class HVACControlsController : public QObject, public Nano::Observer
 
   QPointer<OSDropZone> m_availabilityManagerDropZone;
 
-  bool m_dirty;
+  void updateSectionsLater(unsigned sections);
+
+  // Sections affected when an object of this type is added to or removed from the model
+  static unsigned sectionsForObject(const WorkspaceObject& workspaceObject);
+
+  template <void (HVACControlsController::*Slot)()>
+  void watchObject(Section section, const model::ModelObject& modelObject);
+
+  template <void (HVACControlsController::*Slot)()>
+  void unwatchObjects(Section section);
+
+  void refreshAirLoopName(const model::AirLoopHVAC& airLoopHVAC);
+
+  void refreshCoolingHeatingType(const model::AirLoopHVAC& airLoopHVAC);
+
+  void refreshHVACOperation(const model::AirLoopHVAC& airLoopHVAC);
+
+  void refreshNightCycle(const model::AirLoopHVAC& airLoopHVAC);
+
+  void refreshVentilation(const model::AirLoopHVAC& airLoopHVAC);
+
+  void refreshSupplyAirTemperature(const model::AirLoopHVAC& airLoopHVAC);
+
+  void refreshAvailabilityManagers(const model::Loop& loop);
+
+  void refreshPlantLoopName(const model::PlantLoop& plantLoop);
+
+  void refreshPlantComponents(const model::PlantLoop& plantLoop);
+
+  // Loop the sections are bound to, all sections are refreshed when the current loop changes
+  boost::optional<model::Loop> m_loop;
+
+  // Objects each section listens to for field changes
+  std::map<unsigned, std::vector<model::ModelObject>> m_watchedObjects;
+
+  std::map<unsigned, unsigned> m_sectionRefreshCounts;
+
+  unsigned m_dirtySections = 0;
 };
 
 class HVACLayoutController : public QObject, public Nano::Observer
@@ -32,6 +32,8 @@
 #include "OSAppBase.hpp"
 #include "BCLComponentItem.hpp"
 
+#include "../shared_gui_components/LocalBCLComponentCache.hpp"
+
 #include <openstudio/model/Model_Impl.hpp>
 #include <openstudio/model/ModelObject_Impl.hpp>
 #include <openstudio/model/ZoneHVACComponent.hpp>
@@ -49,18 +51,24 @@
 #include <openstudio/utilities/idd/IddEnums.hpp>
 #include <openstudio/utilities/idd/IddEnums.hxx>
 
+#include <algorithm>
 #include <iostream>
 
 namespace openstudio {
 
 ModelObjectListController::ModelObjectListController(const openstudio::IddObjectType& iddObjectType, const model::Model& model, bool showLocalBCL)
-  : m_iddObjectType(iddObjectType), m_model(model), m_showLocalBCL(showLocalBCL) {
+  : m_iddObjectType(iddObjectType), m_model(model), m_showLocalBCL(showLocalBCL), m_modelObjectsInitialized(false), m_modelObjectsNeedSort(false) {
 
   // model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.connect<ModelObjectListController, &ModelObjectListController::objectAdded>(this);
   connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ModelObjectListController::objectAdded, Qt::QueuedConnection);
 
   //model.getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObjectPtr.connect<ModelObjectListController, &ModelObjectListController::objectRemoved>(this);
   connect(OSAppBase::instance(), &OSAppBase::workspaceObjectRemovedPtr, this, &ModelObjectListController::objectRemoved, Qt::QueuedConnection);
+
+  if (m_showLocalBCL) {
+    connect(&LocalBCLComponentCache::instance(), &LocalBCLComponentCache::invalidated, this, &ModelObjectListController::localBCLChanged,
+            Qt::QueuedConnection);
+  }
 }
 
 IddObjectType ModelObjectListController::iddObjectType() const {
@@ -70,6 +78,13 @@ IddObjectType ModelObjectListController::iddObjectType() const {
 void ModelObjectListController::objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl,
                                             const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) {
   if (iddObjectType == m_iddObjectType) {
+    // if the list is not built yet, it will pick up the new object when it is
+    if (m_modelObjectsInitialized) {
+      if (boost::optional<model::ModelObject> modelObject = m_model.getModelObject<model::ModelObject>(impl->handle())) {
+        insertSorted(*modelObject);
+      }
+    }
+
     std::vector<OSItemId> ids = this->makeVector();
     emit itemIds(ids);
 
@@ -85,37 +100,83 @@ void ModelObjectListController::objectAdded(std::shared_ptr<openstudio::detail::
 void ModelObjectListController::objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl,
                                               const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) {
   if (iddObjectType == m_iddObjectType) {
+    // removed objects may already have a null handle by the time this queued slot runs
+    m_modelObjects.erase(std::remove_if(m_modelObjects.begin(), m_modelObjects.end(),
+                                        [&handle](const model::ModelObject& mo) { return mo.handle().isNull() || (mo.handle() == handle); }),
+                         m_modelObjects.end());
+
     emit itemIds(makeVector());
   }
 }
 
-std::vector<OSItemId> ModelObjectListController::makeVector() {
-  std::vector<OSItemId> result;
+void ModelObjectListController::localBCLChanged() {
+  emit itemIds(makeVector());
+}
 
-  if (m_showLocalBCL) {
-    std::vector<std::pair<std::string, std::string>> pairs;
-    pairs.push_back(std::make_pair<std::string, std::string>("OpenStudio Type", m_iddObjectType.valueDescription()));
+void ModelObjectListController::objectNameChanged() {
+  // resorted lazily on the next makeVector, renaming an object does not otherwise change the list
+  m_modelObjectsNeedSort = true;
+}
+
+void ModelObjectListController::insertSorted(const model::ModelObject& modelObject) {
+  // the list may have been built from the model after the object was added but before the queued objectAdded ran
+  const Handle handle = modelObject.handle();
+  if (std::any_of(m_modelObjects.begin(), m_modelObjects.end(), [&handle](const model::ModelObject& mo) { return mo.handle() == handle; })) {
+    return;
+  }
+
+  modelObject.getImpl<detail::IdfObject_Impl>()
+    .get()
+    ->detail::IdfObject_Impl::onNameChange.connect<ModelObjectListController, &ModelObjectListController::objectNameChanged>(this);
 
-    // get BCL results
-    std::vector<BCLComponent> bclresults = LocalBCL::instance().componentAttributeSearch(pairs);
+  auto it = std::upper_bound(m_modelObjects.begin(), m_modelObjects.end(), modelObject, WorkspaceObjectNameGreater());
+  m_modelObjects.insert(it, modelObject);
+}
+
+const std::vector<model::ModelObject>& ModelObjectListController::sortedModelObjects() {
+  if (!m_modelObjectsInitialized) {
+    // get objects by type
+    std::vector<WorkspaceObject> workspaceObjects = m_model.getObjectsByType(m_iddObjectType);
+
+    m_modelObjects.clear();
+    m_modelObjects.reserve(workspaceObjects.size());
+    for (const WorkspaceObject& workspaceObject : workspaceObjects) {
+      if (!workspaceObject.handle().isNull()) {
+        openstudio::model::ModelObject modelObject = workspaceObject.cast<openstudio::model::ModelObject>();
+        modelObject.getImpl<detail::IdfObject_Impl>()
+          .get()
+          ->detail::IdfObject_Impl::onNameChange.connect<ModelObjectListController, &ModelObjectListController::objectNameChanged>(this);
+        m_modelObjects.push_back(modelObject);
+      }
+    }
 
+    m_modelObjectsInitialized = true;
+    m_modelObjectsNeedSort = true;
+  }
+
+  if (m_modelObjectsNeedSort) {
     // sort by name
-    std::sort(bclresults.begin(), bclresults.end(), BCLComponentNameGreater());
+    std::sort(m_modelObjects.begin(), m_modelObjects.end(), WorkspaceObjectNameGreater());
+    m_modelObjectsNeedSort = false;
+  }
+
+  return m_modelObjects;
+}
+
+std::vector<OSItemId> ModelObjectListController::makeVector() {
+  std::vector<OSItemId> result;
+
+  if (m_showLocalBCL) {
+    // get BCL results, sorted by name
+    const std::vector<BCLComponent>& bclresults = LocalBCLComponentCache::instance().components(m_iddObjectType);
 
     for (auto it = bclresults.begin(); it != bclresults.end(); ++it) {
       result.push_back(bclComponentToItemId(*it));
     }
   }
 
-  // get objects by type
-  std::vector<WorkspaceObject> workspaceObjects = m_model.getObjectsByType(m_iddObjectType);
-
-  // sort by name
-  std::sort(workspaceObjects.begin(), workspaceObjects.end(), WorkspaceObjectNameGreater());
-
-  for (WorkspaceObject workspaceObject : workspaceObjects) {
-    if (!workspaceObject.handle().isNull()) {
-      openstudio::model::ModelObject modelObject = workspaceObject.cast<openstudio::model::ModelObject>();
+  for (const model::ModelObject& modelObject : sortedModelObjects()) {
+    if (!modelObject.handle().isNull()) {
       if (boost::optional<model::HVACComponent> hvacComponent = modelObject.optionalCast<model::HVACComponent>()) {
         if ((!hvacComponent->containingHVACComponent()) && (!hvacComponent->containingZoneHVACComponent())) {
           result.push_back(modelObjectToItemId(hvacComponent.get(), false));
@@ -37,6 +37,8 @@
 #include <openstudio/model/ModelObject.hpp>
 #include "../model_editor/QMetaTypes.hpp"
 
+class OpenStudioLibFixture;
+
 namespace openstudio {
 
 class ModelObjectListController : public OSVectorController
@@ -53,14 +55,30 @@ class ModelObjectListController : public OSVectorController
  private slots:
   void objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&);
   void objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&);
+  void localBCLChanged();
 
  protected:
   virtual std::vector<OSItemId> makeVector() override;
 
  private:
+  // for testing
+  friend class ::OpenStudioLibFixture;
+
+  // Sorted list of model objects of m_iddObjectType, built once and then maintained by objectAdded/objectRemoved/objectNameChanged
+  const std::vector<model::ModelObject>& sortedModelObjects();
+
+  void insertSorted(const model::ModelObject& modelObject);
+
+  // Nano slot connected to onNameChange of each object in the list
+  void objectNameChanged();
+
   openstudio::IddObjectType m_iddObjectType;
   model::Model m_model;
   bool m_showLocalBCL;
+
+  std::vector<model::ModelObject> m_modelObjects;
+  bool m_modelObjectsInitialized;
+  bool m_modelObjectsNeedSort;
 };
 
 class ModelObjectListView : public OSItemList
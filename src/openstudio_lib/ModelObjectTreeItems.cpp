@@ -150,7 +150,11 @@ OSItemType initializeOSItemType();
 
 ModelObjectTreeItem::ModelObjectTreeItem(const openstudio::model::ModelObject& modelObject, bool isDefaulted, OSItemType type,
                                          QTreeWidgetItem* parent)
-  : QTreeWidgetItem(parent), m_handle(modelObject.handle()), m_modelObject(modelObject), m_model(modelObject.model()), m_dirty(false) {
+  : QTreeWidgetItem(parent), m_handle(modelObject.handle()), m_modelObject(modelObject), m_model(modelObject.model()),
+    m_dirty(false),
+    m_hasLazyChildren(false),
+    m_childrenPopulated(false),
+    m_childrenDirty(false) {
   m_item = new ModelObjectItem(modelObject, isDefaulted, type);
   m_item->setVisible(false);
 
@@ -167,7 +171,7 @@ ModelObjectTreeItem::ModelObjectTreeItem(const openstudio::model::ModelObject& m
 }
 
 ModelObjectTreeItem::ModelObjectTreeItem(const std::string& name, const openstudio::model::Model& model, QTreeWidgetItem* parent)
-  : QTreeWidgetItem(parent), m_model(model), m_name(name), m_dirty(false) {
+  : QTreeWidgetItem(parent), m_model(model), m_name(name), m_dirty(false), m_hasLazyChildren(false), m_childrenPopulated(false), m_childrenDirty(false) {
   m_item = nullptr;
 
   this->setText(0, toQString(name));
@@ -283,9 +287,72 @@ void ModelObjectTreeItem::makeDirty() {
   m_dirty = true;
 }
 
+bool ModelObjectTreeItem::isPopulated() const {
+  return m_childrenPopulated;
+}
+
+bool ModelObjectTreeItem::hasChildren() const {
+  if (m_childrenPopulated && !m_childrenDirty) {
+    return (this->childCount() > 0);
+  }
+  if (!m_hasLazyChildren) {
+    return false;
+  }
+  return (!this->nonModelObjectChildren().empty() || !this->defaultedModelObjectChildren().empty() || !this->modelObjectChildren().empty());
+}
+
+void ModelObjectTreeItem::populateChildren() {
+  if (!m_hasLazyChildren) {
+    return;
+  }
+
+  if (!m_childrenPopulated) {
+    m_childrenPopulated = true;
+    m_childrenDirty = false;
+
+    for (const std::string& child : this->nonModelObjectChildren()) {
+      this->addNonModelObjectChild(child);
+    }
+    for (const model::ModelObject& child : this->defaultedModelObjectChildren()) {
+      this->addModelObjectChild(child, true);
+    }
+    for (const model::ModelObject& child : this->modelObjectChildren()) {
+      this->addModelObjectChild(child, false);
+    }
+
+    if (m_modelObject) {
+      // now that children exist, only show the indicator if there are any
+      this->setChildIndicatorPolicy(QTreeWidgetItem::DontShowIndicatorWhenChildless);
+    }
+
+    finalize();
+  } else if (m_childrenDirty) {
+    refreshChildren();
+  }
+}
+
 void ModelObjectTreeItem::refresh() {
   m_dirty = false;
 
+  if (!m_childrenPopulated) {
+    // nothing created yet, children will be up to date when first expanded
+    finalize();
+    return;
+  }
+
+  if (!this->isExpanded()) {
+    // collapsed branch, defer the update until it is expanded again
+    m_childrenDirty = true;
+    finalize();
+    return;
+  }
+
+  refreshChildren();
+}
+
+void ModelObjectTreeItem::refreshChildren() {
+  m_childrenDirty = false;
+
   std::vector<std::string> nonModelObjectChildren = this->nonModelObjectChildren();
   std::vector<model::ModelObject> defaultedModelObjectChildren = this->defaultedModelObjectChildren();
   std::vector<model::ModelObject> modelObjectChildren = this->modelObjectChildren();
@@ -539,15 +606,10 @@ void ModelObjectTreeItem::changeRelationship(int index, Handle newHandle, Handle
 }
 
 void ModelObjectTreeItem::makeChildren() {
-  for (const std::string& child : this->nonModelObjectChildren()) {
-    this->addNonModelObjectChild(child);
-  }
-  for (const model::ModelObject& child : this->defaultedModelObjectChildren()) {
-    this->addModelObjectChild(child, true);
-  }
-  for (const model::ModelObject& child : this->modelObjectChildren()) {
-    this->addModelObjectChild(child, false);
-  }
+  // building the whole tree up front is slow for large models, populateChildren does it when the item is expanded
+  m_hasLazyChildren = true;
+  m_childrenPopulated = false;
+  this->setChildIndicatorPolicy(QTreeWidgetItem::ShowIndicator);
 
   finalize();
 }
@@ -816,7 +878,7 @@ void NoBuildingStoryTreeItem::addModelObjectChild(const model::ModelObject& chil
 }
 
 void NoBuildingStoryTreeItem::finalize() {
-  if (this->childCount() == 0) {
+  if (!this->hasChildren()) {
     this->setDisabled(true);
     this->setStyle(2, "");
   } else {
@@ -889,7 +951,7 @@ void NoThermalZoneTreeItem::addModelObjectChild(const model::ModelObject& child,
 }
 
 void NoThermalZoneTreeItem::finalize() {
-  if (this->childCount() == 0) {
+  if (!this->hasChildren()) {
     this->setDisabled(true);
     this->setStyle(2, "");
   } else {
@@ -979,7 +1041,7 @@ void NoSpaceTypeTreeItem::addModelObjectChild(const model::ModelObject& child, b
 }
 
 void NoSpaceTypeTreeItem::finalize() {
-  if (this->childCount() == 0) {
+  if (!this->hasChildren()) {
     this->setDisabled(true);
     this->setStyle(2, "");
   } else {
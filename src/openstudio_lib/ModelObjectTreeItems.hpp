@@ -88,8 +88,17 @@ class ModelObjectTreeItem : public QObject, public QTreeWidgetItem, public Nano:
 
   void makeDirty();
 
+  // true once children have been created, children are only created when the item is first expanded
+  bool isPopulated() const;
+
+  // true if this item has or would have children once populated
+  bool hasChildren() const;
+
  public slots:
 
+  // create children if not done yet, or bring them up to date if they went stale while collapsed
+  void populateChildren();
+
   void refresh();
 
   void refreshTree();
@@ -99,9 +108,12 @@ class ModelObjectTreeItem : public QObject, public QTreeWidgetItem, public Nano:
   void changeRelationship(int index, Handle newHandle, Handle oldHandle);
 
  protected:
-  // make all child items
+  // mark this item as having children, they are created by populateChildren
   void makeChildren();
 
+  // add or remove children to match the model
+  void refreshChildren();
+
   // get any non-model object children that this item should have
   virtual std::vector<std::string> nonModelObjectChildren() const;
 
@@ -135,6 +147,9 @@ class ModelObjectTreeItem : public QObject, public QTreeWidgetItem, public Nano:
   std::string m_name;
   OSItem* m_item;
   bool m_dirty;
+  bool m_hasLazyChildren;
+  bool m_childrenPopulated;
+  bool m_childrenDirty;
 };
 
 ///////////////////// SiteShading ////////////////////////////////////////////////
@@ -57,6 +57,9 @@ ModelObjectTreeWidget::ModelObjectTreeWidget(const model::Model& model, QWidget*
 
   m_vLayout->addWidget(m_treeWidget);
 
+  // tree items create their children the first time they are expanded
+  connect(m_treeWidget, &QTreeWidget::itemExpanded, this, &ModelObjectTreeWidget::itemExpanded);
+
   // model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObjectPtr.connect<ModelObjectTreeWidget, &ModelObjectTreeWidget::objectAdded>(this);
   connect(OSAppBase::instance(), &OSAppBase::workspaceObjectAddedPtr, this, &ModelObjectTreeWidget::objectAdded, Qt::QueuedConnection);
 
@@ -91,6 +94,13 @@ void ModelObjectTreeWidget::objectRemoved(std::shared_ptr<openstudio::detail::Wo
   onObjectRemoved(impl->getObject<model::ModelObject>(), iddObjectType, handle);
 }
 
+void ModelObjectTreeWidget::itemExpanded(QTreeWidgetItem* item) {
+  ModelObjectTreeItem* modelObjectTreeItem = dynamic_cast<ModelObjectTreeItem*>(item);
+  if (modelObjectTreeItem) {
+    modelObjectTreeItem->populateChildren();
+  }
+}
+
 void ModelObjectTreeWidget::refresh() {
   int N = m_treeWidget->topLevelItemCount();
   for (int i = 0; i < N; ++i) {
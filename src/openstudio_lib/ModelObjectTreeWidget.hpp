@@ -37,6 +37,7 @@
 #include "../model_editor/QMetaTypes.hpp"
 
 class QTreeWidget;
+class QTreeWidgetItem;
 
 class QVBoxLayout;
 
@@ -76,6 +77,8 @@ class ModelObjectTreeWidget : public OSItemSelector, public Nano::Observer
   void objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl, const openstudio::IddObjectType& iddObjectType,
                      const openstudio::UUID& handle);
 
+  void itemExpanded(QTreeWidgetItem* item);
+
  private:
   QTreeWidget* m_treeWidget;
 
@@ -39,6 +39,8 @@
 #include "OSItem.hpp"
 #include "OSVectorController.hpp"
 
+#include "../shared_gui_components/ModelObjectChangeBatch.hpp"
+
 #include <openstudio/model/Component.hpp>
 #include <openstudio/model/ComponentData.hpp>
 #include <openstudio/model/ModelObject_Impl.hpp>
@@ -586,6 +588,9 @@ bool OSDropZone2::deleteObject() {
 }
 
 void OSDropZone2::refresh() {
+  if (ModelObjectChangeBatch::deferRefresh(this, [this]() { refresh(); })) {
+    return;
+  }
   boost::optional<model::ModelObject> modelObject = updateGetterResult();
 
   if (modelObject) {
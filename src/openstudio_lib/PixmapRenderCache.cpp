@@ -0,0 +1,127 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PixmapRenderCache.hpp"
+
+#include "IconLibrary.hpp"
+
+#include <QHash>
+#include <QPaintDevice>
+#include <QPainter>
+#include <QPixmapCache>
+#include <QTransform>
+
+#include <algorithm>
+#include <cmath>
+
+namespace openstudio {
+
+bool PixmapRenderCache::s_itemCachingEnabled = false;
+
+void PixmapRenderCache::drawPixmap(QPainter* painter, const QRectF& target, const QString& path, int rotation) {
+  QPixmap pixmap = PixmapRenderCache::pixmap(path, deviceSize(painter, target), rotation);
+
+  painter->drawPixmap(target, pixmap, QRectF(pixmap.rect()));
+}
+
+void PixmapRenderCache::drawIcon(QPainter* painter, const QRectF& target, unsigned iddObjectType) {
+  QString key = QString("icon:%1").arg(iddObjectType);
+
+  QSize size = deviceSize(painter, target);
+
+  QPixmap pixmap;
+  if (!QPixmapCache::find(cacheKey(key, 0, size), &pixmap)) {
+    if (const QPixmap* icon = IconLibrary::Instance().findIcon(iddObjectType)) {
+      pixmap = scaledPixmap(key, *icon, size, 0);
+    }
+  }
+
+  painter->drawPixmap(target, pixmap, QRectF(pixmap.rect()));
+}
+
+QPixmap PixmapRenderCache::pixmap(const QString& path, const QSize& deviceSize, int rotation) {
+  QPixmap pixmap;
+  if (QPixmapCache::find(cacheKey(path, rotation, deviceSize), &pixmap)) {
+    return pixmap;
+  }
+
+  // decoded images are few and small, they are kept for the lifetime of the application
+  static QHash<QString, QPixmap> sources;
+  auto it = sources.find(path);
+  if (it == sources.end()) {
+    it = sources.insert(path, QPixmap(path));
+  }
+
+  return scaledPixmap(path, it.value(), deviceSize, rotation);
+}
+
+void PixmapRenderCache::setItemCachingEnabled(bool enabled) {
+  s_itemCachingEnabled = enabled;
+}
+
+bool PixmapRenderCache::itemCachingEnabled() {
+  return s_itemCachingEnabled;
+}
+
+QPixmap PixmapRenderCache::scaledPixmap(const QString& key, const QPixmap& source, const QSize& deviceSize, int rotation) {
+  QPixmap result = source;
+
+  if (rotation % 360 != 0) {
+    result = result.transformed(QTransform().rotate(rotation), Qt::SmoothTransformation);
+  }
+
+  if (!result.isNull() && (result.size() != deviceSize)) {
+    result = result.scaled(deviceSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+  }
+
+  QPixmapCache::insert(cacheKey(key, rotation, deviceSize), result);
+
+  return result;
+}
+
+QString PixmapRenderCache::cacheKey(const QString& name, int rotation, const QSize& deviceSize) {
+  return QString("osapp:%1:%2:%3x%4").arg(name).arg(rotation).arg(deviceSize.width()).arg(deviceSize.height());
+}
+
+QSize PixmapRenderCache::deviceSize(QPainter* painter, const QRectF& target) {
+  // scale of the painter, whatever its rotation
+  QTransform transform = painter->worldTransform();
+  double sx = std::hypot(transform.m11(), transform.m12());
+  double sy = std::hypot(transform.m21(), transform.m22());
+
+  double pixelRatio = 1.0;
+  if (QPaintDevice* device = painter->device()) {
+    pixelRatio = device->devicePixelRatioF();
+  }
+
+  return QSize(std::max(1, static_cast<int>(std::lround(target.width() * sx * pixelRatio))),
+               std::max(1, static_cast<int>(std::lround(target.height() * sy * pixelRatio))));
+}
+
+}  // namespace openstudio
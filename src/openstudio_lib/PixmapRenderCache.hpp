@@ -0,0 +1,78 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_PIXMAPRENDERCACHE_HPP
+#define OPENSTUDIO_PIXMAPRENDERCACHE_HPP
+
+#include <QPixmap>
+#include <QRectF>
+#include <QString>
+
+class QPainter;
+
+namespace openstudio {
+
+/*! Shared cache of the pixmaps painted by the loop and service water diagram items.
+ *
+ * Images are decoded once, then rotated and scaled to the device size they are painted at, so that a paint call is a plain blit
+ * instead of loading, transforming and rescaling the source image every time. Entries live in QPixmapCache and are keyed by
+ * image, rotation and device size, so zooming in and out only adds a handful of entries per image.
+ */
+class PixmapRenderCache
+{
+ public:
+  //! Draws the image at path (e.g. ":/images/arrow.png") into target, rotated by rotation degrees
+  static void drawPixmap(QPainter* painter, const QRectF& target, const QString& path, int rotation = 0);
+
+  //! Draws the IconLibrary icon of an IddObjectType value into target
+  static void drawIcon(QPainter* painter, const QRectF& target, unsigned iddObjectType);
+
+  //! Returns the pixmap drawn by drawPixmap for a given device size
+  static QPixmap pixmap(const QString& path, const QSize& deviceSize, int rotation = 0);
+
+  /*! Opt-in QGraphicsItem::DeviceCoordinateCache for grid items created afterwards.
+   *  Their paint output only depends on state they call update() for, so they can be cached as device pixmaps.
+   */
+  static void setItemCachingEnabled(bool enabled);
+
+  static bool itemCachingEnabled();
+
+ private:
+  static QPixmap scaledPixmap(const QString& key, const QPixmap& source, const QSize& deviceSize, int rotation);
+
+  static QString cacheKey(const QString& name, int rotation, const QSize& deviceSize);
+
+  static QSize deviceSize(QPainter* painter, const QRectF& target);
+
+  static bool s_itemCachingEnabled;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_PIXMAPRENDERCACHE_HPP
@@ -70,123 +70,155 @@
 
 namespace openstudio {
 
-void RefrigerationController::refreshRefrigerationSystemView(RefrigerationSystemView* systemView,
-                                                             boost::optional<model::RefrigerationSystem>& system) {
+unsigned RefrigerationController::refreshRefrigerationSystemView(RefrigerationSystemView* systemView,
+                                                                 const boost::optional<model::RefrigerationSystem>& system,
+                                                                 RefrigerationController* controller) {
   OS_ASSERT(systemView);
 
+  unsigned createdDetailViews = 0;
+
   systemView->refrigerationCondenserView->setCondenserId(OSItemId());
   systemView->refrigerationSubCoolerView->setId(OSItemId());
   systemView->refrigerationSHXView->setId(OSItemId());
-  systemView->refrigerationCasesView->removeAllCaseDetailViews();
-  systemView->refrigerationCompressorView->removeAllCompressorDetailViews();
-  systemView->refrigerationSecondaryView->removeAllSecondaryDetailViews();
 
-  if (system) {
-    systemView->setId(OSItemId(toQString(system->handle()), QString(), false));
+  if (!system) {
+    systemView->refrigerationCasesView->removeAllCaseDetailViews();
+    systemView->refrigerationCompressorView->removeAllCompressorDetailViews();
+    systemView->refrigerationSecondaryView->removeAllSecondaryDetailViews();
 
-    if (boost::optional<model::RefrigerationSubcoolerLiquidSuction> subcooler = system->liquidSuctionHeatExchangerSubcooler()) {
-      systemView->refrigerationSHXView->setId(OSItemId(toQString(subcooler->handle()), QString(), false));
+    return createdDetailViews;
+  }
 
-      systemView->refrigerationSHXView->setName(QString::fromStdString(subcooler->name().get()));
-    }
+  systemView->setId(OSItemId(toQString(system->handle()), QString(), false));
 
-    if (boost::optional<model::RefrigerationSubcoolerMechanical> subcooler = system->mechanicalSubcooler()) {
-      systemView->refrigerationSubCoolerView->setId(OSItemId(toQString(subcooler->handle()), QString(), false));
+  if (boost::optional<model::RefrigerationSubcoolerLiquidSuction> subcooler = system->liquidSuctionHeatExchangerSubcooler()) {
+    systemView->refrigerationSHXView->setId(OSItemId(toQString(subcooler->handle()), QString(), false));
 
-      systemView->refrigerationSubCoolerView->setName(QString::fromStdString(subcooler->name().get()));
-    }
+    systemView->refrigerationSHXView->setName(QString::fromStdString(subcooler->name().get()));
+  }
+
+  if (boost::optional<model::RefrigerationSubcoolerMechanical> subcooler = system->mechanicalSubcooler()) {
+    systemView->refrigerationSubCoolerView->setId(OSItemId(toQString(subcooler->handle()), QString(), false));
+
+    systemView->refrigerationSubCoolerView->setName(QString::fromStdString(subcooler->name().get()));
+  }
 
-    if (boost::optional<model::ModelObject> condenser = system->refrigerationCondenser()) {
-      systemView->refrigerationCondenserView->setCondenserId(OSItemId(toQString(condenser->handle()), QString(), false));
+  if (boost::optional<model::ModelObject> condenser = system->refrigerationCondenser()) {
+    systemView->refrigerationCondenserView->setCondenserId(OSItemId(toQString(condenser->handle()), QString(), false));
 
-      systemView->refrigerationCondenserView->setCondenserName(QString::fromStdString(condenser->name().get()));
+    systemView->refrigerationCondenserView->setCondenserName(QString::fromStdString(condenser->name().get()));
 
-      const QPixmap* pixmap = IconLibrary::Instance().findIcon(condenser->iddObjectType().value());
-      systemView->refrigerationCondenserView->setIcon(*pixmap);
+    const QPixmap* pixmap = IconLibrary::Instance().findIcon(condenser->iddObjectType().value());
+    systemView->refrigerationCondenserView->setIcon(*pixmap);
+  }
+
+  // Detail views are keyed by handle, only the ones of newly added objects are created
+  // Each list is displayed last to first
+
+  // secondary systems
+
+  std::vector<std::pair<Handle, QGraphicsObject*>> secondaryDetailViews;
+
+  std::vector<model::RefrigerationCondenserCascade> cascadeCondensers = system->cascadeCondenserLoads();
+  for (auto it = cascadeCondensers.rbegin(); it != cascadeCondensers.rend(); ++it) {
+    QString name = QString::fromStdString(it->name().get());
+    Handle handle = it->handle();
+    if (boost::optional<model::RefrigerationSystem> t_cascadeSystem = cascadeSystem(*it)) {
+      name = QString::fromStdString(t_cascadeSystem->name().get());
+      handle = t_cascadeSystem->handle();
     }
 
-    // insert secondary systems
-
-    std::vector<model::RefrigerationCondenserCascade> cascadeCondensers = system->cascadeCondenserLoads();
-    for (auto it = cascadeCondensers.begin(); it != cascadeCondensers.end(); ++it) {
-      auto detailView = new SecondaryDetailView();
-      connect(detailView, &SecondaryDetailView::zoomInOnSystemClicked, this,
-              static_cast<void (RefrigerationController::*)(const Handle&)>(&RefrigerationController::zoomInOnSystem));
-      connect(detailView, &SecondaryDetailView::removeClicked, this, &RefrigerationController::removeLoad);
-      if (boost::optional<model::RefrigerationSystem> t_cascadeSystem = cascadeSystem(*it)) {
-        detailView->setName(QString::fromStdString(t_cascadeSystem->name().get()));
-        detailView->setHandle(t_cascadeSystem->handle());
-      } else {
-        detailView->setName(QString::fromStdString(it->name().get()));
-        detailView->setHandle(it->handle());
+    auto detailView = qobject_cast<SecondaryDetailView*>(systemView->refrigerationSecondaryView->secondaryDetailView(handle));
+    if (!detailView) {
+      detailView = new SecondaryDetailView();
+      if (controller) {
+        connect(detailView, &SecondaryDetailView::zoomInOnSystemClicked, controller,
+                static_cast<void (RefrigerationController::*)(const Handle&)>(&RefrigerationController::zoomInOnSystem));
+        connect(detailView, &SecondaryDetailView::removeClicked, controller, &RefrigerationController::removeLoad);
       }
-      systemView->refrigerationSecondaryView->insertSecondaryDetailView(0, detailView);
+      detailView->setHandle(handle);
+      ++createdDetailViews;
     }
+    detailView->setName(name);
 
-    // insert compressors
+    secondaryDetailViews.push_back(std::make_pair(handle, detailView));
+  }
 
-    std::vector<model::RefrigerationCompressor> compressors = system->compressors();
+  systemView->refrigerationSecondaryView->setSecondaryDetailViews(secondaryDetailViews);
 
-    int compressorIndex = 1;
+  // compressors
 
-    for (auto it = compressors.begin(); it != compressors.end(); ++it) {
-      auto detailView = new RefrigerationCompressorDetailView();
+  std::vector<std::pair<Handle, QGraphicsObject*>> compressorDetailViews;
 
-      detailView->setId(OSItemId(toQString(it->handle()), QString(), false));
+  std::vector<model::RefrigerationCompressor> compressors = system->compressors();
 
-      detailView->setLabel(QString::number(compressorIndex));
+  int compressorIndex = static_cast<int>(compressors.size());
 
-      connect(detailView, &RefrigerationCompressorDetailView::removeClicked, this, &RefrigerationController::removeCompressor);
+  for (auto it = compressors.rbegin(); it != compressors.rend(); ++it) {
+    auto detailView = qobject_cast<RefrigerationCompressorDetailView*>(systemView->refrigerationCompressorView->compressorDetailView(it->handle()));
+    if (!detailView) {
+      detailView = new RefrigerationCompressorDetailView();
 
-      connect(detailView, &RefrigerationCompressorDetailView::inspectClicked, this, &RefrigerationController::inspectOSItem);
+      detailView->setId(OSItemId(toQString(it->handle()), QString(), false));
 
-      systemView->refrigerationCompressorView->insertCompressorDetailView(0, detailView);
+      if (controller) {
+        connect(detailView, &RefrigerationCompressorDetailView::removeClicked, controller, &RefrigerationController::removeCompressor);
 
-      compressorIndex++;
+        connect(detailView, &RefrigerationCompressorDetailView::inspectClicked, controller, &RefrigerationController::inspectOSItem);
+      }
+      ++createdDetailViews;
     }
 
-    // insert cases
-
-    std::vector<model::RefrigerationCase> cases = system->cases();
+    detailView->setLabel(QString::number(compressorIndex));
 
-    systemView->refrigerationCasesView->setNumberOfDisplayCases(cases.size());
+    compressorDetailViews.push_back(std::make_pair(it->handle(), detailView));
 
-    for (auto it = cases.begin(); it != cases.end(); ++it) {
-      auto detailView = new RefrigerationCaseDetailView();
-
-      detailView->setId(OSItemId(toQString(it->handle()), QString(), false));
+    compressorIndex--;
+  }
 
-      detailView->setName(QString::fromStdString(it->name().get()));
+  systemView->refrigerationCompressorView->setCompressorDetailViews(compressorDetailViews);
 
-      connect(detailView, &RefrigerationCaseDetailView::removeClicked, this, &RefrigerationController::removeCase);
+  // cases and walkins, walkins are displayed first
 
-      connect(detailView, &RefrigerationCaseDetailView::inspectClicked, this, &RefrigerationController::inspectOSItem);
+  std::vector<std::pair<Handle, QGraphicsObject*>> caseDetailViews;
 
-      systemView->refrigerationCasesView->insertCaseDetailView(0, detailView);
-    }
+  auto caseDetailView = [&](const model::ModelObject& modelObject) {
+    auto detailView = qobject_cast<RefrigerationCaseDetailView*>(systemView->refrigerationCasesView->caseDetailView(modelObject.handle()));
+    if (!detailView) {
+      detailView = new RefrigerationCaseDetailView();
 
-    // insert walkins
+      detailView->setId(OSItemId(toQString(modelObject.handle()), QString(), false));
 
-    std::vector<model::RefrigerationWalkIn> walkins = system->walkins();
+      if (controller) {
+        connect(detailView, &RefrigerationCaseDetailView::removeClicked, controller, &RefrigerationController::removeCase);
 
-    systemView->refrigerationCasesView->setNumberOfWalkinCases(walkins.size());
+        connect(detailView, &RefrigerationCaseDetailView::inspectClicked, controller, &RefrigerationController::inspectOSItem);
+      }
+      ++createdDetailViews;
+    }
 
-    for (auto it = walkins.begin(); it != walkins.end(); ++it) {
-      auto detailView = new RefrigerationCaseDetailView();
+    detailView->setName(QString::fromStdString(modelObject.name().get()));
 
-      detailView->setId(OSItemId(toQString(it->handle()), QString(), false));
+    caseDetailViews.push_back(std::make_pair(modelObject.handle(), detailView));
+  };
 
-      detailView->setName(QString::fromStdString(it->name().get()));
+  std::vector<model::RefrigerationWalkIn> walkins = system->walkins();
+  for (auto it = walkins.rbegin(); it != walkins.rend(); ++it) {
+    caseDetailView(*it);
+  }
 
-      connect(detailView, &RefrigerationCaseDetailView::removeClicked, this, &RefrigerationController::removeCase);
+  std::vector<model::RefrigerationCase> cases = system->cases();
+  for (auto it = cases.rbegin(); it != cases.rend(); ++it) {
+    caseDetailView(*it);
+  }
 
-      connect(detailView, &RefrigerationCaseDetailView::inspectClicked, this, &RefrigerationController::inspectOSItem);
+  systemView->refrigerationCasesView->setNumberOfDisplayCases(cases.size());
+  systemView->refrigerationCasesView->setNumberOfWalkinCases(walkins.size());
+  systemView->refrigerationCasesView->setCaseDetailViews(caseDetailViews);
 
-      systemView->refrigerationCasesView->insertCaseDetailView(0, detailView);
-    }
+  systemView->adjustLayout();
 
-    systemView->adjustLayout();
-  }
+  return createdDetailViews;
 }
 
 RefrigerationController::RefrigerationController()
@@ -594,7 +626,7 @@ void RefrigerationController::refreshNow() {
   if (!m_dirty) return;
 
   if (m_detailView) {
-    refreshRefrigerationSystemView(m_detailView, m_currentSystem);
+    refreshRefrigerationSystemView(m_detailView, m_currentSystem, this);
   }
 
   m_dirty = false;
@@ -796,7 +828,7 @@ QGraphicsObject* RefrigerationSystemItemDelegate::view(QSharedPointer<OSListItem
     boost::optional<model::RefrigerationSystem> system = listItem->system();
     RefrigerationController* refrigerationController =
       qobject_cast<RefrigerationSystemListController*>(dataSource->controller())->refrigerationController();
-    refrigerationController->refreshRefrigerationSystemView(refrigerationSystemMiniView->refrigerationSystemView, system);
+    RefrigerationController::refreshRefrigerationSystemView(refrigerationSystemMiniView->refrigerationSystemView, system, refrigerationController);
     refrigerationSystemMiniView->adjustLayout();
 
     itemView = refrigerationSystemMiniView;
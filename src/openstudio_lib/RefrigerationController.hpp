@@ -73,7 +73,10 @@ class RefrigerationController : public QObject
   static boost::optional<model::RefrigerationSystem> cascadeSystem(const model::RefrigerationCondenserCascade& condenser);
   static boost::optional<model::RefrigerationSystem> supplySystem(const model::RefrigerationCondenserCascade& condenser);
 
-  void refreshRefrigerationSystemView(RefrigerationSystemView* systemView, boost::optional<model::RefrigerationSystem>& system);
+  // Sync systemView with system, detail views of objects already displayed are kept and only new ones are created
+  // Their remove and inspect signals are connected to controller if one is given, returns the number of detail views created
+  static unsigned refreshRefrigerationSystemView(RefrigerationSystemView* systemView, const boost::optional<model::RefrigerationSystem>& system,
+                                                 RefrigerationController* controller = nullptr);
 
  public slots:
 
@@ -509,29 +509,32 @@ QRectF RefrigerationCasesView::boundingRect() const {
   return QRectF(0, 0, _size.width(), _size.height());
 }
 
-void RefrigerationCasesView::insertCaseDetailView(int index, QGraphicsObject* object) {
+void RefrigerationCasesView::removeAllCaseDetailViews() {
   prepareGeometryChange();
 
-  m_caseDetailViews.insert(m_caseDetailViews.begin() + index, object);
-
-  object->setParentItem(this);
+  for (auto it = m_caseDetailViews.begin(); it != m_caseDetailViews.end();) {
+    delete *it;
 
-  if (m_expanded) {
-    object->show();
-  } else {
-    object->hide();
+    it = m_caseDetailViews.erase(it);
   }
 
+  m_caseDetailViewsByHandle.clear();
+
   adjustLayout();
 }
 
-void RefrigerationCasesView::removeAllCaseDetailViews() {
+QGraphicsObject* RefrigerationCasesView::caseDetailView(const Handle& handle) const {
+  auto it = m_caseDetailViewsByHandle.find(handle);
+  return (it != m_caseDetailViewsByHandle.end()) ? it->second : nullptr;
+}
+
+void RefrigerationCasesView::setCaseDetailViews(const std::vector<std::pair<Handle, QGraphicsObject*>>& detailViews) {
   prepareGeometryChange();
 
-  for (auto it = m_caseDetailViews.begin(); it != m_caseDetailViews.end();) {
-    delete *it;
+  setKeyedChildViews(this, detailViews, m_caseDetailViews, m_caseDetailViewsByHandle);
 
-    it = m_caseDetailViews.erase(it);
+  for (QGraphicsObject* view : m_caseDetailViews) {
+    view->setVisible(m_expanded);
   }
 
   adjustLayout();
@@ -836,24 +839,29 @@ double RefrigerationCompressorView::height() {
   return RefrigerationSystemView::componentHeight;
 }
 
-void RefrigerationCompressorView::insertCompressorDetailView(int index, QGraphicsObject* object) {
+void RefrigerationCompressorView::removeAllCompressorDetailViews() {
   prepareGeometryChange();
 
-  m_compressorDetailViews.insert(m_compressorDetailViews.begin() + index, object);
+  for (auto it = m_compressorDetailViews.begin(); it != m_compressorDetailViews.end();) {
+    delete *it;
+
+    it = m_compressorDetailViews.erase(it);
+  }
 
-  object->setParentItem(this);
+  m_compressorDetailViewsByHandle.clear();
 
   adjustLayout();
 }
 
-void RefrigerationCompressorView::removeAllCompressorDetailViews() {
-  prepareGeometryChange();
+QGraphicsObject* RefrigerationCompressorView::compressorDetailView(const Handle& handle) const {
+  auto it = m_compressorDetailViewsByHandle.find(handle);
+  return (it != m_compressorDetailViewsByHandle.end()) ? it->second : nullptr;
+}
 
-  for (auto it = m_compressorDetailViews.begin(); it != m_compressorDetailViews.end();) {
-    delete *it;
+void RefrigerationCompressorView::setCompressorDetailViews(const std::vector<std::pair<Handle, QGraphicsObject*>>& detailViews) {
+  prepareGeometryChange();
 
-    it = m_compressorDetailViews.erase(it);
-  }
+  setKeyedChildViews(this, detailViews, m_compressorDetailViews, m_compressorDetailViewsByHandle);
 
   adjustLayout();
 }
@@ -1185,19 +1193,25 @@ RefrigerationSecondaryView::RefrigerationSecondaryView() : QGraphicsObject() {
   adjustLayout();
 }
 
-void RefrigerationSecondaryView::insertSecondaryDetailView(int index, QGraphicsObject* object) {
-  m_secondaryDetailViews.insert(m_secondaryDetailViews.begin() + index, object);
-  object->setParentItem(this);
-
-  adjustLayout();
-}
-
 void RefrigerationSecondaryView::removeAllSecondaryDetailViews() {
   for (auto it = m_secondaryDetailViews.begin(); it != m_secondaryDetailViews.end();) {
     delete *it;
     it = m_secondaryDetailViews.erase(it);
   }
 
+  m_secondaryDetailViewsByHandle.clear();
+
+  adjustLayout();
+}
+
+QGraphicsObject* RefrigerationSecondaryView::secondaryDetailView(const Handle& handle) const {
+  auto it = m_secondaryDetailViewsByHandle.find(handle);
+  return (it != m_secondaryDetailViewsByHandle.end()) ? it->second : nullptr;
+}
+
+void RefrigerationSecondaryView::setSecondaryDetailViews(const std::vector<std::pair<Handle, QGraphicsObject*>>& detailViews) {
+  setKeyedChildViews(this, detailViews, m_secondaryDetailViews, m_secondaryDetailViewsByHandle);
+
   adjustLayout();
 }
 
@@ -37,6 +37,7 @@
 #include "../shared_gui_components/OSListView.hpp"
 #include "../shared_gui_components/GraphicsItems.hpp"
 #include <openstudio/utilities/idf/Handle.hpp>
+#include <map>
 
 class QGraphicsView;
 class QPushButton;
@@ -365,10 +366,14 @@ class RefrigerationCompressorView : public QGraphicsObject
 
   RefrigerationCompressorDropZoneView* refrigerationCompressorDropZoneView;
 
-  void insertCompressorDetailView(int index, QGraphicsObject* object);
-
   void removeAllCompressorDetailViews();
 
+  // Detail view of the compressor with this handle, nullptr if there is none
+  QGraphicsObject* compressorDetailView(const Handle& handle) const;
+
+  // Display these detail views in this order, detail views that are no longer listed are deleted
+  void setCompressorDetailViews(const std::vector<std::pair<Handle, QGraphicsObject*>>& detailViews);
+
   void adjustLayout();
 
   static double height();
@@ -378,6 +383,8 @@ class RefrigerationCompressorView : public QGraphicsObject
 
  private:
   std::vector<QGraphicsObject*> m_compressorDetailViews;
+
+  std::map<Handle, QGraphicsObject*> m_compressorDetailViewsByHandle;
 };
 
 class RefrigerationCasesDropZoneView : public RefrigerationSystemDropZoneView
@@ -468,10 +475,14 @@ class RefrigerationCasesView : public QGraphicsObject
 
   void setNumberOfWalkinCases(int number);
 
-  void insertCaseDetailView(int index, QGraphicsObject* object);
-
   void removeAllCaseDetailViews();
 
+  // Detail view of the case or walkin with this handle, nullptr if there is none
+  QGraphicsObject* caseDetailView(const Handle& handle) const;
+
+  // Display these detail views in this order, detail views that are no longer listed are deleted
+  void setCaseDetailViews(const std::vector<std::pair<Handle, QGraphicsObject*>>& detailViews);
+
   void adjustLayout();
 
   static QRectF displayCasesRect();
@@ -500,6 +511,8 @@ class RefrigerationCasesView : public QGraphicsObject
 
   std::vector<QGraphicsObject*> m_caseDetailViews;
 
+  std::map<Handle, QGraphicsObject*> m_caseDetailViewsByHandle;
+
   QPixmap m_displayCasesPixmap;
 
   QPixmap m_walkinPixmap;
@@ -671,10 +684,14 @@ class RefrigerationSecondaryView : public QGraphicsObject
 
   SecondaryDropZoneView* secondaryDropZoneView;
 
-  void insertSecondaryDetailView(int index, QGraphicsObject* object);
-
   void removeAllSecondaryDetailViews();
 
+  // Detail view of the secondary system with this handle, nullptr if there is none
+  QGraphicsObject* secondaryDetailView(const Handle& handle) const;
+
+  // Display these detail views in this order, detail views that are no longer listed are deleted
+  void setSecondaryDetailViews(const std::vector<std::pair<Handle, QGraphicsObject*>>& detailViews);
+
   void adjustLayout();
 
  protected:
@@ -682,6 +699,7 @@ class RefrigerationSecondaryView : public QGraphicsObject
 
  private:
   std::vector<QGraphicsObject*> m_secondaryDetailViews;
+  std::map<Handle, QGraphicsObject*> m_secondaryDetailViewsByHandle;
   int m_height;
 };
 
@@ -76,7 +76,10 @@
 #include <QTimer>
 #include <QVBoxLayout>
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <map>
+#include <set>
 
 #include <openstudio/utilities/idd/IddEnums.hxx>
 
@@ -1366,7 +1369,7 @@ void DayScheduleOverview::mouseReleaseEvent(QMouseEvent* event) {
 }
 
 DaySchedulePlotArea::DaySchedulePlotArea(ScheduleDayEditor* scheduleDayEditor)
-  : QGraphicsView(scheduleDayEditor), m_scheduleDayEditor(scheduleDayEditor), m_currentItem(nullptr), m_currentHoverItem(nullptr) {
+  : QGraphicsView(scheduleDayEditor), m_scheduleDayEditor(scheduleDayEditor), m_currentItem(nullptr), m_currentHoverItem(nullptr), m_edited(false) {
   connect(this, &DaySchedulePlotArea::dayScheduleSceneChanged, m_scheduleDayEditor->scheduleDayView()->schedulesView(),
           &SchedulesView::dayScheduleSceneChanged);
   setFocusPolicy(Qt::StrongFocus);
@@ -1519,6 +1522,8 @@ void DaySchedulePlotArea::mouseMoveEvent(QMouseEvent* event) {
 
       calendarItem->setValue(value);
 
+      m_edited = true;
+
       // Fixup next V item
 
       VCalendarSegmentItem* _nextVCalendarItem = calendarItem->nextVCalendarItem();
@@ -1580,6 +1585,8 @@ void DaySchedulePlotArea::mouseMoveEvent(QMouseEvent* event) {
 
         calendarItem->setTime(newTime);
 
+        m_edited = true;
+
         scene()->update();
       }
     }
@@ -1629,6 +1636,8 @@ void DaySchedulePlotArea::mousePressEvent(QMouseEvent* event) {
 
   m_currentItem = nullptr;
 
+  m_edited = false;
+
   m_currentHoverItem = nullptr;
   m_keyboardInputValue.clear();
   updateKeyboardPrompt();
@@ -1661,7 +1670,12 @@ void DaySchedulePlotArea::mouseReleaseEvent(QMouseEvent* event) {
     }
   }
 
-  emit dayScheduleSceneChanged(scene(), scene()->scheduleDayView()->lowerViewLimit(), scene()->scheduleDayView()->upperViewLimit());
+  // the whole drag is written to the model at once, and only if something moved
+  if (m_edited) {
+    emit dayScheduleSceneChanged(scene(), scene()->scheduleDayView()->lowerViewLimit(), scene()->scheduleDayView()->upperViewLimit());
+  }
+
+  m_edited = false;
 
   m_currentItem = nullptr;
 
@@ -1731,7 +1745,11 @@ DayScheduleScene::DayScheduleScene(ScheduleDayView* scheduleDayView, const model
     m_lowerScheduleTypeLimitItem(nullptr),
     m_scheduleDayView(scheduleDayView),
     m_scheduleDay(scheduleDay),
-    m_dirty(true) {
+    m_dirty(true),
+    m_upperViewLimit(0.0),
+    m_lowerViewLimit(0.0),
+    m_displayIP(false),
+    m_itemAllocationCount(0) {
   setSceneRect(0, 0, SCENEWIDTH, SCENEHEIGHT);
 
   m_scheduleDay.getImpl<model::detail::ScheduleDay_Impl>().get()->onChange.connect<DayScheduleScene, &DayScheduleScene::scheduleRefresh>(this);
@@ -1745,15 +1763,16 @@ model::ScheduleDay DayScheduleScene::scheduleDay() const {
 }
 
 void DayScheduleScene::scheduleRefresh() {
-  m_dirty = true;
+  // a commit adds several values in a row, one refresh is enough
+  if (!m_dirty) {
+    m_dirty = true;
 
-  QTimer::singleShot(0, this, &DayScheduleScene::refresh);
+    QTimer::singleShot(0, this, &DayScheduleScene::refresh);
+  }
 }
 
 void DayScheduleScene::refresh() {
   if (m_dirty) {
-    clearSegments();
-
     std::vector<openstudio::Time> times = m_scheduleDay.times();
 
     // Get the values as is
@@ -1808,29 +1827,56 @@ void DayScheduleScene::refresh() {
       lowerViewLimit = minvalue;  // - 0.05 * (maxvalue - minvalue);
     }
 
+    bool showUpperTypeLimit = false;
     if (upperTypeLimit) {
       double scaledValue = (*upperTypeLimit - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
       if (scaledValue > 0.0 && scaledValue < 1.0) {
-        m_upperScheduleTypeLimitItem = new ScheduleTypeLimitItem(true);
-        addItem(m_upperScheduleTypeLimitItem);
+        if (!m_upperScheduleTypeLimitItem) {
+          m_upperScheduleTypeLimitItem = new ScheduleTypeLimitItem(true);
+          addItem(m_upperScheduleTypeLimitItem);
+        }
         m_upperScheduleTypeLimitItem->setValue(scaledValue);
+        showUpperTypeLimit = true;
       }
     }
+    if (!showUpperTypeLimit && m_upperScheduleTypeLimitItem) {
+      delete m_upperScheduleTypeLimitItem;
+      m_upperScheduleTypeLimitItem = nullptr;
+    }
 
+    bool showLowerTypeLimit = false;
     if (lowerTypeLimit) {
       double scaledValue = (*lowerTypeLimit - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
       if (scaledValue > 0.0 && scaledValue < 1.0) {
-        m_lowerScheduleTypeLimitItem = new ScheduleTypeLimitItem(false);
-        addItem(m_lowerScheduleTypeLimitItem);
+        if (!m_lowerScheduleTypeLimitItem) {
+          m_lowerScheduleTypeLimitItem = new ScheduleTypeLimitItem(false);
+          addItem(m_lowerScheduleTypeLimitItem);
+        }
         m_lowerScheduleTypeLimitItem->setValue(scaledValue);
+        showLowerTypeLimit = true;
       }
     }
+    if (!showLowerTypeLimit && m_lowerScheduleTypeLimitItem) {
+      delete m_lowerScheduleTypeLimitItem;
+      m_lowerScheduleTypeLimitItem = nullptr;
+    }
+
+    // Reuse the existing segment items in order, only items whose time or value changed are touched
+    // segment tooltips show the full scale value and units
+    bool displayIP = m_scheduleDayView->schedulesView()->isIP();
+    bool viewChanged = (upperViewLimit != m_upperViewLimit) || (lowerViewLimit != m_lowerViewLimit) || (displayIP != m_displayIP);
+    m_upperViewLimit = upperViewLimit;
+    m_lowerViewLimit = lowerViewLimit;
+    m_displayIP = displayIP;
+
+    std::vector<bool> changed;
+    changed.reserve(times.size());
 
-    int i = 0;
     double lastTime = 0.0;
+    CalendarSegmentItem* segment = m_firstSegment;
     CalendarSegmentItem* previousSegment = nullptr;
 
-    for (auto it = times.begin(); it < times.end(); ++it) {
+    for (size_t i = 0; i < times.size(); ++i) {
       bool isOutOfTypeLimits = false;
       if (upperTypeLimit && (realvalues[i] > *upperTypeLimit)) {
         isOutOfTypeLimits = true;
@@ -1839,36 +1885,78 @@ void DayScheduleScene::refresh() {
       }
 
       double scaledValue = (realvalues[i] - lowerViewLimit) / (upperViewLimit - lowerViewLimit);
+      double time = times[i].totalSeconds();
+
+      bool isNew = false;
+      if (!segment) {
+        isNew = true;
+        segment = new CalendarSegmentItem();
+        addItem(segment);
+        ++m_itemAllocationCount;
+
+        if (previousSegment) {
+          auto vSegment = new VCalendarSegmentItem();
+          addItem(vSegment);
+          ++m_itemAllocationCount;
+
+          segment->setPreviousVCalendarItem(vSegment);
+          vSegment->setNextCalendarItem(segment);
+          vSegment->setPreviousCalendarItem(previousSegment);
+          previousSegment->setNextVCalendarItem(vSegment);
+        } else {
+          m_firstSegment = segment;
+        }
+      }
 
-      auto segment = new CalendarSegmentItem();
-      addItem(segment);
-      segment->setValue(scaledValue);
-      segment->setIsOutOfTypeLimits(isOutOfTypeLimits);
-      segment->setStartTime(lastTime);
-      double time = it->totalSeconds();
-      segment->setEndTime(time);
-
-      if (previousSegment) {
-        auto vSegment = new VCalendarSegmentItem();
-        addItem(vSegment);
-
-        segment->setPreviousVCalendarItem(vSegment);
-        vSegment->setNextCalendarItem(segment);
-        vSegment->setPreviousCalendarItem(previousSegment);
-        previousSegment->setNextVCalendarItem(vSegment);
-
-        vSegment->setTime(lastTime);
-
-        vSegment->updateLength();
-      } else {
-        m_firstSegment = segment;
+      bool segmentChanged = isNew || (segment->startTime() != lastTime) || (segment->endTime() != time);
+      if (isNew || viewChanged || (std::fabs(segment->value() - scaledValue) > 1e-12)) {
+        segment->setValue(scaledValue);
+        segmentChanged = true;
+      }
+      if (segmentChanged) {
+        segment->setStartTime(lastTime);
+        segment->setEndTime(time);
       }
+      if (segment->isOutOfTypeLimits() != isOutOfTypeLimits) {
+        segment->setIsOutOfTypeLimits(isOutOfTypeLimits);
+        segment->update();
+      }
+      changed.push_back(segmentChanged);
 
       previousSegment = segment;
+      segment = segment->nextCalendarItem();
 
       lastTime = time;
+    }
+
+    // Drop the segments the schedule does not have anymore
+    if (previousSegment) {
+      if (VCalendarSegmentItem* vSegment = previousSegment->nextVCalendarItem()) {
+        previousSegment->setNextVCalendarItem(nullptr);
+        delete vSegment;
+      }
+    }
+    while (segment) {
+      CalendarSegmentItem* nextSegment = segment->nextCalendarItem();
+      if (VCalendarSegmentItem* vSegment = segment->nextVCalendarItem()) {
+        delete vSegment;
+      }
+      delete segment;
+      segment = nextSegment;
+    }
+    if (!previousSegment) {
+      m_firstSegment = nullptr;
+    }
 
-      i++;
+    // Vertical items only move when one of their neighbors did
+    segment = m_firstSegment;
+    for (size_t i = 0; segment; ++i) {
+      VCalendarSegmentItem* vSegment = segment->previousVCalendarItem();
+      if (vSegment && (changed[i] || changed[i - 1])) {
+        vSegment->setTime(segment->startTime());
+        vSegment->updateLength();
+      }
+      segment = segment->nextCalendarItem();
     }
 
     m_scheduleDayView->update();
@@ -1924,6 +2012,8 @@ CalendarSegmentItem* DayScheduleScene::addSegment(double untilTime) {
 
   addItem(vitem);
 
+  m_itemAllocationCount += 2;
+
   vitem->setPreviousCalendarItem(item);
 
   vitem->setNextCalendarItem(segment);
@@ -1979,6 +2069,69 @@ void DayScheduleScene::clearSegments() {
   m_lowerScheduleTypeLimitItem = nullptr;
 }
 
+unsigned DayScheduleScene::commitSegments(double lowerLimitValue, double upperLimitValue) {
+  boost::optional<Unit> units = m_scheduleDayView->units();
+
+  boost::optional<Unit> siUnits;
+  if (units) {
+    if (boost::optional<model::ScheduleTypeLimits> _scheduleTypeLimits = m_scheduleDay.scheduleTypeLimits()) {
+      siUnits = _scheduleTypeLimits->units(false);
+    }
+  }
+
+  // time/value pairs as stored in the model, keyed by whole seconds
+  std::map<long, std::pair<openstudio::Time, double>> existing;
+  std::vector<openstudio::Time> times = m_scheduleDay.times();
+  std::vector<double> values = m_scheduleDay.values();
+  for (size_t i = 0; i < times.size(); ++i) {
+    existing.emplace(std::lround(times[i].totalSeconds()), std::make_pair(times[i], values[i]));
+  }
+
+  unsigned numWrites = 0;
+
+  std::set<long> kept;
+  for (const CalendarSegmentItem* segment : segments()) {
+    openstudio::Time time(0, 0, 0, segment->endTime());
+
+    double value = lowerLimitValue + segment->value() * (upperLimitValue - lowerLimitValue);
+
+    if (units && siUnits && (units.get() != siUnits.get())) {
+      Quantity q = Quantity(value, units.get());
+      OptionalQuantity result = openstudio::convert(q, siUnits.get());
+      OS_ASSERT(result);
+      value = result.get().value();
+    }
+
+    long key = std::lround(time.totalSeconds());
+    kept.insert(key);
+
+    // values that only went through the scene round trip are left alone
+    auto it = existing.find(key);
+    if (it != existing.end()) {
+      double oldValue = it->second.second;
+      if (std::fabs(oldValue - value) <= 1e-9 * std::max({1.0, std::fabs(oldValue), std::fabs(value)})) {
+        continue;
+      }
+    }
+
+    m_scheduleDay.addValue(time, value);
+    ++numWrites;
+  }
+
+  for (const auto& [key, timeValue] : existing) {
+    if (kept.find(key) == kept.end()) {
+      m_scheduleDay.removeValue(timeValue.first);
+      ++numWrites;
+    }
+  }
+
+  return numWrites;
+}
+
+unsigned DayScheduleScene::itemAllocationCount() const {
+  return m_itemAllocationCount;
+}
+
 std::vector<CalendarSegmentItem*> DayScheduleScene::segments() const {
   std::vector<CalendarSegmentItem*> result;
 
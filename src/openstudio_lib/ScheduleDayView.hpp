@@ -311,6 +311,13 @@ class DayScheduleScene : public QGraphicsScene, public Nano::Observer
 
   std::vector<CalendarSegmentItem*> segments() const;
 
+  // Writes the segments back to the schedule day, only the time/value pairs that differ from the model are touched
+  // returns the number of values added, replaced or removed
+  unsigned commitSegments(double lowerLimitValue, double upperLimitValue);
+
+  // number of segment items created by this scene so far
+  unsigned itemAllocationCount() const;
+
   CalendarSegmentItem* segmentAt(double time) const;
 
   boost::optional<double> valueAt(double time) const;
@@ -341,6 +348,14 @@ class DayScheduleScene : public QGraphicsScene, public Nano::Observer
   model::ScheduleDay m_scheduleDay;
 
   bool m_dirty;
+
+  double m_upperViewLimit;
+
+  double m_lowerViewLimit;
+
+  bool m_displayIP;
+
+  unsigned m_itemAllocationCount;
 };
 
 class DaySchedulePlotArea : public QGraphicsView
@@ -391,6 +406,9 @@ class DaySchedulePlotArea : public QGraphicsView
   QString m_keyboardInputValue;
 
   QPointF m_lastScenePos;
+
+  // set while the current drag has moved a segment
+  bool m_edited;
 };
 
 class DayScheduleOverview : public QWidget
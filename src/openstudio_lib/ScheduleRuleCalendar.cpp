@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ScheduleRuleCalendar.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleRule.hpp>
+#include <openstudio/model/YearDescription.hpp>
+#include <openstudio/model/YearDescription_Impl.hpp>
+
+#include <openstudio/utilities/core/UUID.hpp>
+#include <openstudio/utilities/idd/OS_Schedule_Rule_FieldEnums.hxx>
+#include <openstudio/utilities/time/Date.hpp>
+
+namespace openstudio {
+
+ScheduleRuleCalendar::ScheduleRuleCalendar(const model::ScheduleRuleset& scheduleRuleset)
+  : m_scheduleRuleset(scheduleRuleset), m_computeCount(0) {
+  refresh();
+}
+
+model::ScheduleRuleset ScheduleRuleCalendar::scheduleRuleset() const {
+  return m_scheduleRuleset;
+}
+
+bool ScheduleRuleCalendar::refresh() {
+  std::vector<std::string> newSignature = signature();
+  if ((m_computeCount > 0) && (newSignature == m_signature)) {
+    return false;
+  }
+
+  int year = m_scheduleRuleset.model().getUniqueModelObject<model::YearDescription>().assumedYear();
+
+  Date startDate(1, 1, year);
+  Date endDate(12, 31, year);
+
+  m_activeRuleIndices = m_scheduleRuleset.getActiveRuleIndices(startDate, endDate);
+  m_signature = std::move(newSignature);
+  ++m_computeCount;
+
+  return true;
+}
+
+const std::vector<int>& ScheduleRuleCalendar::activeRuleIndices() const {
+  return m_activeRuleIndices;
+}
+
+unsigned ScheduleRuleCalendar::computeCount() const {
+  return m_computeCount;
+}
+
+std::vector<std::string> ScheduleRuleCalendar::signature() const {
+  std::vector<std::string> result;
+
+  int year = m_scheduleRuleset.model().getUniqueModelObject<model::YearDescription>().assumedYear();
+  result.push_back(std::to_string(year));
+
+  // rules are returned in priority order, every field but the name and the day schedule matters
+  for (const auto& scheduleRule : m_scheduleRuleset.scheduleRules()) {
+    std::string ruleSignature = toString(scheduleRule.handle());
+    for (unsigned i = 0; i < scheduleRule.numFields(); ++i) {
+      if ((i == OS_Schedule_RuleFields::Name) || (i == OS_Schedule_RuleFields::DayScheduleName)) {
+        continue;
+      }
+      ruleSignature += ';';
+      ruleSignature += scheduleRule.getString(i, true).get_value_or("");
+    }
+    result.push_back(std::move(ruleSignature));
+  }
+
+  return result;
+}
+
+}  // namespace openstudio
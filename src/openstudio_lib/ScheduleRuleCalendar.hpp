@@ -0,0 +1,73 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_SCHEDULERULECALENDAR_HPP
+#define OPENSTUDIO_SCHEDULERULECALENDAR_HPP
+
+#include <openstudio/model/ScheduleRuleset.hpp>
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+// Active rule index for each day of the assumed year of a ScheduleRuleset, -1 where the default day applies
+// only recomputed when a rule's dates, day of week flags or priority change, or rules are added or removed
+class ScheduleRuleCalendar
+{
+ public:
+  explicit ScheduleRuleCalendar(const model::ScheduleRuleset& scheduleRuleset);
+
+  model::ScheduleRuleset scheduleRuleset() const;
+
+  // returns true if the active rule indices were recomputed
+  bool refresh();
+
+  // indexed by day of year - 1
+  const std::vector<int>& activeRuleIndices() const;
+
+  // number of times the active rule indices have been computed
+  unsigned computeCount() const;
+
+ private:
+  // everything in the rules that affects which rule is active on a given day
+  std::vector<std::string> signature() const;
+
+  model::ScheduleRuleset m_scheduleRuleset;
+
+  std::vector<std::string> m_signature;
+
+  std::vector<int> m_activeRuleIndices;
+
+  unsigned m_computeCount;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_SCHEDULERULECALENDAR_HPP
@@ -215,37 +215,7 @@ void SchedulesTabController::addHolidayProfile(model::ScheduleRuleset& scheduleR
 }
 
 void SchedulesTabController::onDayScheduleSceneChanged(DayScheduleScene* scene, double lowerLimitValue, double upperLimitValue) {
-  std::vector<CalendarSegmentItem*> segments = scene->segments();
-
-  model::ScheduleDay scheduleDay = scene->scheduleDay();
-
-  OptionalUnit units = scene->scheduleDayView()->units();
-
-  scheduleDay.clearValues();
-
-  for (auto it = segments.begin(); it < segments.end(); ++it) {
-    openstudio::Time time(0, 0, 0, (*it)->endTime());
-
-    double scaledvalue = (*it)->value();
-
-    double value = lowerLimitValue + scaledvalue * (upperLimitValue - lowerLimitValue);
-
-    if (units) {
-      // Now, if we need and can convert, we do it
-      if (boost::optional<model::ScheduleTypeLimits> _scheduleTypeLimits = scheduleDay.scheduleTypeLimits()) {
-
-        boost::optional<Unit> _siUnits = _scheduleTypeLimits->units(false);
-        if (units.get() != _siUnits.get()) {
-          Quantity q = Quantity(value, units.get());
-          OptionalQuantity result = openstudio::convert(q, _siUnits.get());
-          OS_ASSERT(result);
-          value = result.get().value();
-        }
-      }
-    }
-
-    scheduleDay.addValue(time, value);
-  }
+  scene->commitSegments(lowerLimitValue, upperLimitValue);
 }
 
 void SchedulesTabController::onStartDateTimeChanged(model::ScheduleRule& scheduleRule, const QDateTime& newDate) {
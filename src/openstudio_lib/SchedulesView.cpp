@@ -111,7 +111,7 @@ std::vector<QColor> SchedulesView::initializeColors() {
 }
 
 SchedulesView::SchedulesView(bool isIP, const model::Model& model)
-  : QWidget(), m_model(model), m_leftVLayout(nullptr), m_contentLayout(nullptr), m_isIP(isIP) {
+  : QWidget(), m_model(model), m_leftVLayout(nullptr), m_contentLayout(nullptr), m_isIP(isIP), m_currentTab(nullptr) {
   setObjectName("GrayWidgetWithLeftTopBorders");
 
   auto mainHLayout = new QHBoxLayout();
@@ -203,20 +203,17 @@ SchedulesView::SchedulesView(bool isIP, const model::Model& model)
 }
 
 void SchedulesView::closeAllTabs() const {
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    ScheduleTab* scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
-
-    scheduleTab->scheduleTabContent()->hide();
+  for (const auto& [handle, scheduleTab] : m_scheduleTabs) {
+    if (ScheduleTabContent* content = scheduleTab->scheduleTabContent()) {
+      content->hide();
+    }
   }
 }
 
 ScheduleTab* SchedulesView::tabForSchedule(const model::ScheduleRuleset schedule) const {
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    ScheduleTab* scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
-
-    if (scheduleTab->schedule().handle() == schedule.handle()) {
-      return scheduleTab;
-    }
+  auto it = m_scheduleTabs.find(schedule.handle());
+  if (it != m_scheduleTabs.end()) {
+    return it->second;
   }
 
   return nullptr;
@@ -252,6 +249,7 @@ void SchedulesView::addSchedule(model::ScheduleRuleset& schedule) {
   auto scheduleTab = new ScheduleTab(schedule, this);
   connect(scheduleTab, &ScheduleTab::scheduleClicked, this, &SchedulesView::setCurrentSchedule);
   m_leftVLayout->insertWidget(0, scheduleTab);
+  m_scheduleTabs[schedule.handle()] = scheduleTab;
 }
 
 void SchedulesView::addScheduleRule(model::ScheduleRule& scheduleRule) {
@@ -260,11 +258,9 @@ void SchedulesView::addScheduleRule(model::ScheduleRule& scheduleRule) {
   ScheduleTab* tab = tabForSchedule(scheduleRuleset);
 
   if (tab) {
-    tab->scheduleTabContent()->scheduleRefresh(scheduleRuleset.handle());  // Handle as dummy
+    tab->scheduleRefresh(scheduleRuleset.handle());  // Handle as dummy
 
-    scheduleRule.getImpl<model::detail::ScheduleRule_Impl>()
-      .get()
-      ->onRemoveFromWorkspace.connect<ScheduleTabContent, &ScheduleTabContent::scheduleRefresh>(tab->scheduleTabContent());
+    scheduleRule.getImpl<model::detail::ScheduleRule_Impl>().get()->onRemoveFromWorkspace.connect<ScheduleTab, &ScheduleTab::scheduleRefresh>(tab);
   }
 }
 
@@ -273,6 +269,7 @@ void SchedulesView::onModelObjectAdded(std::shared_ptr<openstudio::detail::Works
   boost::optional<model::ScheduleRuleset> schedule = m_model.getModelObject<model::ScheduleRuleset>(workspaceObjectImpl->handle());
   if (schedule) {
     this->addSchedule(schedule.get());
+    this->updateRowColors();
     this->setCurrentSchedule(schedule.get());
   }
 
@@ -293,15 +290,20 @@ void SchedulesView::onModelObjectRemoved(std::shared_ptr<openstudio::detail::Wor
 
     ScheduleTab* scheduleTab = nullptr;
 
-    for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-      scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
-      if (scheduleTab->schedule().handle() == workspaceObjectImpl->handle()) {
-        m_leftVLayout->removeWidget(scheduleTab);
-        wasSelected = scheduleTab->selected();
-        removedIndex = i;
-        delete scheduleTab;
-        break;
+    evictScheduleView(workspaceObjectImpl->handle());
+
+    auto it = m_scheduleTabs.find(workspaceObjectImpl->handle());
+    if (it != m_scheduleTabs.end()) {
+      scheduleTab = it->second;
+      m_scheduleTabs.erase(it);
+      removedIndex = m_leftVLayout->indexOf(scheduleTab);
+      m_leftVLayout->removeWidget(scheduleTab);
+      wasSelected = scheduleTab->selected();
+      if (scheduleTab == m_currentTab) {
+        m_currentTab = nullptr;
       }
+      delete scheduleTab;
+      updateRowColors();
     }
 
     if (wasSelected) {
@@ -330,30 +332,31 @@ void SchedulesView::onModelObjectRemoved(std::shared_ptr<openstudio::detail::Wor
 }
 
 void SchedulesView::setCurrentSchedule(const model::ScheduleRuleset& schedule) {
-  this->updateRowColors();
+  ScheduleTab* scheduleTab = tabForSchedule(schedule);
 
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    ScheduleTab* scheduleTab;
+  // Only the previously selected tab can be expanded, no need to visit every tab
+  if (m_currentTab && m_currentTab != scheduleTab) {
+    m_currentTab->setSelected(false);
 
-    scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
+    m_currentTab->collapse();
 
-    if (scheduleTab->schedule() == schedule) {
-      if (!scheduleTab->selected()) {
-        scheduleTab->setSelected(true);
+    m_currentTab->update();
+  }
 
-        scheduleTab->expand();
-      } else {
-        scheduleTab->toggle();
-      }
-    } else {
-      scheduleTab->setSelected(false);
+  if (scheduleTab) {
+    if (!scheduleTab->selected()) {
+      scheduleTab->setSelected(true);
 
-      scheduleTab->collapse();
+      scheduleTab->expand();
+    } else {
+      scheduleTab->toggle();
     }
 
     scheduleTab->update();
   }
 
+  m_currentTab = scheduleTab;
+
   //showScheduleRuleset(schedule);
 
   // DLM: I don't think that the code below works because it gets called when the scene is not visible
@@ -363,12 +366,7 @@ void SchedulesView::setCurrentSchedule(const model::ScheduleRuleset& schedule) {
 void SchedulesView::showAddRulePage(const model::ScheduleRuleset& scheduleRuleset) {
   this->setUpdatesEnabled(false);
 
-  QLayoutItem* child;
-  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
-    delete child->widget();
-
-    delete child;
-  }
+  clearContent();
 
   auto newProfileView = new NewProfileView(scheduleRuleset, this, NewProfileView::SCHEDULERULE);
 
@@ -383,12 +381,7 @@ void SchedulesView::showAddRulePage(const model::ScheduleRuleset& scheduleRulese
 void SchedulesView::showScheduleRuleset(const model::ScheduleRuleset& schedule) {
   this->setUpdatesEnabled(false);
 
-  QLayoutItem* child;
-  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
-    delete child->widget();
-
-    delete child;
-  }
+  clearContent();
 
   auto scheduleRulesetNameView = new ScheduleRulesetNameView(schedule, this);
   m_contentLayout->addWidget(scheduleRulesetNameView, 100);
@@ -402,12 +395,7 @@ void SchedulesView::showScheduleRuleset(const model::ScheduleRuleset& schedule)
 void SchedulesView::showScheduleRule(model::ScheduleRule scheduleRule) {
   setUpdatesEnabled(false);
 
-  QLayoutItem* child;
-  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
-    delete child->widget();
-
-    delete child;
-  }
+  clearContent();
 
   auto scheduleView = new ScheduleRuleView(m_isIP, scheduleRule, this);
 
@@ -432,15 +420,28 @@ void SchedulesView::onScheduleRuleRemoved(const Handle& handle) {
 void SchedulesView::showDefaultScheduleDay(const model::ScheduleRuleset& schedule) {
   setUpdatesEnabled(false);
 
-  QLayoutItem* child;
-  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
-    delete child->widget();
-    delete child;
-  }
+  clearContent();
+
+  DefaultScheduleDayView* scheduleView = nullptr;
+
+  auto it = std::find_if(m_recentScheduleViews.begin(), m_recentScheduleViews.end(),
+                         [&schedule](const auto& recent) { return recent.first == schedule.handle(); });
+  if (it != m_recentScheduleViews.end()) {
+    scheduleView = it->second;
+    m_recentScheduleViews.splice(m_recentScheduleViews.begin(), m_recentScheduleViews, it);
+  } else {
+    scheduleView = new DefaultScheduleDayView(m_isIP, schedule, this);
+
+    connect(this, &SchedulesView::toggleUnitsClicked, scheduleView, &DefaultScheduleDayView::toggleUnitsClicked);
 
-  auto scheduleView = new DefaultScheduleDayView(m_isIP, schedule, this);
+    m_recentScheduleViews.emplace_front(schedule.handle(), scheduleView);
 
-  connect(this, &SchedulesView::toggleUnitsClicked, scheduleView, &DefaultScheduleDayView::toggleUnitsClicked);
+    while (m_recentScheduleViews.size() > maxRecentScheduleViews) {
+      // The least recently viewed one is not in the content area anymore
+      m_recentScheduleViews.back().second->deleteLater();
+      m_recentScheduleViews.pop_back();
+    }
+  }
 
   m_contentLayout->addWidget(scheduleView);
 
@@ -455,12 +456,7 @@ void SchedulesView::showDefaultScheduleDay(const model::ScheduleRuleset& schedul
 void SchedulesView::showSummerScheduleDay(model::ScheduleRuleset schedule) {
   setUpdatesEnabled(false);
 
-  QLayoutItem* child;
-  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
-    delete child->widget();
-
-    delete child;
-  }
+  clearContent();
 
   if (!schedule.isSummerDesignDayScheduleDefaulted()) {
 
@@ -489,12 +485,7 @@ void SchedulesView::showSummerScheduleDay(model::ScheduleRuleset schedule) {
 void SchedulesView::showWinterScheduleDay(model::ScheduleRuleset schedule) {
   setUpdatesEnabled(false);
 
-  QLayoutItem* child;
-  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
-    delete child->widget();
-
-    delete child;
-  }
+  clearContent();
 
   if (!schedule.isWinterDesignDayScheduleDefaulted()) {
     auto scheduleView = new SpecialScheduleDayView(m_isIP, schedule, this, SpecialScheduleDayView::WINTER);
@@ -522,12 +513,7 @@ void SchedulesView::showWinterScheduleDay(model::ScheduleRuleset schedule) {
 void SchedulesView::showHolidayScheduleDay(model::ScheduleRuleset schedule) {
   setUpdatesEnabled(false);
 
-  QLayoutItem* child;
-  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
-    delete child->widget();
-
-    delete child;
-  }
+  clearContent();
 
   if (!schedule.isHolidayScheduleDefaulted()) {
     auto scheduleView = new SpecialScheduleDayView(m_isIP, schedule, this, SpecialScheduleDayView::HOLIDAY);
@@ -555,11 +541,7 @@ void SchedulesView::showHolidayScheduleDay(model::ScheduleRuleset schedule) {
 void SchedulesView::showEmptyPage() {
   this->setUpdatesEnabled(false);
 
-  QLayoutItem* child;
-  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
-    delete child->widget();
-    delete child;
-  }
+  clearContent();
 
   auto emptyWidget = new QWidget();
 
@@ -572,17 +554,10 @@ void SchedulesView::showEmptyPage() {
 }
 
 boost::optional<model::ScheduleRuleset> SchedulesView::currentSchedule() {
-  for (int i = 0; i < m_leftVLayout->count() - 1; i++) {
-    ScheduleTab* scheduleTab;
-
-    scheduleTab = qobject_cast<ScheduleTab*>(m_leftVLayout->itemAt(i)->widget());
-
-    if (scheduleTab->selected()) {
-      if (boost::optional<model::ScheduleRuleset> schedule = scheduleTab->schedule()) {
-        if (!schedule->handle().isNull()) {
-          return schedule;
-        }
-      }
+  if (m_currentTab && m_currentTab->selected()) {
+    model::ScheduleRuleset schedule = m_currentTab->schedule();
+    if (!schedule.handle().isNull()) {
+      return schedule;
     }
   }
 
@@ -606,6 +581,35 @@ bool SchedulesView::isIP() const {
   return m_isIP;
 }
 
+void SchedulesView::clearContent() {
+  QLayoutItem* child;
+  while ((child = m_contentLayout->takeAt(0)) != nullptr) {
+    QWidget* widget = child->widget();
+
+    auto isRecent = [widget](const auto& recent) { return recent.second == widget; };
+    if (widget && std::any_of(m_recentScheduleViews.begin(), m_recentScheduleViews.end(), isRecent)) {
+      widget->hide();
+    } else {
+      delete widget;
+    }
+
+    delete child;
+  }
+}
+
+void SchedulesView::evictScheduleView(const Handle& handle) {
+  auto it = std::find_if(m_recentScheduleViews.begin(), m_recentScheduleViews.end(),
+                         [&handle](const auto& recent) { return recent.first == handle; });
+  if (it != m_recentScheduleViews.end()) {
+    DefaultScheduleDayView* scheduleView = it->second;
+    m_recentScheduleViews.erase(it);
+
+    m_contentLayout->removeWidget(scheduleView);
+    scheduleView->hide();
+    scheduleView->deleteLater();
+  }
+}
+
 /******************************************************************************/
 // ScheduleTab
 /******************************************************************************/
@@ -614,6 +618,7 @@ ScheduleTab::ScheduleTab(const model::ScheduleRuleset& schedule, SchedulesView*
   : QWidget(parent),
     //m_mouseDown(false),
     m_selected(false),
+    m_content(nullptr),
     m_schedule(schedule),
     m_schedulesView(schedulesView) {
   auto mainVLayout = new QVBoxLayout();
@@ -630,24 +635,34 @@ ScheduleTab::ScheduleTab(const model::ScheduleRuleset& schedule, SchedulesView*
   line1->setFixedHeight(1);
   mainVLayout->addWidget(line1);
 
-  m_content = new ScheduleTabContent(this);
-  mainVLayout->addWidget(m_content);
-  m_content->setVisible(false);
-
   auto line2 = new QFrame();
   line2->setFrameShape(QFrame::HLine);
   line2->setFixedHeight(1);
   mainVLayout->addWidget(line2);
 }
 
+ScheduleTabContent* ScheduleTab::createContent() {
+  if (!m_content) {
+    m_content = new ScheduleTabContent(this);
+    m_content->setVisible(false);
+
+    // between the two separator lines
+    qobject_cast<QVBoxLayout*>(layout())->insertWidget(2, m_content);
+  }
+
+  return m_content;
+}
+
 void ScheduleTab::expand() {
-  m_content->show();
+  createContent()->show();
 
   m_header->expand();
 }
 
 void ScheduleTab::collapse() {
-  m_content->hide();
+  if (m_content) {
+    m_content->hide();
+  }
 
   m_header->collapse();
 }
@@ -655,7 +670,14 @@ void ScheduleTab::collapse() {
 void ScheduleTab::toggle() {
   m_header->toggle();
 
-  m_content->setVisible(!m_content->isVisible());
+  ScheduleTabContent* content = createContent();
+  content->setVisible(!content->isVisible());
+}
+
+void ScheduleTab::scheduleRefresh(const Handle& handle) {
+  if (m_content) {
+    m_content->scheduleRefresh(handle);
+  }
 }
 
 ScheduleTabHeader* ScheduleTab::scheduleTabHeader() const {
@@ -864,7 +886,8 @@ void ScheduleTabHeader::paintEvent(QPaintEvent* event) {
 // ScheduleTabContent
 /******************************************************************************/
 
-ScheduleTabContent::ScheduleTabContent(ScheduleTab* scheduleTab, QWidget* parent) : QWidget(parent), m_scheduleTab(scheduleTab) {
+ScheduleTabContent::ScheduleTabContent(ScheduleTab* scheduleTab, QWidget* parent)
+  : QWidget(parent), m_scheduleTab(scheduleTab), m_mouseDown(false), m_dirty(true) {
   auto mainVLayout = new QVBoxLayout();
   mainVLayout->setContentsMargins(5, 5, 5, 5);
   mainVLayout->setSpacing(5);
@@ -931,6 +954,8 @@ ScheduleTabContent::ScheduleTabContent(ScheduleTab* scheduleTab, QWidget* parent
 
   auto defaultTab = new ScheduleTabDefault(m_scheduleTab, ScheduleTabDefault::DEFAULT);
   defaultLayout->addWidget(defaultTab);
+
+  refresh();
 }
 
 void ScheduleTabContent::refresh() {
@@ -1854,9 +1879,7 @@ ScheduleRulesetNameWidget::ScheduleRulesetNameWidget(const model::ScheduleRulese
 /******************************************************************************/
 
 YearOverview::YearOverview(const model::ScheduleRuleset& scheduleRuleset, QWidget* parent)
-  : QWidget(parent), m_scheduleRuleset(scheduleRuleset), m_dirty(false) {
-  refreshActiveRuleIndices();
-
+  : QWidget(parent), m_scheduleRuleset(scheduleRuleset), m_ruleCalendar(scheduleRuleset), m_dirty(false) {
   auto mainScrollLayout = new QVBoxLayout();
 
   mainScrollLayout->setContentsMargins(0, 0, 0, 0);
@@ -1952,17 +1975,6 @@ YearOverview::YearOverview(const model::ScheduleRuleset& scheduleRuleset, QWidge
   refresh();
 }
 
-void YearOverview::refreshActiveRuleIndices() {
-  int year = m_scheduleRuleset.model().getUniqueModelObject<model::YearDescription>().assumedYear();
-
-  Date startDate(1, 1, year);
-  Date endDate(12, 31, year);
-
-  m_activeRuleIndices = m_scheduleRuleset.getActiveRuleIndices(startDate, endDate);
-
-  m_dirty = false;
-}
-
 void YearOverview::onModelAdd(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> wo, const openstudio::IddObjectType& iddType,
                               const openstudio::UUID& uuid) {
   boost::optional<model::ScheduleRule> scheduleRule = m_scheduleRuleset.model().getModelObject<model::ScheduleRule>(wo->handle());
@@ -1970,12 +1982,14 @@ void YearOverview::onModelAdd(std::shared_ptr<openstudio::detail::WorkspaceObjec
   if (scheduleRule) {
     if (scheduleRule->scheduleRuleset().handle() == m_scheduleRuleset.handle()) {
       scheduleRule->getImpl<model::detail::ScheduleRule_Impl>().get()->onChange.connect<YearOverview, &YearOverview::scheduleRefresh>(this);
+
+      scheduleRefresh();
     }
   }
 }
 
-std::vector<int> YearOverview::activeRuleIndices() const {
-  return m_activeRuleIndices;
+const std::vector<int>& YearOverview::activeRuleIndices() const {
+  return m_ruleCalendar.activeRuleIndices();
 }
 
 void YearOverview::scheduleRefresh() {
@@ -1985,9 +1999,8 @@ void YearOverview::scheduleRefresh() {
 }
 
 void YearOverview::refresh() {
-  if (m_dirty) {
-    refreshActiveRuleIndices();
-
+  // rule edits that do not move the active rules around (names, day schedules) leave the calendar as is
+  if (m_dirty && m_ruleCalendar.refresh()) {
     m_januaryView->update();
     m_februaryView->update();
     m_marchView->update();
@@ -2002,6 +2015,8 @@ void YearOverview::refresh() {
     m_decemberView->update();
   }
 
+  m_dirty = false;
+
   update();
 }
 
@@ -2086,7 +2101,9 @@ void ScheduleCalendarWidget::paintCell(QPainter* painter, const QRect& rect, con
   if (date.month() == m_monthView->month()) {
     int dayOfYear = date.dayOfYear();
 
-    int ruleIndex = m_monthView->yearOverview()->activeRuleIndices()[dayOfYear - 1];
+    const std::vector<int>& activeRuleIndices = m_monthView->yearOverview()->activeRuleIndices();
+
+    int ruleIndex = (dayOfYear <= static_cast<int>(activeRuleIndices.size())) ? activeRuleIndices[dayOfYear - 1] : -1;
 
     QColor ruleColor = SchedulesView::colors[12];
 
@@ -30,6 +30,8 @@
 #ifndef OPENSTUDIO_SCHEDULESVIEW_HPP
 #define OPENSTUDIO_SCHEDULESVIEW_HPP
 
+#include "ScheduleRuleCalendar.hpp"
+
 #include "../model_editor/QMetaTypes.hpp"
 
 #include <openstudio/model/Model.hpp>
@@ -45,6 +47,7 @@
 #include <boost/optional.hpp>
 #include <boost/smart_ptr.hpp>
 
+#include <list>
 #include <map>
 
 #include <QCalendarWidget>
@@ -124,6 +127,8 @@ class MonthView;
 
 class ScheduleCalendarWidget;
 
+class DefaultScheduleDayView;
+
 // Overall view for the schedules tab, includes left column selector
 class SchedulesView : public QWidget, public Nano::Observer
 {
@@ -225,6 +230,14 @@ class SchedulesView : public QWidget, public Nano::Observer
  private:
   void updateRowColors();
 
+  // Takes the current detail view out of the content area, recently viewed schedule views are hidden rather than deleted
+  void clearContent();
+
+  void evictScheduleView(const Handle& handle);
+
+  // Number of default day views kept alive so that switching back and forth between schedules is cheap
+  static constexpr size_t maxRecentScheduleViews = 5;
+
   model::Model m_model;
 
   QVBoxLayout* m_leftVLayout;
@@ -232,6 +245,13 @@ class SchedulesView : public QWidget, public Nano::Observer
   QHBoxLayout* m_contentLayout;
 
   bool m_isIP;
+
+  std::map<Handle, ScheduleTab*> m_scheduleTabs;
+
+  ScheduleTab* m_currentTab;
+
+  // Most recently viewed first
+  std::list<std::pair<Handle, DefaultScheduleDayView*>> m_recentScheduleViews;
 };
 
 /******************************************************************************/
@@ -258,6 +278,7 @@ class ScheduleTab : public QWidget, public Nano::Observer
 
   ScheduleTabHeader* scheduleTabHeader() const;
 
+  // Content is only built the first time the tab is expanded, nullptr until then
   ScheduleTabContent* scheduleTabContent() const;
 
   void expand();
@@ -266,6 +287,10 @@ class ScheduleTab : public QWidget, public Nano::Observer
 
   void toggle();
 
+ public slots:
+
+  void scheduleRefresh(const Handle& handle);
+
  signals:
 
   void scheduleClicked(const model::ScheduleRuleset& schedule);
@@ -295,6 +320,8 @@ class ScheduleTab : public QWidget, public Nano::Observer
  private:
   //void refresh();
 
+  ScheduleTabContent* createContent();
+
   //bool m_mouseDown;
 
   bool m_selected;
@@ -705,7 +732,8 @@ class YearOverview : public QWidget, public Nano::Observer
 
   model::ScheduleRuleset scheduleRuleset() const;
 
-  std::vector<int> activeRuleIndices() const;
+  // shared by all month views, indexed by day of year - 1
+  const std::vector<int>& activeRuleIndices() const;
 
  private slots:
 
@@ -716,8 +744,6 @@ class YearOverview : public QWidget, public Nano::Observer
   void onModelAdd(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&);
 
  private:
-  void refreshActiveRuleIndices();
-
   MonthView* m_januaryView;
 
   MonthView* m_februaryView;
@@ -744,7 +770,7 @@ class YearOverview : public QWidget, public Nano::Observer
 
   model::ScheduleRuleset m_scheduleRuleset;
 
-  std::vector<int> m_activeRuleIndices;
+  ScheduleRuleCalendar m_ruleCalendar;
 
   bool m_dirty;
 };
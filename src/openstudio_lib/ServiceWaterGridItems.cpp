@@ -30,6 +30,7 @@
 #include "ServiceWaterGridItems.hpp"
 #include "ServiceWaterScene.hpp"
 #include "IconLibrary.hpp"
+#include "PixmapRenderCache.hpp"
 #include <openstudio/model/WaterUseConnections.hpp>
 #include <openstudio/model/WaterUseConnections_Impl.hpp>
 #include <openstudio/model/WaterUseEquipment.hpp>
@@ -559,10 +560,7 @@ void SewerItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
 
   painter->drawLine(50, 50, 200, 50);
 
-  QTransform transform;
-  transform = transform.rotate(90);
-
-  painter->drawPixmap(137, 37, 25, 25, QPixmap(":/images/arrow.png").transformed(transform));
+  PixmapRenderCache::drawPixmap(painter, QRectF(137, 37, 25, 25), ":/images/arrow.png", 90);
 }
 
 HotWaterSupplyItem::HotWaterSupplyItem(QGraphicsItem* parent) : GridItem(parent) {
@@ -600,10 +598,7 @@ void HotWaterSupplyItem::paint(QPainter* painter, const QStyleOptionGraphicsItem
 
   painter->drawLine(0, 50, 150, 50);
 
-  QTransform transform;
-  transform = transform.rotate(90);
-
-  painter->drawPixmap(37, 37, 25, 25, QPixmap(":/images/arrow.png").transformed(transform));
+  PixmapRenderCache::drawPixmap(painter, QRectF(37, 37, 25, 25), ":/images/arrow.png", 90);
 }
 
 MainsSupplyItem::MainsSupplyItem(QGraphicsItem* parent) : GridItem(parent) {
@@ -633,10 +628,7 @@ void MainsSupplyItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
 
   painter->drawLine(0, 50, 150, 50);
 
-  QTransform transform;
-  transform = transform.rotate(90);
-
-  painter->drawPixmap(37, 37, 25, 25, QPixmap(":/images/arrow.png").transformed(transform));
+  PixmapRenderCache::drawPixmap(painter, QRectF(37, 37, 25, 25), ":/images/arrow.png", 90);
 }
 
 DoubleOneThreeStraightItem::DoubleOneThreeStraightItem(QGraphicsItem* parent) : GridItem(parent) {}
@@ -760,7 +752,7 @@ WaterUseConnectionsItem::WaterUseConnectionsItem(QGraphicsItem* parent) : GridIt
 void WaterUseConnectionsItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) {
   GridItem::paint(painter, option, widget);
 
-  painter->drawPixmap(0, 0, 200, 100, QPixmap(":/images/water_connection.png"));
+  PixmapRenderCache::drawPixmap(painter, QRectF(0, 0, 200, 100), ":/images/water_connection.png");
 }
 
 WaterUseEquipmentItem::WaterUseEquipmentItem(QGraphicsItem* parent) : GridItem(parent) {
@@ -780,7 +772,7 @@ void WaterUseEquipmentItem::setModelObject(model::OptionalModelObject modelObjec
 void WaterUseEquipmentItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) {
   GridItem::paint(painter, option, widget);
 
-  painter->drawPixmap(0, 0, 200, 100, QPixmap(":/images/sink.png"));
+  PixmapRenderCache::drawPixmap(painter, QRectF(0, 0, 200, 100), ":/images/sink.png");
 }
 
 MakeupWaterItem::MakeupWaterItem(QGraphicsItem* parent) : GridItem(parent) {
@@ -818,10 +810,7 @@ void MakeupWaterItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* o
   painter->drawLine(125, 50, 125, 140);
   painter->drawLine(50, 150, 100, 150);
 
-  QTransform transform;
-  transform = transform.rotate(90);
-
-  painter->drawPixmap(37, 137, 25, 25, QPixmap(":/images/arrow.png").transformed(transform));
+  PixmapRenderCache::drawPixmap(painter, QRectF(37, 137, 25, 25), ":/images/arrow.png", 90);
 }
 
 void MakeupWaterItem::onHotWaterSupplyButtonClicked() {
@@ -0,0 +1,544 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SpacesFilterIndex.hpp"
+
+#include "../model_editor/Utilities.hpp"
+
+#include <openstudio/model/Building.hpp>
+#include <openstudio/model/Building_Impl.hpp>
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/BuildingStory_Impl.hpp>
+#include <openstudio/model/InteriorPartitionSurfaceGroup.hpp>
+#include <openstudio/model/InteriorPartitionSurfaceGroup_Impl.hpp>
+#include <openstudio/model/ModelObject_Impl.hpp>
+#include <openstudio/model/Model_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/SpaceType_Impl.hpp>
+#include <openstudio/model/SubSurface.hpp>
+#include <openstudio/model/SubSurface_Impl.hpp>
+#include <openstudio/model/Surface.hpp>
+#include <openstudio/model/Surface_Impl.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/model/ThermalZone_Impl.hpp>
+
+#include <openstudio/utilities/core/Assert.hpp>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+namespace openstudio {
+
+// Reindexes its row when the indexed object changes, Nano slots don't tell which object emitted
+class SpacesFilterIndex::RowWatcher : public Nano::Observer
+{
+ public:
+  RowWatcher(SpacesFilterIndex* index, size_t row) : m_index(index), m_row(row) {}
+
+  void onChange() {
+    m_index->indexRow(m_row);
+  }
+
+ private:
+  SpacesFilterIndex* m_index;
+  size_t m_row;
+};
+
+static void setRow(SpacesFilterIndex::RowMask& mask, size_t row) {
+  if (mask.size() <= row) {
+    mask.resize(row + 1);
+  }
+  mask.set(row);
+}
+
+SpacesFilterIndex::SpacesFilterIndex(const model::Model& model) : m_model(model), m_attributes(NumAttributes) {
+  m_model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.connect<SpacesFilterIndex, &SpacesFilterIndex::onObjectAdded>(this);
+  m_model.getImpl<model::detail::Model_Impl>().get()->removeWorkspaceObject.connect<SpacesFilterIndex, &SpacesFilterIndex::onObjectRemoved>(this);
+
+  watchBuilding();
+}
+
+SpacesFilterIndex::~SpacesFilterIndex() {}
+
+void SpacesFilterIndex::addAttribute(Attribute attribute) {
+  auto& index = m_attributes[attribute];
+  if (index.enabled) {
+    return;
+  }
+  index.enabled = true;
+
+  for (const auto& type : attributeTypes(attribute)) {
+    m_indexedTypes.insert(type);
+    for (const auto& workspaceObject : m_model.getObjectsByType(type)) {
+      auto it = m_rows.find(workspaceObject.handle());
+      if (it == m_rows.end()) {
+        addRow(workspaceObject.cast<model::ModelObject>());
+      } else {
+        indexRow(it->second, attribute);
+      }
+    }
+  }
+}
+
+bool SpacesFilterIndex::hasAttribute(Attribute attribute) const {
+  return m_attributes[attribute].enabled;
+}
+
+void SpacesFilterIndex::setFilter(Attribute attribute, const std::string& value) {
+  addAttribute(attribute);
+
+  auto& index = m_attributes[attribute];
+  index.filterActive = true;
+  index.filterUnassigned = false;
+  index.filterValue = value;
+  index.filterMask.reset();
+}
+
+void SpacesFilterIndex::setUnassignedFilter(Attribute attribute) {
+  OS_ASSERT(attribute == Story || attribute == ThermalZone || attribute == SpaceType);
+
+  addAttribute(attribute);
+
+  auto& index = m_attributes[attribute];
+  index.filterActive = true;
+  index.filterUnassigned = true;
+  index.filterValue.clear();
+  index.filterMask.reset();
+}
+
+void SpacesFilterIndex::clearFilter(Attribute attribute) {
+  auto& index = m_attributes[attribute];
+  index.filterActive = false;
+  index.filterUnassigned = false;
+  index.filterValue.clear();
+  index.filterMask.reset();
+}
+
+void SpacesFilterIndex::setFilterMask(Attribute attribute, const RowMask& visibleRows) {
+  addAttribute(attribute);
+
+  auto& index = m_attributes[attribute];
+  index.filterActive = true;
+  index.filterUnassigned = false;
+  index.filterValue.clear();
+  index.filterMask = visibleRows;
+}
+
+SpacesFilterIndex::TypeSnapshot SpacesFilterIndex::typeSnapshot(Attribute attribute) {
+  auto& index = m_attributes[attribute];
+  if (!index.rowTypes) {
+    index.rowTypes = std::make_shared<std::vector<IddObjectType>>(m_objects.size(), IddObjectType::Catchall);
+    for (auto row = index.rows.find_first(); row != RowMask::npos; row = index.rows.find_next(row)) {
+      (*index.rowTypes)[row] = m_objects[row]->iddObjectType();
+    }
+  }
+
+  return index.rowTypes;
+}
+
+boost::optional<SpacesFilterIndex::RowMask> SpacesFilterIndex::visibleRowsOfType(const TypeSnapshot& snapshot, const IddObjectType& type,
+                                                                                 const std::function<bool()>& isCancelled) {
+  const std::vector<IddObjectType>& types = *snapshot;
+  const IddObjectType notCarried(IddObjectType::Catchall);
+
+  RowMask result(types.size());
+  result.set();
+
+  for (size_t row = 0; row < types.size(); ++row) {
+    // checking every row would cost more than the comparison itself
+    if ((row % 1024 == 0) && isCancelled()) {
+      return boost::none;
+    }
+    if ((types[row] != notCarried) && (types[row] != type)) {
+      result.reset(row);
+    }
+  }
+
+  return result;
+}
+
+SpacesFilterIndex::RowMask SpacesFilterIndex::visibleRows() const {
+  RowMask result(m_objects.size());
+  result.set();
+
+  for (int attribute = 0; attribute < NumAttributes; ++attribute) {
+    const auto& index = m_attributes[attribute];
+    if (!index.enabled || !index.filterActive) {
+      continue;
+    }
+
+    if (index.filterMask) {
+      RowMask visible = index.filterMask.get();
+      visible.resize(result.size(), true);
+      result &= visible;
+      continue;
+    }
+
+    // rows carrying the attribute but not matching the filter are hidden
+    RowMask hidden = index.rows;
+    hidden.resize(result.size());
+    hidden -= matchingRows(index, static_cast<Attribute>(attribute));
+    result -= hidden;
+  }
+
+  return result;
+}
+
+bool SpacesFilterIndex::isVisible(const RowMask& mask, const Handle& handle) const {
+  auto it = m_rows.find(handle);
+  if (it == m_rows.end() || it->second >= mask.size()) {
+    return true;
+  }
+  return mask.test(it->second);
+}
+
+boost::optional<size_t> SpacesFilterIndex::row(const Handle& handle) const {
+  auto it = m_rows.find(handle);
+  if (it == m_rows.end()) {
+    return boost::none;
+  }
+  return it->second;
+}
+
+size_t SpacesFilterIndex::numRows() const {
+  return m_rows.size();
+}
+
+std::vector<IddObjectType> SpacesFilterIndex::attributeTypes(Attribute attribute) {
+  switch (attribute) {
+    case Story:
+    case ThermalZone:
+    case SpaceType:
+    case SpaceName:
+      return {IddObjectType::OS_Space};
+    case SubSurfaceType:
+      return {IddObjectType::OS_SubSurface};
+    case WindExposure:
+    case SunExposure:
+    case SurfaceType:
+      return {IddObjectType::OS_Surface};
+    case OutsideBoundaryCondition:
+      return {IddObjectType::OS_Surface, IddObjectType::OS_SubSurface};
+    case InteriorPartitionGroup:
+      return {IddObjectType::OS_InteriorPartitionSurfaceGroup};
+    case LoadType:
+      return {IddObjectType::OS_InternalMass,
+              IddObjectType::OS_People,
+              IddObjectType::OS_Lights,
+              IddObjectType::OS_Luminaire,
+              IddObjectType::OS_ElectricEquipment,
+              IddObjectType::OS_GasEquipment,
+              IddObjectType::OS_HotWaterEquipment,
+              IddObjectType::OS_SteamEquipment,
+              IddObjectType::OS_OtherEquipment,
+              IddObjectType::OS_SpaceInfiltration_DesignFlowRate,
+              IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea};
+    default:
+      OS_ASSERT(false);
+  }
+  return {};
+}
+
+void SpacesFilterIndex::onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid) {
+  if (type == IddObjectType::OS_Building) {
+    watchBuilding();
+    onBuildingChanged();
+    return;
+  }
+
+  if (m_indexedTypes.count(type) == 0 || m_rows.count(uuid) > 0) {
+    return;
+  }
+
+  addRow(workspaceObject.cast<model::ModelObject>());
+}
+
+void SpacesFilterIndex::onObjectRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type,
+                                        const openstudio::UUID& uuid) {
+  auto it = m_rows.find(uuid);
+  if (it != m_rows.end()) {
+    removeRow(it->second);
+  }
+}
+
+void SpacesFilterIndex::onBuildingChanged() {
+  // Spaces without a SpaceType of their own inherit the Building's
+  auto& index = m_attributes[SpaceType];
+  if (!index.enabled) {
+    return;
+  }
+
+  for (auto row = index.rows.find_first(); row != RowMask::npos; row = index.rows.find_next(row)) {
+    indexRow(row, SpaceType);
+  }
+}
+
+void SpacesFilterIndex::watchBuilding() {
+  m_building.reset();
+  if (auto building = m_model.getOptionalUniqueModelObject<model::Building>()) {
+    m_building = building.get();
+    m_building->getImpl<model::detail::ModelObject_Impl>().get()->onChange.connect<SpacesFilterIndex, &SpacesFilterIndex::onBuildingChanged>(this);
+  }
+}
+
+void SpacesFilterIndex::addRow(const model::ModelObject& modelObject) {
+  size_t row = m_objects.size();
+  m_objects.push_back(modelObject);
+  m_rows[modelObject.handle()] = row;
+
+  auto watcher = std::make_unique<RowWatcher>(this, row);
+  modelObject.getImpl<model::detail::ModelObject_Impl>().get()->onChange.connect<RowWatcher, &RowWatcher::onChange>(watcher.get());
+  m_watchers.push_back(std::move(watcher));
+
+  indexRow(row);
+}
+
+void SpacesFilterIndex::removeRow(size_t row) {
+  for (int attribute = 0; attribute < NumAttributes; ++attribute) {
+    unindexRow(row, static_cast<Attribute>(attribute));
+  }
+
+  // rows aren't reused, so a mask evaluated before the removal can't apply to another object
+  m_rows.erase(m_objects[row]->handle());
+  m_objects[row].reset();
+  m_watchers[row].reset();
+}
+
+void SpacesFilterIndex::indexRow(size_t row) {
+  for (int attribute = 0; attribute < NumAttributes; ++attribute) {
+    indexRow(row, static_cast<Attribute>(attribute));
+  }
+}
+
+void SpacesFilterIndex::indexRow(size_t row, Attribute attribute) {
+  auto& index = m_attributes[attribute];
+  if (!index.enabled || !m_objects[row]) {
+    return;
+  }
+
+  auto key = attributeKey(attribute, m_objects[row].get());
+
+  const Bucket* current = (row < index.rowBuckets.size()) ? index.rowBuckets[row] : nullptr;
+  if (current && key && (current->key == key.get())) {
+    return;
+  }
+
+  unindexRow(row, attribute);
+  if (!key) {
+    return;
+  }
+
+  auto it = index.buckets.find(key.get());
+  if (it == index.buckets.end()) {
+    it = index.buckets.emplace(key.get(), Bucket()).first;
+    it->second.key = key.get();
+    if (!key->empty() && (attribute == Story || attribute == ThermalZone || attribute == SpaceType)) {
+      it->second.target = m_model.getModelObject<model::ModelObject>(toUUID(key.get()));
+    }
+  }
+
+  setRow(it->second.rows, row);
+  setRow(index.rows, row);
+  if (index.rowBuckets.size() <= row) {
+    index.rowBuckets.resize(m_objects.size(), nullptr);
+  }
+  index.rowBuckets[row] = &it->second;
+  setRowType(index, row, m_objects[row]->iddObjectType());
+}
+
+void SpacesFilterIndex::unindexRow(size_t row, Attribute attribute) {
+  auto& index = m_attributes[attribute];
+  if (row >= index.rowBuckets.size() || !index.rowBuckets[row]) {
+    return;
+  }
+
+  Bucket* bucket = index.rowBuckets[row];
+  index.rowBuckets[row] = nullptr;
+  index.rows.reset(row);
+  bucket->rows.reset(row);
+  if (bucket->rows.none()) {
+    index.buckets.erase(bucket->key);
+  }
+  setRowType(index, row, IddObjectType::Catchall);
+}
+
+void SpacesFilterIndex::setRowType(AttributeIndex& index, size_t row, const IddObjectType& type) {
+  if (!index.rowTypes) {
+    return;
+  }
+
+  // rows outside the types don't carry the attribute
+  if ((row >= index.rowTypes->size()) && (type == IddObjectType::Catchall)) {
+    return;
+  }
+
+  // only gui thread code gives out snapshots, so a count of one means no worker can be reading them
+  if (index.rowTypes.use_count() > 1) {
+    index.rowTypes = std::make_shared<std::vector<IddObjectType>>(*index.rowTypes);
+  }
+
+  if (row >= index.rowTypes->size()) {
+    index.rowTypes->resize(row + 1, IddObjectType::Catchall);
+  }
+  (*index.rowTypes)[row] = type;
+}
+
+SpacesFilterIndex::RowMask SpacesFilterIndex::matchingRows(const AttributeIndex& index, Attribute attribute) const {
+  RowMask result(m_objects.size());
+
+  auto addBucket = [&result](const Bucket& bucket) {
+    RowMask rows = bucket.rows;
+    rows.resize(result.size());
+    result |= rows;
+  };
+
+  auto addKey = [&index, &addBucket](const std::string& key) {
+    auto it = index.buckets.find(key);
+    if (it != index.buckets.end()) {
+      addBucket(it->second);
+    }
+  };
+
+  switch (attribute) {
+    case Story:
+    case ThermalZone:
+    case SpaceType:
+      if (index.filterUnassigned) {
+        addKey(std::string());
+      } else {
+        // buckets are keyed by handle so renaming a Story, ThermalZone or SpaceType doesn't require reindexing its Spaces
+        for (const auto& bucket : index.buckets) {
+          if (bucket.second.target) {
+            auto name = bucket.second.target->name();
+            if (name && (name.get() == index.filterValue)) {
+              addBucket(bucket.second);
+            }
+          }
+        }
+      }
+      break;
+    case SpaceName: {
+      QString text = toQString(index.filterValue);
+      for (auto row = index.rows.find_first(); row != RowMask::npos; row = index.rows.find_next(row)) {
+        auto name = m_objects[row]->name();
+        if (name && toQString(name.get()).contains(text, Qt::CaseInsensitive)) {
+          result.set(row);
+        }
+      }
+      break;
+    }
+    case InteriorPartitionGroup:
+    case LoadType:
+      addKey(index.filterValue);
+      break;
+    default:
+      // Case insensitive, for instance "fixedwindow" might be returned by SubSurface::subSurfaceType() rather than "FixedWindow"
+      addKey(boost::algorithm::to_lower_copy(index.filterValue));
+      break;
+  }
+
+  return result;
+}
+
+boost::optional<std::string> SpacesFilterIndex::attributeKey(Attribute attribute, const model::ModelObject& modelObject) {
+  switch (attribute) {
+    case Story:
+      if (auto space = modelObject.optionalCast<model::Space>()) {
+        auto buildingStory = space->buildingStory();
+        return buildingStory ? toString(buildingStory->handle()) : std::string();
+      }
+      break;
+    case ThermalZone:
+      if (auto space = modelObject.optionalCast<model::Space>()) {
+        auto thermalZone = space->thermalZone();
+        return thermalZone ? toString(thermalZone->handle()) : std::string();
+      }
+      break;
+    case SpaceType:
+      if (auto space = modelObject.optionalCast<model::Space>()) {
+        auto spaceType = space->spaceType();
+        return spaceType ? toString(spaceType->handle()) : std::string();
+      }
+      break;
+    case SpaceName:
+      if (modelObject.optionalCast<model::Space>()) {
+        return std::string();
+      }
+      break;
+    case SubSurfaceType:
+      if (auto subSurface = modelObject.optionalCast<model::SubSurface>()) {
+        return boost::algorithm::to_lower_copy(subSurface->subSurfaceType());
+      }
+      break;
+    case WindExposure:
+      if (auto surface = modelObject.optionalCast<model::Surface>()) {
+        return boost::algorithm::to_lower_copy(surface->windExposure());
+      }
+      break;
+    case SunExposure:
+      if (auto surface = modelObject.optionalCast<model::Surface>()) {
+        return boost::algorithm::to_lower_copy(surface->sunExposure());
+      }
+      break;
+    case OutsideBoundaryCondition:
+      if (auto surface = modelObject.optionalCast<model::Surface>()) {
+        return boost::algorithm::to_lower_copy(surface->outsideBoundaryCondition());
+      } else if (auto subSurface = modelObject.optionalCast<model::SubSurface>()) {
+        return boost::algorithm::to_lower_copy(subSurface->outsideBoundaryCondition());
+      }
+      break;
+    case SurfaceType:
+      if (auto surface = modelObject.optionalCast<model::Surface>()) {
+        return boost::algorithm::to_lower_copy(surface->surfaceType());
+      }
+      break;
+    case InteriorPartitionGroup:
+      if (modelObject.optionalCast<model::InteriorPartitionSurfaceGroup>()) {
+        auto name = modelObject.name();
+        return name ? name.get() : std::string();
+      }
+      break;
+    case LoadType: {
+      auto type = modelObject.iddObjectType();
+      for (const auto& loadType : attributeTypes(LoadType)) {
+        if (type == loadType) {
+          return type.valueName();
+        }
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  return boost::none;
+}
+
+}  // namespace openstudio
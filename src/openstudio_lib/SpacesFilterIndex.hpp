@@ -0,0 +1,196 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_SPACESFILTERINDEX_HPP
+#define OPENSTUDIO_SPACESFILTERINDEX_HPP
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ModelObject.hpp>
+
+#include <openstudio/nano/nano_signal_slot.hpp>  // Signal-Slot replacement
+#include <openstudio/utilities/core/UUID.hpp>
+#include <openstudio/utilities/idd/IddEnums.hxx>
+
+#include <boost/dynamic_bitset.hpp>
+#include <boost/optional.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+// Inverted indices backing the filters of the Spaces subtabs.
+// Every indexed object gets a row, and each attribute maps its values to the rows carrying them,
+// so evaluating any combination of filters is a handful of bitset operations rather than a scan of the grid.
+// The indices are kept up to date as objects are added, removed or modified in the model.
+class SpacesFilterIndex : public Nano::Observer
+{
+ public:
+  enum Attribute
+  {
+    // Space level, applied to the Space rows
+    Story = 0,
+    ThermalZone,
+    SpaceType,
+    SpaceName,
+    // Applied to the sub rows
+    SubSurfaceType,
+    WindExposure,
+    SunExposure,
+    OutsideBoundaryCondition,
+    SurfaceType,
+    InteriorPartitionGroup,
+    LoadType,
+    NumAttributes
+  };
+
+  using RowMask = boost::dynamic_bitset<>;
+
+  // Type of the object of each row, IddObjectType::Catchall for the rows that don't carry the attribute, see typeSnapshot
+  using TypeSnapshot = std::shared_ptr<const std::vector<IddObjectType>>;
+
+  explicit SpacesFilterIndex(const model::Model& model);
+
+  virtual ~SpacesFilterIndex();
+
+  // Starts indexing an attribute, adding rows for the objects that carry it
+  void addAttribute(Attribute attribute);
+
+  bool hasAttribute(Attribute attribute) const;
+
+  // Keeps the rows carrying the attribute only if they match value, rows that don't carry it are unaffected.
+  // Story, ThermalZone, SpaceType and InteriorPartitionGroup match by name, SpaceName by case insensitive substring,
+  // LoadType by IddObjectType value name and the others by case insensitive value.
+  void setFilter(Attribute attribute, const std::string& value);
+
+  // Keeps the Spaces that have no Story, ThermalZone or SpaceType
+  void setUnassignedFilter(Attribute attribute);
+
+  void clearFilter(Attribute attribute);
+
+  // Uses visibleRows, typically evaluated on a worker thread by visibleRowsOfType, as the attribute's filter.
+  // Rows added after the mask was evaluated are kept
+  void setFilterMask(Attribute attribute, const RowMask& visibleRows);
+
+  // Types of the rows carrying attribute, so a worker never touches the model. Built on the first call, then kept up to
+  // date as rows are indexed, a snapshot still in use is copied before a change rather than changed under the worker
+  TypeSnapshot typeSnapshot(Attribute attribute);
+
+  // Keeps the snapshot rows whose type is type, and every row that doesn't carry the attribute or isn't in the snapshot.
+  // Safe to call from any thread, returns none as soon as isCancelled returns true
+  static boost::optional<RowMask> visibleRowsOfType(const TypeSnapshot& snapshot, const IddObjectType& type,
+                                                    const std::function<bool()>& isCancelled);
+
+  // Intersection of the active filters, evaluated against the current state of the model
+  RowMask visibleRows() const;
+
+  // Objects that aren't indexed, or were added after mask was evaluated, are visible
+  bool isVisible(const RowMask& mask, const Handle& handle) const;
+
+  boost::optional<size_t> row(const Handle& handle) const;
+
+  size_t numRows() const;
+
+  static std::vector<IddObjectType> attributeTypes(Attribute attribute);
+
+ private:
+  class RowWatcher;
+
+  struct Bucket
+  {
+    std::string key;
+    // the Story, ThermalZone or SpaceType that key refers to
+    boost::optional<model::ModelObject> target;
+    RowMask rows;
+  };
+
+  struct AttributeIndex
+  {
+    bool enabled = false;
+    std::map<std::string, Bucket> buckets;
+    // bucket of each row, nullptr if the row doesn't carry the attribute
+    std::vector<Bucket*> rowBuckets;
+    // rows carrying the attribute
+    RowMask rows;
+    bool filterActive = false;
+    bool filterUnassigned = false;
+    std::string filterValue;
+    boost::optional<RowMask> filterMask;
+    // type of each row, shared with the snapshots given out, nullptr until typeSnapshot is called
+    std::shared_ptr<std::vector<IddObjectType>> rowTypes;
+  };
+
+  void onObjectAdded(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+  void onObjectRemoved(const WorkspaceObject& workspaceObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+  void onBuildingChanged();
+
+  void watchBuilding();
+
+  void addRow(const model::ModelObject& modelObject);
+
+  void removeRow(size_t row);
+
+  void indexRow(size_t row);
+
+  void indexRow(size_t row, Attribute attribute);
+
+  void unindexRow(size_t row, Attribute attribute);
+
+  // Sets the type of a row in the attribute's row types if they are kept, copying them first if a snapshot shares them
+  void setRowType(AttributeIndex& index, size_t row, const IddObjectType& type);
+
+  RowMask matchingRows(const AttributeIndex& index, Attribute attribute) const;
+
+  static boost::optional<std::string> attributeKey(Attribute attribute, const model::ModelObject& modelObject);
+
+  model::Model m_model;
+
+  std::vector<AttributeIndex> m_attributes;
+
+  std::vector<boost::optional<model::ModelObject>> m_objects;
+
+  std::vector<std::unique_ptr<RowWatcher>> m_watchers;
+
+  std::map<Handle, size_t> m_rows;
+
+  // types of the objects carrying an enabled attribute
+  std::set<IddObjectType> m_indexedTypes;
+
+  boost::optional<model::ModelObject> m_building;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_SPACESFILTERINDEX_HPP
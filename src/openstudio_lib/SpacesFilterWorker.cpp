@@ -0,0 +1,93 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SpacesFilterWorker.hpp"
+
+#include <QFutureWatcher>
+#include <QtConcurrent>
+
+namespace openstudio {
+
+SpacesFilterWorker::SpacesFilterWorker(QObject* parent) : QObject(parent), m_latestRequest(std::make_shared<std::atomic<unsigned>>(0)) {}
+
+SpacesFilterWorker::~SpacesFilterWorker() {
+  // running evaluations finish on their own, their results go nowhere
+  cancel();
+}
+
+unsigned SpacesFilterWorker::request(const Evaluation& evaluation) {
+  unsigned requestId = ++(*m_latestRequest);
+
+  std::shared_ptr<std::atomic<unsigned>> latestRequest = m_latestRequest;
+  std::function<bool()> isCancelled = [latestRequest, requestId]() { return latestRequest->load() != requestId; };
+
+  using Result = boost::optional<SpacesFilterIndex::RowMask>;
+  auto watcher = new QFutureWatcher<Result>(this);
+  connect(watcher, &QFutureWatcher<Result>::finished, this, [this, watcher, requestId]() {
+    Result result = watcher->result();
+    watcher->deleteLater();
+    onFinished(requestId, result);
+  });
+
+  ++m_pendingCount;
+  watcher->setFuture(QtConcurrent::run([evaluation, isCancelled]() -> Result {
+    if (isCancelled()) {
+      // superseded while queued
+      return boost::none;
+    }
+    return evaluation(isCancelled);
+  }));
+
+  return requestId;
+}
+
+void SpacesFilterWorker::cancel() {
+  ++(*m_latestRequest);
+}
+
+unsigned SpacesFilterWorker::pendingCount() const {
+  return m_pendingCount;
+}
+
+unsigned SpacesFilterWorker::cancelledCount() const {
+  return m_cancelledCount;
+}
+
+void SpacesFilterWorker::onFinished(unsigned requestId, const boost::optional<SpacesFilterIndex::RowMask>& visibleRows) {
+  --m_pendingCount;
+
+  if (!visibleRows || (requestId != m_latestRequest->load())) {
+    ++m_cancelledCount;
+    return;
+  }
+
+  emit maskReady(requestId, visibleRows.get());
+}
+
+}  // namespace openstudio
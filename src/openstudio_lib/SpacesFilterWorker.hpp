@@ -0,0 +1,87 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OPENSTUDIO_SPACESFILTERWORKER_HPP
+#define OPENSTUDIO_SPACESFILTERWORKER_HPP
+
+#include "SpacesFilterIndex.hpp"
+
+#include <QObject>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace openstudio {
+
+// Evaluates filter row masks on a worker thread, so filters that have to look at every row don't stall the gui.
+// Each request supersedes the previous ones: a superseded evaluation is skipped if it hasn't started, told to stop
+// through its isCancelled argument if it has, and its result is discarded if it finishes anyway.
+// Only the mask of the latest request is emitted, on the gui thread, for the grid to apply in one go.
+class SpacesFilterWorker : public QObject
+{
+  Q_OBJECT
+
+ public:
+  using Evaluation = std::function<boost::optional<SpacesFilterIndex::RowMask>(const std::function<bool()>& isCancelled)>;
+
+  explicit SpacesFilterWorker(QObject* parent = nullptr);
+
+  virtual ~SpacesFilterWorker();
+
+  // evaluation must only use data it owns, typically a snapshot taken on the gui thread
+  unsigned request(const Evaluation& evaluation);
+
+  // Supersedes the pending requests without making a new one
+  void cancel();
+
+  // Requests whose evaluation hasn't finished yet
+  unsigned pendingCount() const;
+
+  // Requests that were superseded before their mask was emitted
+  unsigned cancelledCount() const;
+
+ signals:
+
+  void maskReady(unsigned requestId, const SpacesFilterIndex::RowMask& visibleRows);
+
+ private:
+  void onFinished(unsigned requestId, const boost::optional<SpacesFilterIndex::RowMask>& visibleRows);
+
+  // shared with the evaluations, which may outlive the worker
+  std::shared_ptr<std::atomic<unsigned>> m_latestRequest;
+
+  unsigned m_pendingCount = 0;
+
+  unsigned m_cancelledCount = 0;
+};
+
+}  // namespace openstudio
+
+#endif  // OPENSTUDIO_SPACESFILTERWORKER_HPP
@@ -29,6 +29,9 @@
 
 #include "SpacesSubtabGridView.hpp"
 
+#include "SpacesFilterIndex.hpp"
+#include "SpacesFilterWorker.hpp"
+
 #include "../shared_gui_components/OSGridView.hpp"
 
 #include <openstudio/model/BuildingStory.hpp>
@@ -124,7 +127,16 @@
 namespace openstudio {
 
 SpacesSubtabGridView::SpacesSubtabGridView(bool isIP, const model::Model& model, QWidget* parent)
-  : GridViewSubTab(isIP, model, parent), m_spacesModelObjects(subsetCastVector<model::ModelObject>(model.getConcreteModelObjects<model::Space>())) {
+  : GridViewSubTab(isIP, model, parent),
+    m_filterIndex(std::make_shared<SpacesFilterIndex>(model)),
+    m_spacesModelObjects(subsetCastVector<model::ModelObject>(model.getConcreteModelObjects<model::Space>())) {
+
+  // Load type masks are applied as a whole once evaluated, masks of superseded requests never get here
+  m_filterWorker = new SpacesFilterWorker(this);
+  connect(m_filterWorker, &SpacesFilterWorker::maskReady, this, [this](unsigned requestId, const SpacesFilterIndex::RowMask& visibleRows) {
+    m_filterIndex->setFilterMask(SpacesFilterIndex::LoadType, visibleRows);
+    filterChanged();
+  });
 
   // Filters
 
@@ -149,6 +161,7 @@ void SpacesSubtabGridView::showStoryFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_storyFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::Story);
   initializeStoryFilter();
   m_storyFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_storyFilter, &QComboBox::currentTextChanged, this, &openstudio::SpacesSubtabGridView::storyFilterChanged);
@@ -167,6 +180,7 @@ void SpacesSubtabGridView::showThermalZoneFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_thermalZoneFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::ThermalZone);
   initializeThermalZoneFilter();
   m_thermalZoneFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_thermalZoneFilter, &QComboBox::currentTextChanged, this, &openstudio::SpacesSubtabGridView::thermalZoneFilterChanged);
@@ -185,6 +199,7 @@ void SpacesSubtabGridView::showSpaceTypeFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_spaceTypeFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::SpaceType);
   initializeSpaceTypeFilter();
   m_spaceTypeFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_spaceTypeFilter, &QComboBox::currentTextChanged, this, &openstudio::SpacesSubtabGridView::spaceTypeFilterChanged);
@@ -203,6 +218,7 @@ void SpacesSubtabGridView::showSubSurfaceTypeFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_subSurfaceTypeFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::SubSurfaceType);
   initializeSubSurfaceTypeFilter();
   m_subSurfaceTypeFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_subSurfaceTypeFilter, &QComboBox::currentTextChanged, this, &openstudio::SpacesSubtabGridView::subSurfaceTypeFilterChanged);
@@ -221,6 +237,7 @@ void SpacesSubtabGridView::showSpaceNameFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_spaceNameFilter = new QLineEdit();
+  m_filterIndex->addAttribute(SpacesFilterIndex::SpaceName);
   m_spaceNameFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_spaceNameFilter, &QLineEdit::editingFinished, this, &openstudio::SpacesSubtabGridView::spaceNameFilterChanged);
   // Evan note: there are issues with using the signal below (as well as textChanged), related to the design and updating of the gridview (loss of focus, and updates per key stroke)
@@ -240,6 +257,7 @@ void SpacesSubtabGridView::showWindExposureFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_windExposureFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::WindExposure);
   initializeWindExposureFilter();
   m_windExposureFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_windExposureFilter, &QComboBox::currentTextChanged, this, &openstudio::SpacesSubtabGridView::windExposureFilterChanged);
@@ -258,6 +276,7 @@ void SpacesSubtabGridView::showSunExposureFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_sunExposureFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::SunExposure);
   initializeSunExposureFilter();
   m_sunExposureFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_sunExposureFilter, &QComboBox::currentTextChanged, this, &openstudio::SpacesSubtabGridView::sunExposureFilterChanged);
@@ -276,6 +295,7 @@ void SpacesSubtabGridView::showOutsideBoundaryConditionFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_outsideBoundaryConditionFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::OutsideBoundaryCondition);
   initializeOutsideBoundaryConditionFilter();
   m_outsideBoundaryConditionFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_outsideBoundaryConditionFilter, &QComboBox::currentTextChanged, this,
@@ -295,6 +315,7 @@ void SpacesSubtabGridView::showSurfaceTypeFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_surfaceTypeFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::SurfaceType);
   initializeSurfaceTypeFilter();
   m_surfaceTypeFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_surfaceTypeFilter, &QComboBox::currentTextChanged, this, &openstudio::SpacesSubtabGridView::surfaceTypeFilterChanged);
@@ -313,6 +334,7 @@ void SpacesSubtabGridView::showInteriorPartitionGroupFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_interiorPartitionGroupFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::InteriorPartitionGroup);
   initializeInteriorPartitionGroupFilter();
   m_interiorPartitionGroupFilter->setFixedWidth(OSItem::ITEM_WIDTH);
   connect(m_interiorPartitionGroupFilter, &QComboBox::currentTextChanged, this,
@@ -332,6 +354,7 @@ void SpacesSubtabGridView::showLoadTypeFilter() {
   layout->addWidget(label, Qt::AlignTop | Qt::AlignLeft);
 
   m_loadTypeFilter = new QComboBox();
+  m_filterIndex->addAttribute(SpacesFilterIndex::LoadType);
   initializeLoadTypeFilter();
   m_loadTypeFilter->setFixedWidth(1.5 * OSItem::ITEM_WIDTH);
   connect(m_loadTypeFilter, &QComboBox::currentTextChanged, this, &openstudio::SpacesSubtabGridView::loadTypeFilterChanged);
@@ -513,319 +536,151 @@ void SpacesSubtabGridView::initializeInteriorPartitionGroupFilter() {
 }
 
 void SpacesSubtabGridView::storyFilterChanged(const QString& text) {
-  m_objectsFilteredByStory.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::Story);
   } else if (text == UNASSIGNED) {
-    for (auto obj : this->m_gridController->modelObjects()) {
-      if (obj.cast<model::Space>().buildingStory()) {
-        m_objectsFilteredByStory.insert(obj);
-      }
-    }
+    m_filterIndex->setUnassignedFilter(SpacesFilterIndex::Story);
   } else {
-    // OSGridController::m_modelObjects returns the Spaces
-    for (auto obj : this->m_gridController->modelObjects()) {
-      auto buildingStory = obj.cast<model::Space>().buildingStory();
-      if (!buildingStory || !buildingStory->name() || (buildingStory && buildingStory->name() && buildingStory->name().get().c_str() != text)) {
-        m_objectsFilteredByStory.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::Story, toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::thermalZoneFilterChanged(const QString& text) {
-  m_objectsFilteredByThermalZone.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::ThermalZone);
   } else if (text == UNASSIGNED) {
-    for (auto obj : this->m_gridController->modelObjects()) {
-      if (obj.cast<model::Space>().thermalZone()) {
-        m_objectsFilteredByThermalZone.insert(obj);
-      }
-    }
+    m_filterIndex->setUnassignedFilter(SpacesFilterIndex::ThermalZone);
   } else {
-    // OSGridController::m_modelObjects returns the Spaces
-    for (auto obj : this->m_gridController->modelObjects()) {
-      auto thermalZone = obj.cast<model::Space>().thermalZone();
-      if (!thermalZone || !thermalZone->name() || (thermalZone && thermalZone->name() && thermalZone->name().get().c_str() != text)) {
-        m_objectsFilteredByThermalZone.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::ThermalZone, toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::spaceTypeFilterChanged(const QString& text) {
-  m_objectsFilteredBySpaceType.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SpaceType);
   } else if (text == UNASSIGNED) {
-    for (auto obj : this->m_gridController->modelObjects()) {
-      if (obj.cast<model::Space>().spaceType()) {
-        m_objectsFilteredBySpaceType.insert(obj);
-      }
-    }
+    m_filterIndex->setUnassignedFilter(SpacesFilterIndex::SpaceType);
   } else {
-    // OSGridController::m_modelObjects returns the Spaces
-    for (auto obj : this->m_gridController->modelObjects()) {
-      // LOG(Debug, "spaceTypeFilterChanged, obj=" << obj.briefDescription());
-      auto spaceType = obj.cast<model::Space>().spaceType();
-      if (!spaceType || !spaceType->name() || (spaceType && spaceType->name() && spaceType->name().get().c_str() != text)) {
-        m_objectsFilteredBySpaceType.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::SpaceType, toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::subSurfaceTypeFilterChanged(const QString& text) {
-  m_objectsFilteredBySubSurfaceType.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SubSurfaceType);
   } else {
-
-    // It's possible that "fixedwindow" might be returned when querying later, instead of "FixedWindow" returned
-    // by SubSurface::validSubSurfaceTypes(), so we'll do a case-insensitive string comparison later
-    std::string subSurfaceTypeToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects returns SubSurfaces directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "subSurfaceTypeFilterChanged, obj=" << obj.briefDescription());
-      const auto& subsurface = obj.optionalCast<model::SubSurface>();
-      if (subsurface) {
-        const auto& subsurfaceType = subsurface->subSurfaceType();
-        // Case insensitive
-        if (!openstudio::istringEqual(subsurfaceType, subSurfaceTypeToKeep)) {
-          // LOG(Debug, "Adding obj=" << obj.briefDescription());
-          m_objectsFilteredBySubSurfaceType.insert(obj);
-        }
-      }
-    }
-
-    // Alternatively, we could have done this:
-    //for (auto obj : this->m_gridController->m_modelObjects) {
-    //LOG(Debug, "subSurfaceTypeFilterChanged, obj=" << obj.briefDescription());
-    //auto surfaces = obj.cast<model::Space>().surfaces();
-    //for (auto surface : surfaces) {
-    //auto subsurfaces = surface.subSurfaces();
-    //for (auto subsurface : subsurfaces) {
-    //auto subsurfaceType = subsurface.subSurfaceType();
-    //if (!openstudio::istringEqual(subsurfaceType, subSurfaceTypeToKeep)) {
-    //LOG(Debug, "Adding obj=" << obj.briefDescription());
-    //m_objectsFilteredBySubSurfaceType.insert(obj);
-    //}
-    //}
-    //}
-    //}
+    // Matched case insensitively, "fixedwindow" might be returned instead of "FixedWindow" returned by SubSurface::validSubSurfaceTypes()
+    m_filterIndex->setFilter(SpacesFilterIndex::SubSurfaceType, toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::spaceNameFilterChanged() {
-  m_objectsFilteredBySpaceName.clear();
-
   if (m_spaceNameFilter->text().isEmpty()) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SpaceName);
   } else {
-    for (auto obj : this->m_gridController->modelObjects()) {
-      QString objName(obj.name().get().c_str());
-      if (!objName.contains(m_spaceNameFilter->text(), Qt::CaseInsensitive)) {
-        m_objectsFilteredBySpaceName.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::SpaceName, toString(m_spaceNameFilter->text()));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::loadTypeFilterChanged(const QString& text) {
-  m_objectsFilteredByLoadType.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    // a pending evaluation mustn't bring the previous load type back
+    m_filterWorker->cancel();
+    m_filterIndex->clearFilter(SpacesFilterIndex::LoadType);
+    filterChanged();
+    return;
+  }
+
+  IddObjectType loadType(IddObjectType::UserCustom);
+  if (text == INTERNALMASS) {
+    loadType = IddObjectType::OS_InternalMass;
+  } else if (text == PEOPLE) {
+    loadType = IddObjectType::OS_People;
+  } else if (text == LIGHTS) {
+    loadType = IddObjectType::OS_Lights;
+  } else if (text == LUMINAIRE) {
+    loadType = IddObjectType::OS_Luminaire;
+  } else if (text == ELECTRICEQUIPMENT) {
+    loadType = IddObjectType::OS_ElectricEquipment;
+  } else if (text == GASEQUIPMENT) {
+    loadType = IddObjectType::OS_GasEquipment;
+  } else if (text == HOTWATEREQUIPMENT) {
+    loadType = IddObjectType::OS_HotWaterEquipment;
+  } else if (text == STEAMEQUIPMENT) {
+    loadType = IddObjectType::OS_SteamEquipment;
+  } else if (text == OTHEREQUIPMENT) {
+    loadType = IddObjectType::OS_OtherEquipment;
+  } else if (text == SPACEINFILTRATIONDESIGNFLOWRATE) {
+    loadType = IddObjectType::OS_SpaceInfiltration_DesignFlowRate;
+  } else if (text == SPACEINFILTRATIONEFFECTIVELEAKAGEAREA) {
+    loadType = IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea;
   } else {
-
-    // ObjectSelector::m_selectableObjects returns Load objects directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      if (text == INTERNALMASS) {
-        if (!obj.optionalCast<model::InternalMass>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == PEOPLE) {
-        if (!obj.optionalCast<model::People>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == LIGHTS) {
-        if (!obj.optionalCast<model::Lights>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == LUMINAIRE) {
-        if (!obj.optionalCast<model::Luminaire>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == ELECTRICEQUIPMENT) {
-        if (!obj.optionalCast<model::ElectricEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == GASEQUIPMENT) {
-        if (!obj.optionalCast<model::GasEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == HOTWATEREQUIPMENT) {
-        if (!obj.optionalCast<model::HotWaterEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == STEAMEQUIPMENT) {
-        if (!obj.optionalCast<model::SteamEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == OTHEREQUIPMENT) {
-        if (!obj.optionalCast<model::OtherEquipment>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == SPACEINFILTRATIONDESIGNFLOWRATE) {
-        if (!obj.optionalCast<model::SpaceInfiltrationDesignFlowRate>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else if (text == SPACEINFILTRATIONEFFECTIVELEAKAGEAREA) {
-        if (!obj.optionalCast<model::SpaceInfiltrationEffectiveLeakageArea>()) {
-          m_objectsFilteredByLoadType.insert(obj);
-        }
-      } else {
-        // Should never get here
-        OS_ASSERT(false);
-      }
-    }
+    // Should never get here
+    OS_ASSERT(false);
   }
 
-  filterChanged();
+  // The predicate runs on a worker against the load row types the index keeps up to date, the grid is updated in maskReady
+  SpacesFilterIndex::TypeSnapshot snapshot = m_filterIndex->typeSnapshot(SpacesFilterIndex::LoadType);
+  m_filterWorker->request([snapshot, loadType](const std::function<bool()>& isCancelled) {
+    return SpacesFilterIndex::visibleRowsOfType(snapshot, loadType, isCancelled);
+  });
 }
 
 void SpacesSubtabGridView::windExposureFilterChanged(const QString& text) {
-  m_objectsFilteredByWindExposure.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::WindExposure);
   } else {
-    // For a case-insensitive comparison later
-    std::string windExposureToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects returns Surfaces directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "windExposureFilterChanged, obj=" << obj.briefDescription());
-      const auto& surface = obj.optionalCast<model::Surface>();
-      if (surface) {
-        const auto& windExposure = surface->windExposure();
-        if (windExposure.empty() || !openstudio::istringEqual(windExposure, windExposureToKeep)) {
-          m_objectsFilteredByWindExposure.insert(obj);
-        }
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::WindExposure, toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::sunExposureFilterChanged(const QString& text) {
-  m_objectsFilteredBySunExposure.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SunExposure);
   } else {
-    // For a case-insensitive comparison later
-    std::string sunExposureToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects returns Surfaces directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "sunExposureFilterChanged, obj=" << obj.briefDescription());
-      const auto& surface = obj.optionalCast<model::Surface>();
-      if (surface) {
-        const auto& sunExposure = surface->sunExposure();
-        if (sunExposure.empty() || !openstudio::istringEqual(sunExposure, sunExposureToKeep)) {
-          m_objectsFilteredBySunExposure.insert(obj);
-        }
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::SunExposure, toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::outsideBoundaryConditionFilterChanged(const QString& text) {
-  m_objectsFilteredByOutsideBoundaryCondition.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::OutsideBoundaryCondition);
   } else {
-    // For a case-insensitive comparison later
-    std::string outsideBoundCondToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects returns either Surfaces or SubSurfaces directly, depending on the subtab it's on
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "outsideBoundaryConditionFilterChanged, obj=" << obj.briefDescription());
-      std::string outsideBoundaryCondition;
-      if (const auto& surface = obj.optionalCast<model::Surface>()) {
-        outsideBoundaryCondition = surface->outsideBoundaryCondition();
-      } else if (const auto& subSurface = obj.optionalCast<model::SubSurface>()) {
-        outsideBoundaryCondition = subSurface->outsideBoundaryCondition();
-      }
-      if (outsideBoundaryCondition.empty() || !openstudio::istringEqual(outsideBoundaryCondition, outsideBoundCondToKeep)) {
-        m_objectsFilteredByOutsideBoundaryCondition.insert(obj);
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::OutsideBoundaryCondition, toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::surfaceTypeFilterChanged(const QString& text) {
-  m_objectsFilteredBySurfaceType.clear();
-
   if (text == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::SurfaceType);
   } else {
-    // For a case-insensitive comparison later
-    std::string surfaceTypeToKeep = openstudio::toString(text);
-
-    // ObjectSelector::m_selectableObjects Surfaces directly
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      // LOG(Debug, "surfaceTypeFilterChanged, obj=" << obj.briefDescription());
-      const auto& surface = obj.optionalCast<model::Surface>();
-      if (surface) {
-        const auto& surfaceType = surface->surfaceType();
-        if (!openstudio::istringEqual(surfaceType, surfaceTypeToKeep)) {
-          m_objectsFilteredBySurfaceType.insert(obj);
-        }
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::SurfaceType, toString(text));
   }
 
   filterChanged();
 }
 
 void SpacesSubtabGridView::interiorPartitionGroupFilterChanged(const QString& text) {
-  m_objectsFilteredByInteriorPartitionGroup.clear();
-
   if (m_interiorPartitionGroupFilter->currentText() == ALL) {
-    // nothing to filter
+    m_filterIndex->clearFilter(SpacesFilterIndex::InteriorPartitionGroup);
   } else {
-    for (const auto& obj : this->m_gridController->selectorObjects()) {
-      const auto& interiorPartitionSurfaceGroup = obj.optionalCast<model::InteriorPartitionSurfaceGroup>();
-      if (interiorPartitionSurfaceGroup) {
-        if (!interiorPartitionSurfaceGroup->name() || (interiorPartitionSurfaceGroup->name().get().c_str() != text)) {
-          m_objectsFilteredByInteriorPartitionGroup.insert(obj);
-        }
-      }
-    }
+    m_filterIndex->setFilter(SpacesFilterIndex::InteriorPartitionGroup, toString(text));
   }
 
   filterChanged();
@@ -833,37 +688,16 @@ void SpacesSubtabGridView::interiorPartitionGroupFilterChanged(const QString& te
 
 void SpacesSubtabGridView::filterChanged() {
   // Note: JM 2018-08-21
-  // The distinction between these two is especially needed for the "Loads" Subtab
-  // because it can't match SpaceLoadInstances to a Space if the load is inherited from a SpaceType rather than the space
-
-  /****************************************************************************
-     * Filters that should apply at the ROW level because they are Space-related
-     ***************************************************************************/
-  std::set<openstudio::model::ModelObject> spaceFilteredObjects = m_objectsFilteredByStory;
-
-  spaceFilteredObjects.insert(m_objectsFilteredByThermalZone.begin(), m_objectsFilteredByThermalZone.end());
-  spaceFilteredObjects.insert(m_objectsFilteredBySpaceType.begin(), m_objectsFilteredBySpaceType.end());
-  spaceFilteredObjects.insert(m_objectsFilteredBySpaceName.begin(), m_objectsFilteredBySpaceName.end());
-
-  /***********************************************************************************
-     * Filters that should apply at the SUBROW level because they are DataObject-related
-     ***********************************************************************************/
-  std::set<openstudio::model::ModelObject> allFilteredObjects;
-
-  allFilteredObjects.insert(m_objectsFilteredBySubSurfaceType.begin(), m_objectsFilteredBySubSurfaceType.end());
-  allFilteredObjects.insert(m_objectsFilteredByWindExposure.begin(), m_objectsFilteredByWindExposure.end());
-  allFilteredObjects.insert(m_objectsFilteredBySunExposure.begin(), m_objectsFilteredBySunExposure.end());
-  allFilteredObjects.insert(m_objectsFilteredByOutsideBoundaryCondition.begin(), m_objectsFilteredByOutsideBoundaryCondition.end());
-  allFilteredObjects.insert(m_objectsFilteredBySurfaceType.begin(), m_objectsFilteredBySurfaceType.end());
-  allFilteredObjects.insert(m_objectsFilteredByInteriorPartitionGroup.begin(), m_objectsFilteredByInteriorPartitionGroup.end());
-  allFilteredObjects.insert(m_objectsFilteredByLoadType.begin(), m_objectsFilteredByLoadType.end());
-
-  // add space filters to all filters
-  allFilteredObjects.insert(spaceFilteredObjects.begin(), spaceFilteredObjects.end());
-
-  this->m_gridController->setObjectFilter([allFilteredObjects](const model::ModelObject& obj) -> bool {
-    // return false if object in allFilteredObjects
-    return allFilteredObjects.count(obj) == 0;
+  // The distinction between Space-related and DataObject-related filters is especially needed for the "Loads" Subtab
+  // because it can't match SpaceLoadInstances to a Space if the load is inherited from a SpaceType rather than the space.
+  // The index takes care of it: Story, ThermalZone, SpaceType and SpaceName only apply to the Space (ROW level) objects,
+  // the other filters only apply to the objects they describe (SUBROW level)
+  auto visibleRows = m_filterIndex->visibleRows();
+  std::shared_ptr<const SpacesFilterIndex> filterIndex = m_filterIndex;
+
+  this->m_gridController->setObjectFilter([filterIndex, visibleRows](const model::ModelObject& obj) -> bool {
+    // return false if obj's row is filtered out
+    return filterIndex->isVisible(visibleRows, obj.handle());
   });
 }
 
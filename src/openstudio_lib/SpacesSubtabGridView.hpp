@@ -37,11 +37,17 @@
 
 #include <openstudio/model/Model.hpp>
 
+#include <memory>
+
 class QComboBox;
 class QLineEdit;
 
 namespace openstudio {
 
+class SpacesFilterIndex;
+
+class SpacesFilterWorker;
+
 class SpacesSubsurfacesGridController;
 
 class SpacesSubtabGridView : public GridViewSubTab
@@ -128,30 +134,12 @@ class SpacesSubtabGridView : public GridViewSubTab
 
   void filterChanged();
 
-  // All these sets will store the objects that DO NEED to be hidden
-  // These objects should be the selector type objects
-  // So if the set is empty -> show all
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByStory;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByThermalZone;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySpaceType;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySubSurfaceType;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySpaceName;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByWindExposure;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySunExposure;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByOutsideBoundaryCondition;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredBySurfaceType;
-
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByInteriorPartitionGroup;
+  // Indices of the attributes the filters look at, kept up to date with the model.
+  // Shared with the object filter installed on the grid controller, which looks rows up by handle
+  std::shared_ptr<SpacesFilterIndex> m_filterIndex;
 
-  std::set<openstudio::model::ModelObject> m_objectsFilteredByLoadType;
+  // Evaluates the load type filter off the gui thread
+  SpacesFilterWorker* m_filterWorker = nullptr;
 
   QGridLayout* m_filterGridLayout = nullptr;
 
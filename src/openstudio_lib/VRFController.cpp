@@ -102,35 +102,58 @@ void VRFController::refreshNow() {
   if (!m_dirty) return;
 
   if (m_detailView) {
-    m_detailView->setId(OSItemId());
-    m_detailView->removeAllVRFTerminalViews();
+    refreshVRFSystemView(m_detailView, m_currentSystem, this);
+  }
 
-    if (m_currentSystem) {
-      m_detailView->setId(OSItemId(toQString(m_currentSystem->handle()), modelToSourceId(m_currentSystem->model()), false));
+  m_dirty = false;
+}
 
-      connect(m_detailView.data(), &VRFSystemView::inspectClicked, this, &VRFController::inspectOSItem);
+unsigned VRFController::refreshVRFSystemView(VRFSystemView* systemView,
+                                             const boost::optional<model::AirConditionerVariableRefrigerantFlow>& system,
+                                             VRFController* controller) {
+  OS_ASSERT(systemView);
 
-      std::vector<model::ZoneHVACTerminalUnitVariableRefrigerantFlow> terminals = m_currentSystem->terminals();
-      for (auto it = terminals.begin(); it != terminals.end(); ++it) {
-        auto vrfTerminalView = new VRFTerminalView();
-        vrfTerminalView->setId(OSItemId(toQString(it->handle()), modelToSourceId(it->model()), false));
-        m_detailView->addVRFTerminalView(vrfTerminalView);
-        connect(vrfTerminalView, &VRFTerminalView::componentDroppedOnZone, this, &VRFController::onVRFTerminalViewDrop);
-        connect(vrfTerminalView, &VRFTerminalView::removeZoneClicked, this, &VRFController::onRemoveZoneClicked);
-        connect(vrfTerminalView, &VRFTerminalView::removeTerminalClicked, this, &VRFController::onRemoveTerminalClicked);
-        connect(vrfTerminalView, &VRFTerminalView::terminalIconClicked, this, &VRFController::inspectOSItem);
-        if (boost::optional<model::ThermalZone> zone = it->thermalZone()) {
-          vrfTerminalView->zoneDropZone->setHasZone(true);
-          vrfTerminalView->removeZoneButtonItem->setVisible(true);
-          QString zoneName = QString::fromStdString(zone->name().get());
-          vrfTerminalView->zoneDropZone->setText(zoneName);
-          vrfTerminalView->zoneDropZone->setToolTip(zoneName);
-        }
+  unsigned createdTerminalViews = 0;
+
+  if (!system) {
+    systemView->setId(OSItemId());
+    systemView->removeAllVRFTerminalViews();
+
+    return createdTerminalViews;
+  }
+
+  systemView->setId(OSItemId(toQString(system->handle()), modelToSourceId(system->model()), false));
+
+  std::vector<std::pair<Handle, VRFTerminalView*>> terminalViews;
+
+  std::vector<model::ZoneHVACTerminalUnitVariableRefrigerantFlow> terminals = system->terminals();
+  for (auto it = terminals.begin(); it != terminals.end(); ++it) {
+    VRFTerminalView* vrfTerminalView = systemView->vrfTerminalView(it->handle());
+    if (!vrfTerminalView) {
+      vrfTerminalView = new VRFTerminalView();
+      vrfTerminalView->setId(OSItemId(toQString(it->handle()), modelToSourceId(it->model()), false));
+      if (controller) {
+        connect(vrfTerminalView, &VRFTerminalView::componentDroppedOnZone, controller, &VRFController::onVRFTerminalViewDrop);
+        connect(vrfTerminalView, &VRFTerminalView::removeZoneClicked, controller, &VRFController::onRemoveZoneClicked);
+        connect(vrfTerminalView, &VRFTerminalView::removeTerminalClicked, controller, &VRFController::onRemoveTerminalClicked);
+        connect(vrfTerminalView, &VRFTerminalView::terminalIconClicked, controller, &VRFController::inspectOSItem);
       }
+      ++createdTerminalViews;
     }
+
+    // Only repaints the zone drop zone if the zone name changed
+    if (boost::optional<model::ThermalZone> zone = it->thermalZone()) {
+      vrfTerminalView->setZoneName(QString::fromStdString(zone->name().get()));
+    } else {
+      vrfTerminalView->setZoneName(QString());
+    }
+
+    terminalViews.push_back(std::make_pair(it->handle(), vrfTerminalView));
   }
 
-  m_dirty = false;
+  systemView->setVRFTerminalViews(terminalViews);
+
+  return createdTerminalViews;
 }
 
 void VRFController::onVRFSystemViewDrop(const OSItemId& itemid) {
@@ -264,6 +287,7 @@ void VRFController::zoomInOnSystem(const model::AirConditionerVariableRefrigeran
 
   m_detailScene = QSharedPointer<QGraphicsScene>(new QGraphicsScene());
   m_detailView = new VRFSystemView();
+  connect(m_detailView.data(), &VRFSystemView::inspectClicked, this, &VRFController::inspectOSItem);
   connect(m_detailView->terminalDropZone, &OSDropZoneItem::componentDropped, this, &VRFController::onVRFSystemViewDrop);
   connect(m_detailView->zoneDropZone, &OSDropZoneItem::componentDropped, this, &VRFController::onVRFSystemViewZoneDrop);
   m_detailScene->addItem(m_detailView);
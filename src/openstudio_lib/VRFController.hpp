@@ -60,6 +60,11 @@ class VRFController : public QObject
 
   QSharedPointer<VRFSystemListController> vrfSystemListController() const;
 
+  // Sync systemView with the terminals of system, terminal views are kept by handle and only new terminals get a new view
+  // Their signals are connected to controller if one is given, returns the number of terminal views created
+  static unsigned refreshVRFSystemView(VRFSystemView* systemView, const boost::optional<model::AirConditionerVariableRefrigerantFlow>& system,
+                                       VRFController* controller = nullptr);
+
  public slots:
 
   void zoomInOnSystem(const model::AirConditionerVariableRefrigerantFlow& system);
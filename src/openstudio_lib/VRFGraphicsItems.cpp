@@ -185,12 +185,6 @@ void VRFSystemView::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
   }
 }
 
-void VRFSystemView::addVRFTerminalView(VRFTerminalView* view) {
-  m_terminalViews.push_back(view);
-  view->setParentItem(this);
-  adjustLayout();
-}
-
 void VRFSystemView::removeAllVRFTerminalViews() {
   prepareGeometryChange();
 
@@ -199,6 +193,21 @@ void VRFSystemView::removeAllVRFTerminalViews() {
     it = m_terminalViews.erase(it);
   }
 
+  m_terminalViewsByHandle.clear();
+
+  adjustLayout();
+}
+
+VRFTerminalView* VRFSystemView::vrfTerminalView(const Handle& handle) const {
+  auto it = m_terminalViewsByHandle.find(handle);
+  return (it != m_terminalViewsByHandle.end()) ? it->second : nullptr;
+}
+
+void VRFSystemView::setVRFTerminalViews(const std::vector<std::pair<Handle, VRFTerminalView*>>& terminalViews) {
+  prepareGeometryChange();
+
+  setKeyedChildViews(this, terminalViews, m_terminalViews, m_terminalViewsByHandle);
+
   adjustLayout();
 }
 
@@ -237,6 +246,24 @@ void VRFTerminalView::setId(const OSItemId& id) {
   m_id = id;
 }
 
+void VRFTerminalView::setZoneName(const QString& zoneName) {
+  if (zoneName == m_zoneName) {
+    return;
+  }
+
+  m_zoneName = zoneName;
+
+  bool hasZone = !m_zoneName.isEmpty();
+  zoneDropZone->setHasZone(hasZone);
+  removeZoneButtonItem->setVisible(hasZone);
+  zoneDropZone->setText(hasZone ? m_zoneName : QString("Drop Thermal Zone"));
+  zoneDropZone->setToolTip(m_zoneName);
+}
+
+QString VRFTerminalView::zoneName() const {
+  return m_zoneName;
+}
+
 void VRFTerminalView::onComponenDroppedOnZone(const OSItemId& dropComponentID) {
   emit componentDroppedOnZone(m_id, dropComponentID);
 }
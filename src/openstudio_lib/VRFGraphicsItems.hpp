@@ -36,6 +36,8 @@
 #include "../shared_gui_components/OSListController.hpp"
 #include "../shared_gui_components/OSListView.hpp"
 #include "../shared_gui_components/GraphicsItems.hpp"
+#include <openstudio/utilities/idf/Handle.hpp>
+#include <map>
 
 class QGraphicsView;
 class QPushButton;
@@ -141,9 +143,14 @@ class VRFSystemView : public QGraphicsObject
   static const int dropZoneHeight;
   static const int terminalViewHeight;
 
-  void addVRFTerminalView(VRFTerminalView* view);
   void removeAllVRFTerminalViews();
 
+  // Terminal view of the terminal with this handle, nullptr if there is none
+  VRFTerminalView* vrfTerminalView(const Handle& handle) const;
+
+  // Display these terminal views in this order, terminal views that are no longer listed are deleted
+  void setVRFTerminalViews(const std::vector<std::pair<Handle, VRFTerminalView*>>& terminalViews);
+
  signals:
 
   void inspectClicked(const OSItemId& id);
@@ -165,6 +172,8 @@ class VRFSystemView : public QGraphicsObject
 
   std::vector<QGraphicsObject*> m_terminalViews;
 
+  std::map<Handle, VRFTerminalView*> m_terminalViewsByHandle;
+
   OSItemId m_id;
   QPixmap m_vrfPixmap;
 };
@@ -192,6 +201,11 @@ class VRFTerminalView : public QGraphicsObject
 
   void setId(const OSItemId& id);
 
+  // Name of the thermal zone served by the terminal, empty if there is none
+  void setZoneName(const QString& zoneName);
+
+  QString zoneName() const;
+
  signals:
 
   void componentDroppedOnZone(const OSItemId& zoneHVACTerminalID, const OSItemId& dropComponentID);
@@ -221,6 +235,8 @@ class VRFTerminalView : public QGraphicsObject
   QPixmap m_terminalPixmap;
 
   OSItemId m_id;
+
+  QString m_zoneName;
 };
 
 class VRFThermalZoneDropZoneView : public OSDropZoneItem
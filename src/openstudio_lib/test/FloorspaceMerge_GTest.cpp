@@ -0,0 +1,302 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../FloorspaceMerge.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Building.hpp>
+#include <openstudio/model/Building_Impl.hpp>
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/BuildingStory_Impl.hpp>
+#include <openstudio/model/FloorplanJSForwardTranslator.hpp>
+#include <openstudio/model/ModelMerger.hpp>
+#include <openstudio/model/RenderingColor.hpp>
+#include <openstudio/model/RenderingColor_Impl.hpp>
+#include <openstudio/model/Site.hpp>
+#include <openstudio/model/Site_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+#include <openstudio/model/SubSurface.hpp>
+#include <openstudio/model/SubSurface_Impl.hpp>
+#include <openstudio/model/Surface.hpp>
+#include <openstudio/model/Surface_Impl.hpp>
+
+#include <openstudio/utilities/core/Compare.hpp>
+#include <openstudio/utilities/core/Filesystem.hpp>
+#include <openstudio/utilities/geometry/FloorplanJS.hpp>
+#include <openstudio/utilities/geometry/Point3d.hpp>
+
+#include "../../utilities/OpenStudioApplicationPathHelpers.hpp"
+
+#include <json/json.h>
+
+#include <cmath>
+#include <set>
+#include <sstream>
+
+using namespace openstudio;
+
+namespace {
+
+FloorplanJS loadTwoSpaces() {
+  openstudio::path p = getOpenStudioApplicationSourceDirectory() / openstudio::toPath("src/openstudio_lib/test/floorplans/two_spaces.json");
+  openstudio::filesystem::ifstream ifs(p);
+  OS_ASSERT(ifs.is_open());
+  std::string contents((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+  ifs.close();
+  boost::optional<FloorplanJS> floorplan = FloorplanJS::load(contents);
+  OS_ASSERT(floorplan);
+  return *floorplan;
+}
+
+// same as FloorspaceEditor::updateModel
+FloorplanJS updateFromModel(const FloorplanJS& floorplan, const model::Model& model) {
+  model::FloorplanJSForwardTranslator ft;
+  return ft.updateFloorplanJS(floorplan, model, false);
+}
+
+FloorspaceTranslation translate(const FloorplanJS& floorplan, const model::Model& model) {
+  return FloorspaceChangeSet::translate(floorplan, model, model.getUniqueModelObject<model::Building>().nameString(),
+                                        model.getUniqueModelObject<model::Site>().nameString(), boost::none);
+}
+
+// moves a vertex that only belongs to the first space, as if the user dragged it in the editor
+FloorplanJS moveVertex(const FloorplanJS& floorplan, const std::string& vertexId, double x, double y) {
+  Json::CharReaderBuilder rbuilder;
+  std::istringstream ss(floorplan.toJSON(false));
+  std::string errors;
+  Json::Value value;
+  bool parsed = Json::parseFromStream(rbuilder, ss, &value, &errors);
+  OS_ASSERT(parsed);
+  for (auto& vertex : value["stories"][0]["geometry"]["vertices"]) {
+    if (vertex["id"].asString() == vertexId) {
+      vertex["x"] = x;
+      vertex["y"] = y;
+    }
+  }
+  Json::StreamWriterBuilder wbuilder;
+  boost::optional<FloorplanJS> result = FloorplanJS::load(Json::writeString(wbuilder, value));
+  OS_ASSERT(result);
+  return *result;
+}
+
+bool sameVertices(const std::vector<Point3d>& a, const std::vector<Point3d>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t offset = 0; offset < a.size(); ++offset) {
+    bool equal = true;
+    for (size_t i = 0; i < a.size() && equal; ++i) {
+      const Point3d& p = a[i];
+      const Point3d& q = b[(i + offset) % b.size()];
+      equal = (std::abs(p.x() - q.x()) < 0.001) && (std::abs(p.y() - q.y()) < 0.001) && (std::abs(p.z() - q.z()) < 0.001);
+    }
+    if (equal) {
+      return true;
+    }
+  }
+  return a.empty();
+}
+
+std::string adjacentSpaceName(const model::Surface& surface) {
+  boost::optional<model::Surface> adjacentSurface = surface.adjacentSurface();
+  if (adjacentSurface && adjacentSurface->space()) {
+    return adjacentSurface->space()->nameString();
+  }
+  return std::string();
+}
+
+// every space has the same surfaces in both models, compared by geometry
+void expectSameGeometry(const model::Model& expected, const model::Model& actual) {
+  std::vector<model::Space> expectedSpaces = expected.getConcreteModelObjects<model::Space>();
+  ASSERT_EQ(expectedSpaces.size(), actual.getConcreteModelObjects<model::Space>().size());
+  for (const auto& expectedSpace : expectedSpaces) {
+    boost::optional<model::Space> actualSpace = actual.getModelObject<model::Space>(expectedSpace.handle());
+    ASSERT_TRUE(actualSpace);
+    EXPECT_EQ(expectedSpace.nameString(), actualSpace->nameString());
+
+    std::vector<model::Surface> actualSurfaces = actualSpace->surfaces();
+    std::vector<model::Surface> expectedSurfaces = expectedSpace.surfaces();
+    ASSERT_EQ(expectedSurfaces.size(), actualSurfaces.size()) << expectedSpace.nameString();
+
+    std::set<Handle> used;
+    for (const auto& expectedSurface : expectedSurfaces) {
+      bool found = false;
+      for (const auto& actualSurface : actualSurfaces) {
+        if ((used.find(actualSurface.handle()) == used.end()) && istringEqual(expectedSurface.surfaceType(), actualSurface.surfaceType())
+            && istringEqual(expectedSurface.outsideBoundaryCondition(), actualSurface.outsideBoundaryCondition())
+            && (adjacentSpaceName(expectedSurface) == adjacentSpaceName(actualSurface))
+            && (expectedSurface.subSurfaces().size() == actualSurface.subSurfaces().size())
+            && sameVertices(expectedSurface.vertices(), actualSurface.vertices())) {
+          used.insert(actualSurface.handle());
+          found = true;
+          break;
+        }
+      }
+      EXPECT_TRUE(found) << expectedSpace.nameString() << " " << expectedSurface.nameString();
+    }
+  }
+}
+
+}  // namespace
+
+class FloorspaceMergeTest : public OpenStudioLibFixture
+{
+ protected:
+  virtual void SetUp() override {
+    OpenStudioLibFixture::SetUp();
+
+    // initial merge of the floorplan, then round trip so the floorplan knows the model handles
+    floorplan = updateFromModel(loadTwoSpaces(), model);
+    FloorspaceTranslation translation = translate(floorplan, model);
+    ASSERT_TRUE(translation.exportModel);
+    model::ModelMerger mm;
+    mm.mergeModels(model, *translation.exportModel, translation.handleMapping);
+    floorplan = updateFromModel(floorplan, model);
+
+    ASSERT_EQ(2u, model.getConcreteModelObjects<model::Space>().size());
+  }
+
+  // applies translation to two copies of model, one with the full merge and one with the change set
+  void compareMerges(const std::function<void(model::Model&)>& editExport, unsigned expectedChangedSpaces) {
+    model::Model fullModel = model.clone(true).cast<model::Model>();
+    model::Model incrementalModel = model.clone(true).cast<model::Model>();
+
+    FloorspaceTranslation fullTranslation = translate(editedFloorplan, fullModel);
+    ASSERT_TRUE(fullTranslation.exportModel);
+    editExport(*fullTranslation.exportModel);
+    model::ModelMerger mm;
+    mm.mergeModels(fullModel, *fullTranslation.exportModel, fullTranslation.handleMapping);
+
+    FloorspaceTranslation incrementalTranslation = translate(editedFloorplan, incrementalModel);
+    ASSERT_TRUE(incrementalTranslation.exportModel);
+    editExport(*incrementalTranslation.exportModel);
+    FloorspaceChangeSet changeSet =
+      FloorspaceChangeSet::compute(incrementalModel, *incrementalTranslation.exportModel, incrementalTranslation.handleMapping);
+    ASSERT_TRUE(changeSet.isIncremental());
+    EXPECT_EQ(expectedChangedSpaces, changeSet.spaceChanges().size());
+
+    // surfaces of the untouched space are not replaced
+    std::set<Handle> changedSpaces;
+    for (const auto& changes : changeSet.spaceChanges()) {
+      changedSpaces.insert(changes.currentSpace);
+    }
+    std::set<Handle> untouchedSurfaces;
+    for (const auto& space : incrementalModel.getConcreteModelObjects<model::Space>()) {
+      if (changedSpaces.find(space.handle()) == changedSpaces.end()) {
+        for (const auto& surface : space.surfaces()) {
+          untouchedSurfaces.insert(surface.handle());
+        }
+      }
+    }
+
+    ASSERT_TRUE(changeSet.apply(incrementalModel, *incrementalTranslation.exportModel));
+
+    for (const auto& handle : untouchedSurfaces) {
+      EXPECT_TRUE(incrementalModel.getModelObject<model::Surface>(handle));
+    }
+
+    expectSameGeometry(fullModel, incrementalModel);
+  }
+
+  // edits the export of the unchanged floorplan, the change set must fall back to the full merge
+  void expectFullMerge(const std::function<void(model::Model&)>& editExport) {
+    FloorspaceTranslation translation = translate(floorplan, model);
+    ASSERT_TRUE(translation.exportModel);
+    editExport(*translation.exportModel);
+    FloorspaceChangeSet changeSet = FloorspaceChangeSet::compute(model, *translation.exportModel, translation.handleMapping);
+    EXPECT_FALSE(changeSet.isIncremental());
+    EXPECT_FALSE(changeSet.empty());
+    EXPECT_FALSE(changeSet.apply(model, *translation.exportModel));
+  }
+
+  model::Model model;
+  FloorplanJS floorplan;
+  FloorplanJS editedFloorplan;
+};
+
+TEST_F(FloorspaceMergeTest, FloorspaceMerge_Unchanged) {
+  FloorspaceTranslation translation = translate(floorplan, model);
+  ASSERT_TRUE(translation.exportModel);
+  FloorspaceChangeSet changeSet = FloorspaceChangeSet::compute(model, *translation.exportModel, translation.handleMapping);
+  EXPECT_TRUE(changeSet.isIncremental());
+  EXPECT_TRUE(changeSet.empty());
+}
+
+TEST_F(FloorspaceMergeTest, FloorspaceMerge_MoveVertex) {
+  // vertex 5 is only on the first space
+  editedFloorplan = moveVertex(floorplan, "5", -25, -20);
+  compareMerges([](model::Model&) {}, 1u);
+}
+
+TEST_F(FloorspaceMergeTest, FloorspaceMerge_AddWindow) {
+  editedFloorplan = floorplan;
+  auto addWindow = [](model::Model& exportModel) {
+    for (auto& space : exportModel.getConcreteModelObjects<model::Space>()) {
+      if (space.nameString() != "Space 1 - 1") {
+        continue;
+      }
+      for (auto& surface : space.surfaces()) {
+        if (istringEqual(surface.surfaceType(), "Wall") && istringEqual(surface.outsideBoundaryCondition(), "Outdoors")) {
+          EXPECT_TRUE(surface.setWindowToWallRatio(0.3));
+          return;
+        }
+      }
+    }
+    FAIL() << "No exterior wall on Space 1 - 1";
+  };
+  compareMerges(addWindow, 1u);
+}
+
+TEST_F(FloorspaceMergeTest, FloorspaceMerge_StoryHeight) {
+  ASSERT_FALSE(model.getConcreteModelObjects<model::BuildingStory>().empty());
+  expectFullMerge([](model::Model& exportModel) {
+    std::vector<model::BuildingStory> stories = exportModel.getConcreteModelObjects<model::BuildingStory>();
+    ASSERT_FALSE(stories.empty());
+    double height = stories[0].nominalFloortoFloorHeight().value_or(3.0);
+    EXPECT_TRUE(stories[0].setNominalFloortoFloorHeight(height + 1.0));
+  });
+}
+
+TEST_F(FloorspaceMergeTest, FloorspaceMerge_RenderingColor) {
+  expectFullMerge([](model::Model& exportModel) {
+    std::vector<model::BuildingStory> stories = exportModel.getConcreteModelObjects<model::BuildingStory>();
+    ASSERT_FALSE(stories.empty());
+    boost::optional<model::RenderingColor> color = stories[0].renderingColor();
+    if (!color) {
+      color = model::RenderingColor(exportModel);
+      EXPECT_TRUE(stories[0].setRenderingColor(*color));
+    }
+    EXPECT_TRUE(color->setRenderingRedValue((color->renderingRedValue() + 128) % 256));
+  });
+}
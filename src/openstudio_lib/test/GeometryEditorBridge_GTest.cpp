@@ -0,0 +1,185 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../GeometryEditorBridge.hpp"
+
+#include <QElapsedTimer>
+#include <QWebEnginePage>
+
+#include <functional>
+
+using namespace openstudio;
+
+namespace {
+
+// process events until the debounce interval has certainly passed
+void waitForDebounce(std::function<void()> processEvents, int msec) {
+  QElapsedTimer timer;
+  timer.start();
+  while (timer.elapsed() < 4 * msec) {
+    processEvents();
+  }
+}
+
+// process events until done or timed out, returns done
+bool waitFor(std::function<void()> processEvents, std::function<bool()> done, int msec = 10000) {
+  QElapsedTimer timer;
+  timer.start();
+  while (!done() && timer.elapsed() < msec) {
+    processEvents();
+  }
+  return done();
+}
+
+// stands in for the floorspace editor, only the api the bridge script hooks into
+const QString editorPage("<!DOCTYPE html><html><head><script>\n\
+window.versionNumber = 0;\n\
+window.api = { config: {} };\n\
+</script></head><body></body></html>");
+
+}  // namespace
+
+TEST_F(OpenStudioLibFixture, GeometryEditorBridge_Debounce) {
+  const int debounceMSec = 50;
+  GeometryEditorBridge bridge(nullptr, debounceMSec);
+
+  unsigned numChanged = 0;
+  QObject::connect(&bridge, &GeometryEditorBridge::changed, [&numChanged]() { ++numChanged; });
+  auto process = [this]() { processEvents(); };
+
+  // page connecting reports its current version, nothing changed yet
+  EXPECT_FALSE(bridge.pageConnected());
+  bridge.notifyChanged(0);
+  EXPECT_TRUE(bridge.pageConnected());
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(0u, numChanged);
+
+  // synthetic burst of edits from the page is reported once
+  for (unsigned version = 1; version <= 20; ++version) {
+    bridge.notifyChanged(version);
+  }
+  EXPECT_TRUE(bridge.hasPendingChange());
+  EXPECT_EQ(0u, numChanged);
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(1u, numChanged);
+  EXPECT_FALSE(bridge.hasPendingChange());
+  EXPECT_EQ(20u, bridge.reportedVersionNumber());
+
+  // same version again is not a change
+  bridge.notifyChanged(20);
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(1u, numChanged);
+
+  // suspended changes stay pending until resumed
+  EXPECT_FALSE(bridge.setSuspended(true));
+  bridge.notifyChanged(21);
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(1u, numChanged);
+  EXPECT_TRUE(bridge.hasPendingChange());
+  EXPECT_TRUE(bridge.setSuspended(false));
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(2u, numChanged);
+
+  // pending change can be taken without waiting, e.g. when the editor closes
+  bridge.notifyChanged(22);
+  EXPECT_TRUE(bridge.takePendingChange());
+  EXPECT_FALSE(bridge.takePendingChange());
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(2u, numChanged);
+
+  // reload
+  bridge.reset();
+  EXPECT_EQ(0u, bridge.versionNumber());
+  EXPECT_FALSE(bridge.pageConnected());
+  EXPECT_FALSE(bridge.hasPendingChange());
+  bridge.notifyChanged(1);
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(3u, numChanged);
+}
+
+TEST_F(OpenStudioLibFixture, GeometryEditorBridge_WebChannel) {
+  const int debounceMSec = 50;
+  GeometryEditorBridge bridge(nullptr, debounceMSec);
+
+  unsigned numChanged = 0;
+  QObject::connect(&bridge, &GeometryEditorBridge::changed, [&numChanged]() { ++numChanged; });
+  auto process = [this]() { processEvents(); };
+
+  // same channel and scripts as the editor's page
+  QWebEnginePage page;
+  bridge.attachToPage(&page);
+
+  auto loadPage = [&page, &process]() {
+    bool loaded = false;
+    auto connection = QObject::connect(&page, &QWebEnginePage::loadFinished, [&loaded](bool ok) { loaded = ok; });
+    page.setHtml(editorPage, QUrl("qrc:/"));
+    bool result = waitFor(process, [&loaded]() { return loaded; });
+    QObject::disconnect(connection);
+    return result;
+  };
+
+  auto runJavaScript = [&page, &process](const QString& javascript) {
+    bool finished = false;
+    page.runJavaScript(javascript, [&finished](const QVariant&) { finished = true; });
+    return waitFor(process, [&finished]() { return finished; });
+  };
+
+  ASSERT_TRUE(loadPage());
+  ASSERT_TRUE(runJavaScript(GeometryEditorBridge::onChangeJavaScript()));
+
+  // the page connects through the web channel and reports its version
+  ASSERT_TRUE(waitFor(process, [&bridge]() { return bridge.pageConnected(); }));
+  EXPECT_EQ(0u, bridge.versionNumber());
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(0u, numChanged);
+
+  // a burst of edits in the page is reported once
+  ASSERT_TRUE(runJavaScript("for (var i = 0; i < 20; ++i) { window.api.config.onChange(); }"));
+  ASSERT_TRUE(waitFor(process, [&bridge]() { return bridge.versionNumber() == 20u; }));
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(1u, numChanged);
+  EXPECT_EQ(20u, bridge.reportedVersionNumber());
+
+  // a reloaded page is not connected until its script runs again
+  bridge.reset();
+  EXPECT_FALSE(bridge.pageConnected());
+  ASSERT_TRUE(loadPage());
+  ASSERT_TRUE(runJavaScript(GeometryEditorBridge::onChangeJavaScript()));
+  ASSERT_TRUE(waitFor(process, [&bridge]() { return bridge.pageConnected(); }));
+  EXPECT_EQ(0u, bridge.versionNumber());
+
+  ASSERT_TRUE(runJavaScript("window.api.config.onChange();"));
+  ASSERT_TRUE(waitFor(process, [&bridge]() { return bridge.versionNumber() == 1u; }));
+  waitForDebounce(process, debounceMSec);
+  EXPECT_EQ(2u, numChanged);
+}
@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../GeometryPreviewTransport.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ThreeJSForwardTranslator.hpp>
+
+#include <openstudio/utilities/geometry/ThreeJS.hpp>
+
+#include <QtConcurrent>
+
+#include <atomic>
+#include <vector>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, GeometryPreviewTransport_ChunkedScene) {
+  model::Model model = model::exampleModel();
+
+  model::ThreeJSForwardTranslator ft;
+  std::string expected = ft.modelToThreeJS(model, true).toJSON(false);
+
+  // same path as PreviewWebView, translate on a worker thread
+  std::atomic<int> numProgress(0);
+  std::function<void(double)> updatePercentage = [&numProgress](double) { ++numProgress; };
+  QFuture<QString> future = QtConcurrent::run(&GeometryPreviewTransport::translate, model, updatePercentage);
+  future.waitForFinished();
+  EXPECT_LT(0, numProgress);
+
+  GeometryPreviewTransport transport(nullptr, 4096);
+  transport.setJSON(future.result());
+  ASSERT_LT(1, transport.chunkCount());
+
+  QString reassembled;
+  for (int i = 0; i < transport.chunkCount(); ++i) {
+    QString chunk = transport.chunk(i);
+    EXPECT_FALSE(chunk.isEmpty());
+    EXPECT_GE(transport.chunkSize(), chunk.size());
+    reassembled += chunk;
+  }
+  EXPECT_EQ(expected, reassembled.toStdString());
+
+  EXPECT_TRUE(transport.chunk(-1).isEmpty());
+  EXPECT_TRUE(transport.chunk(transport.chunkCount()).isEmpty());
+
+  transport.setJSON(QString());
+  EXPECT_EQ(0, transport.chunkCount());
+}
+
+TEST_F(OpenStudioLibFixture, GeometryPreviewTransport_SceneLoaded) {
+  GeometryPreviewTransport transport;
+
+  // the page reports whether it built the scene, so the document is re-enabled either way
+  std::vector<bool> loaded;
+  QObject::connect(&transport, &GeometryPreviewTransport::sceneLoaded, [&loaded](bool ok) { loaded.push_back(ok); });
+
+  transport.onSceneLoaded(true);
+  transport.onSceneLoaded(false);
+  EXPECT_EQ(std::vector<bool>({true, false}), loaded);
+}
@@ -0,0 +1,123 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../../shared_gui_components/GridLayoutProfiles.hpp"
+#include "../../shared_gui_components/OSGridController.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+
+#include <QSettings>
+
+using namespace openstudio;
+
+namespace {
+
+class ProfileGridController : public OSGridController
+{
+ public:
+  ProfileGridController(const QString& headerText, const model::Model& model, const std::vector<model::ModelObject>& modelObjects)
+    : OSGridController(false, headerText, IddObjectType::OS_Space, model, modelObjects) {}
+
+  virtual ~ProfileGridController() {}
+
+  virtual void refreshModelObjects() override {}
+
+  virtual void onItemDropped(const OSItemId& itemId) override {}
+
+ protected:
+  virtual void addColumns(const QString& t_category, std::vector<QString>& fields) override {}
+
+  virtual QString getColor(const model::ModelObject& modelObject) override {
+    return "";
+  }
+};
+
+}  // namespace
+
+TEST_F(OpenStudioLibFixture, GridLayoutProfiles) {
+  const QString organization("OpenStudio");
+  const QString application("GridLayoutProfiles_GTest");
+  QSettings(organization, application).clear();
+
+  GridLayoutProfiles::setInstanceSettings(organization, application);
+  GridLayoutProfiles& profiles = GridLayoutProfiles::instance();
+
+  model::Model model;
+  std::vector<model::ModelObject> spaces;
+  for (int i = 0; i < 10; ++i) {
+    spaces.push_back(model::Space(model));
+  }
+
+  // Grids are built from memory, the settings are read once
+  for (int i = 0; i < 20; ++i) {
+    ProfileGridController grid("Spaces", model, spaces);
+    EXPECT_TRUE(getCustomFields(&grid).empty());
+  }
+  EXPECT_EQ(1u, profiles.settingsReads());
+
+  // Unchanged profiles are not written
+  processEvents();
+  EXPECT_EQ(0u, profiles.settingsWrites());
+
+  // Changes made during one event are written together
+  profiles.setCustomFields("Spaces", {"Name"});
+  profiles.setCustomFields("Spaces", {"Name", "Multiplier"});
+  profiles.setCustomFields("Thermal Zones", {"Ideal Air Loads"});
+  EXPECT_EQ(0u, profiles.settingsWrites());
+
+  const std::vector<QString> expected{"Name", "Multiplier"};
+  for (int i = 0; i < 20; ++i) {
+    ProfileGridController grid("Spaces", model, spaces);
+    EXPECT_EQ(expected, getCustomFields(&grid));
+  }
+  EXPECT_EQ(1u, profiles.settingsReads());
+
+  processEvents();
+  profiles.flush();
+  EXPECT_EQ(1u, profiles.settingsWrites());
+
+  // The custom fields come back from the settings
+  {
+    GridLayoutProfiles reloaded(organization, application);
+    EXPECT_EQ(expected, reloaded.customFields("Spaces"));
+    EXPECT_EQ(std::vector<QString>{"Ideal Air Loads"}, reloaded.customFields("Thermal Zones"));
+    EXPECT_TRUE(reloaded.customFields("Space Types").empty());
+    EXPECT_EQ(1u, reloaded.settingsReads());
+    EXPECT_EQ(0u, reloaded.settingsWrites());
+  }
+
+  GridLayoutProfiles::setInstanceSettings(organization, "GridLayoutProfiles");
+  QSettings(organization, application).clear();
+}
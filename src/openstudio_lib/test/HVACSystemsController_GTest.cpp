@@ -0,0 +1,179 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../HVACSystemsController.hpp"
+#include "../HVACSystemsView.hpp"
+#include "../../model_editor/Utilities.hpp"
+#include "../../shared_gui_components/OSComboBox.hpp"
+
+#include <openstudio/model/AirLoopHVAC.hpp>
+#include <openstudio/model/AirLoopHVACOutdoorAirSystem.hpp>
+#include <openstudio/model/AvailabilityManagerHighTemperatureTurnOff.hpp>
+#include <openstudio/model/AvailabilityManagerNightCycle.hpp>
+#include <openstudio/model/ControllerOutdoorAir.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/PlantLoop.hpp>
+#include <openstudio/model/ScheduleConstant.hpp>
+#include <openstudio/model/Space.hpp>
+
+using namespace openstudio;
+
+namespace {
+
+QComboBox* systemComboBox(const HVACSystemsController& controller) {
+  return controller.hvacSystemsView()->hvacToolbarView->systemComboBox;
+}
+
+}  // namespace
+
+TEST_F(OpenStudioLibFixture, HVACSystemsController_NonLoopObjects) {
+  model::Model model;
+  model::AirLoopHVAC airLoop(model);
+  airLoop.setName("Air Loop 1");
+  model::PlantLoop plantLoop(model);
+  plantLoop.setName("Plant Loop 1");
+
+  HVACSystemsController controller(true, model);
+  QComboBox* comboBox = systemComboBox(controller);
+
+  // 2 loops + Service Hot Water, Refrigeration and VRF
+  ASSERT_EQ(5, comboBox->count());
+  EXPECT_EQ(2u, controller.systemRowChangeCount());
+
+  for (int i = 0; i < 500; ++i) {
+    model::ScheduleConstant schedule(model);
+    model::Space space(model);
+  }
+
+  // no loop row was inserted or removed, the combo box was not refilled
+  EXPECT_EQ(2u, controller.systemRowChangeCount());
+  EXPECT_EQ(5, comboBox->count());
+  EXPECT_EQ("Air Loop 1", comboBox->itemText(0).toStdString());
+  EXPECT_EQ("Plant Loop 1", comboBox->itemText(1).toStdString());
+}
+
+TEST_F(OpenStudioLibFixture, HVACSystemsController_IncrementalLoops) {
+  model::Model model;
+  model::AirLoopHVAC airLoopB(model);
+  airLoopB.setName("B Air Loop");
+  model::PlantLoop plantLoop(model);
+  plantLoop.setName("Plant Loop 1");
+
+  HVACSystemsController controller(true, model);
+  QComboBox* comboBox = systemComboBox(controller);
+  ASSERT_EQ(5, comboBox->count());
+
+  // added loops are inserted in their sorted row
+  model::AirLoopHVAC airLoopC(model);
+  airLoopC.setName("C Air Loop");
+  model::AirLoopHVAC airLoopA(model);
+  airLoopA.setName("A Air Loop");
+
+  ASSERT_EQ(7, comboBox->count());
+  EXPECT_EQ(toQString(airLoopA.handle()), comboBox->itemData(0).toString());
+  EXPECT_EQ(toQString(airLoopB.handle()), comboBox->itemData(1).toString());
+  EXPECT_EQ(toQString(airLoopC.handle()), comboBox->itemData(2).toString());
+  EXPECT_EQ(toQString(plantLoop.handle()), comboBox->itemData(3).toString());
+
+  // renaming moves only that row within the air loops
+  unsigned rowChangeCount = controller.systemRowChangeCount();
+  airLoopA.setName("D Air Loop");
+  EXPECT_EQ(rowChangeCount + 2, controller.systemRowChangeCount());
+  EXPECT_EQ("D Air Loop", comboBox->itemText(2).toStdString());
+  EXPECT_EQ(toQString(airLoopA.handle()), comboBox->itemData(2).toString());
+  EXPECT_EQ(toQString(airLoopB.handle()), comboBox->itemData(0).toString());
+
+  // removing drops only that row
+  Handle handleC = airLoopC.handle();
+  rowChangeCount = controller.systemRowChangeCount();
+  airLoopC.remove();
+  EXPECT_EQ(rowChangeCount + 1, controller.systemRowChangeCount());
+  ASSERT_EQ(6, comboBox->count());
+  EXPECT_EQ(-1, comboBox->findData(toQString(handleC)));
+  EXPECT_EQ(toQString(airLoopA.handle()), comboBox->itemData(1).toString());
+  EXPECT_EQ(toQString(plantLoop.handle()), comboBox->itemData(2).toString());
+
+  // renaming the plant loop does not touch the air loop rows
+  rowChangeCount = controller.systemRowChangeCount();
+  plantLoop.setName("Plant Loop 2");
+  EXPECT_EQ(rowChangeCount + 2, controller.systemRowChangeCount());
+  EXPECT_EQ("Plant Loop 2", comboBox->itemText(2).toStdString());
+  EXPECT_EQ(toQString(airLoopB.handle()), comboBox->itemData(0).toString());
+  EXPECT_EQ(toQString(airLoopA.handle()), comboBox->itemData(1).toString());
+}
+
+TEST_F(OpenStudioLibFixture, HVACControlsController_AvailabilityManagerField) {
+  model::Model model;
+  model::AirLoopHVAC airLoop(model);
+  model::ControllerOutdoorAir controllerOutdoorAir(model);
+  model::AirLoopHVACOutdoorAirSystem oaSystem(model, controllerOutdoorAir);
+  oaSystem.addToNode(airLoop.supplyOutletNode());
+
+  model::AvailabilityManagerNightCycle nightCycle(model);
+  EXPECT_TRUE(airLoop.addAvailabilityManager(nightCycle));
+  model::AvailabilityManagerHighTemperatureTurnOff highTemperatureTurnOff(model);
+  EXPECT_TRUE(airLoop.addAvailabilityManager(highTemperatureTurnOff));
+
+  HVACSystemsController systemsController(true, model);
+  systemsController.setCurrentHandle(toQString(airLoop.handle()));
+
+  HVACControlsController controlsController(&systemsController);
+  controlsController.refreshNow();
+
+  const std::vector<HVACControlsController::Section> airLoopSections{
+    HVACControlsController::NameSection,         HVACControlsController::CoolingHeatingTypeSection,
+    HVACControlsController::HVACOperationSection, HVACControlsController::NightCycleSection,
+    HVACControlsController::VentilationSection,  HVACControlsController::SupplyAirTemperatureSection,
+    HVACControlsController::AvailabilityManagerSection};
+  for (const auto& section : airLoopSections) {
+    EXPECT_EQ(1u, controlsController.sectionRefreshCount(section)) << section;
+  }
+
+  // a field of an availability manager no section displays
+  highTemperatureTurnOff.setTemperature(35.0);
+  controlsController.refreshNow();
+  for (const auto& section : airLoopSections) {
+    EXPECT_EQ(1u, controlsController.sectionRefreshCount(section)) << section;
+  }
+
+  // the night cycle control type is only shown by the night cycle section
+  nightCycle.setControlType("CycleOnAny");
+  controlsController.refreshNow();
+  for (const auto& section : airLoopSections) {
+    unsigned expected = (section == HVACControlsController::NightCycleSection) ? 2u : 1u;
+    EXPECT_EQ(expected, controlsController.sectionRefreshCount(section)) << section;
+  }
+
+  QComboBox* nightCycleComboBox = controlsController.hvacAirLoopControlsView()->nightCycleComboBox;
+  EXPECT_EQ("CycleOnAny", nightCycleComboBox->currentData().toString().toStdString());
+}
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../LoopScene.hpp"
+#include "../PixmapRenderCache.hpp"
+
+#include <openstudio/model/BoilerHotWater.hpp>
+#include <openstudio/model/CoilHeatingWater.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/PlantLoop.hpp>
+
+#include <QGraphicsView>
+#include <QImage>
+#include <QPainter>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+model::PlantLoop makePlantLoopWithNBranches(model::Model& m, int nBranches) {
+
+  PlantLoop plantLoop(m);
+
+  for (int i = 0; i < nBranches; ++i) {
+    BoilerHotWater boiler(m);
+    plantLoop.addSupplyBranchForComponent(boiler);
+
+    CoilHeatingWater coil(m);
+    plantLoop.addDemandBranchForComponent(coil);
+  }
+
+  return plantLoop;
+}
+
+// range(0): number of supply and demand branches, range(1): device coordinate caching of the grid items
+static void BM_LoopSceneRender(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  PixmapRenderCache::setItemCachingEnabled(state.range(1) != 0);
+
+  model::Model model;
+  model::PlantLoop plantLoop = makePlantLoopWithNBranches(model, state.range(0));
+
+  LoopScene scene(plantLoop);
+  QGraphicsView view(&scene);
+  view.resize(1600, 1200);
+
+  QImage image(1600, 1200, QImage::Format_ARGB32_Premultiplied);
+
+  // Code inside this loop is measured repeatedly, each iteration paints the whole scene as a scroll or zoom would
+  for (auto _ : state) {
+    QPainter painter(&image);
+    view.render(&painter);
+    painter.end();
+    benchmark::DoNotOptimize(image);
+  };
+
+  PixmapRenderCache::setItemCachingEnabled(false);
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_LoopSceneRender)
+  ->Args({10, 0})
+  ->Args({50, 0})
+  ->Args({100, 0})
+  ->Args({10, 1})
+  ->Args({50, 1})
+  ->Args({100, 1})
+  ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,171 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ModelObjectListView.hpp"
+#include "../OSItem.hpp"
+#include "../../shared_gui_components/LocalBCLComponentCache.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Construction.hpp>
+#include <openstudio/model/Construction_Impl.hpp>
+
+#include <openstudio/utilities/bcl/LocalBCL.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+
+#include <QDir>
+
+#include <algorithm>
+#include <memory>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, ModelObjectListController_LocalBCLCache) {
+
+  // point the LocalBCL at an empty temporary library
+  openstudio::path libraryPath = toPath(QDir::tempPath()) / toPath("ModelObjectListView_GTest_LocalBCL");
+  if (openstudio::filesystem::exists(libraryPath)) {
+    openstudio::filesystem::remove_all(libraryPath);
+  }
+  openstudio::filesystem::create_directories(libraryPath);
+  LocalBCL::instance(libraryPath);
+
+  model::Model model;
+  model::Construction construction1(model);
+  construction1.setName("B Construction");
+  model::Construction construction2(model);
+  construction2.setName("A Construction");
+  model::Construction construction3(model);
+  construction3.setName("C Construction");
+
+  auto controller = std::make_shared<ModelObjectListController>(IddObjectType::OS_Construction, model, true);
+
+  std::vector<OSItemId> ids;
+  QObject::connect(controller.get(), &ModelObjectListController::itemIds, [&ids](const std::vector<OSItemId>& itemIds) { ids = itemIds; });
+
+  unsigned searchCount = LocalBCLComponentCache::instance().searchCount();
+
+  // repeated refreshes only search the LocalBCL once
+  controller->reportItems();
+  controller->reportItems();
+  controller->reportItems();
+  EXPECT_EQ(searchCount + 1, LocalBCLComponentCache::instance().searchCount());
+  ASSERT_EQ(3u, ids.size());
+
+  // list is sorted the same way the full rebuild used to sort it
+  auto expected = model.getObjectsByType(IddObjectType::OS_Construction);
+  std::sort(expected.begin(), expected.end(), WorkspaceObjectNameGreater());
+  for (unsigned i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(toQString(expected[i].handle()), ids[i].itemId());
+  }
+
+  // renaming resorts without another search
+  construction2.setName("D Construction");
+  controller->reportItems();
+  EXPECT_EQ(searchCount + 1, LocalBCLComponentCache::instance().searchCount());
+  expected = model.getObjectsByType(IddObjectType::OS_Construction);
+  std::sort(expected.begin(), expected.end(), WorkspaceObjectNameGreater());
+  ASSERT_EQ(3u, ids.size());
+  for (unsigned i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(toQString(expected[i].handle()), ids[i].itemId());
+  }
+
+  // invalidating refreshes the list and searches again
+  LocalBCLComponentCache::instance().invalidate();
+  processEvents();
+  EXPECT_EQ(searchCount + 2, LocalBCLComponentCache::instance().searchCount());
+  controller->reportItems();
+  EXPECT_EQ(searchCount + 2, LocalBCLComponentCache::instance().searchCount());
+
+  LocalBCL::close();
+}
+
+TEST_F(OpenStudioLibFixture, ModelObjectListController_AddRemove) {
+
+  model::Model model;
+  model::Construction construction1(model);
+  construction1.setName("B Construction");
+  model::Construction construction2(model);
+  construction2.setName("D Construction");
+
+  auto controller = std::make_shared<ModelObjectListController>(IddObjectType::OS_Construction, model);
+
+  std::vector<OSItemId> ids;
+  QObject::connect(controller.get(), &ModelObjectListController::itemIds, [&ids](const std::vector<OSItemId>& itemIds) { ids = itemIds; });
+
+  auto expectSorted = [&model, &ids]() {
+    auto expected = model.getObjectsByType(IddObjectType::OS_Construction);
+    std::sort(expected.begin(), expected.end(), WorkspaceObjectNameGreater());
+    ASSERT_EQ(expected.size(), ids.size());
+    for (unsigned i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(toQString(expected[i].handle()), ids[i].itemId());
+    }
+  };
+
+  controller->reportItems();
+  expectSorted();
+
+  // added objects are inserted in place
+  model::Construction construction3(model);
+  construction3.setName("C Construction");
+  objectAdded(controller.get(), construction3);
+  expectSorted();
+
+  model::Construction construction4(model);
+  construction4.setName("A Construction");
+  objectAdded(controller.get(), construction4);
+  expectSorted();
+
+  // removed objects are taken out, their handle may already be null
+  construction1.remove();
+  objectRemoved(controller.get(), construction1);
+  expectSorted();
+  EXPECT_EQ(3u, ids.size());
+
+  // the list is built after an object is added but before its queued slot runs, the object is listed once
+  auto controller2 = std::make_shared<ModelObjectListController>(IddObjectType::OS_Construction, model);
+  QObject::connect(controller2.get(), &ModelObjectListController::itemIds, [&ids](const std::vector<OSItemId>& itemIds) { ids = itemIds; });
+
+  model::Construction construction5(model);
+  construction5.setName("E Construction");
+  controller2->reportItems();
+  objectAdded(controller2.get(), construction5);
+  expectSorted();
+  EXPECT_EQ(4u, ids.size());
+  const QString handle5 = toQString(construction5.handle());
+  EXPECT_EQ(1, std::count_if(ids.begin(), ids.end(), [&handle5](const OSItemId& id) { return id.itemId() == handle5; }));
+
+  // adding it again does not duplicate it either
+  objectAdded(controller2.get(), construction5);
+  expectSorted();
+  EXPECT_EQ(4u, ids.size());
+}
@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ModelObjectTreeItems.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Building.hpp>
+#include <openstudio/model/Building_Impl.hpp>
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/BuildingStory_Impl.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+
+#include <openstudio/utilities/geometry/Point3d.hpp>
+
+#include <memory>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, ModelObjectTreeItems_LazyChildren) {
+  model::Model model;
+  model::Building building = model.getUniqueModelObject<model::Building>();
+  model::BuildingStory story(model);
+
+  const unsigned numSpaces = 500;
+  for (unsigned i = 0; i < numSpaces; ++i) {
+    std::vector<Point3d> floorPrint;
+    floorPrint.push_back(Point3d(10.0 * i, 0, 0));
+    floorPrint.push_back(Point3d(10.0 * i, 10, 0));
+    floorPrint.push_back(Point3d(10.0 * (i + 1), 10, 0));
+    floorPrint.push_back(Point3d(10.0 * (i + 1), 0, 0));
+    boost::optional<model::Space> space = model::Space::fromFloorPrint(floorPrint, 3.0, model);
+    ASSERT_TRUE(space);
+    space->setBuildingStory(story);
+  }
+
+  auto buildingItem = std::make_shared<BuildingTreeItem>(building, IddObjectType::OS_BuildingStory);
+
+  // constructing the tree does not create anything below the top level
+  EXPECT_FALSE(buildingItem->isPopulated());
+  EXPECT_TRUE(buildingItem->hasChildren());
+  EXPECT_EQ(0, buildingItem->childCount());
+
+  // expanding the building only creates its direct children
+  buildingItem->populateChildren();
+  EXPECT_TRUE(buildingItem->isPopulated());
+  std::vector<ModelObjectTreeItem*> children = buildingItem->children();
+  ASSERT_EQ(3u, children.size());  // building shading, unassigned story and the story
+  EXPECT_EQ(children.size(), buildingItem->recursiveChildren().size());
+
+  ModelObjectTreeItem* storyItem = nullptr;
+  for (ModelObjectTreeItem* child : children) {
+    EXPECT_FALSE(child->isPopulated());
+    if (child->handle() && (*child->handle() == story.handle())) {
+      storyItem = child;
+    }
+  }
+  ASSERT_TRUE(storyItem);
+
+  // expanding the story creates the spaces, but not their surfaces
+  storyItem->populateChildren();
+  std::vector<ModelObjectTreeItem*> spaceItems = storyItem->children();
+  ASSERT_EQ(numSpaces, spaceItems.size());
+  for (ModelObjectTreeItem* spaceItem : spaceItems) {
+    EXPECT_FALSE(spaceItem->isPopulated());
+    EXPECT_EQ(0, spaceItem->childCount());
+  }
+  EXPECT_EQ(children.size() + numSpaces, buildingItem->recursiveChildren().size());
+
+  // refreshing a collapsed branch does not rebuild it
+  buildingItem->refresh();
+  EXPECT_EQ(children.size() + numSpaces, buildingItem->recursiveChildren().size());
+}
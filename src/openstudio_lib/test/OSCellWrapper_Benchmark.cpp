@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../SpaceTypesGridView.hpp"
+#include "../ThermalZonesGridView.hpp"
+#include "../../shared_gui_components/OSCellWrapper.hpp"
+#include "../../shared_gui_components/OSGridController.hpp"
+#include "../../shared_gui_components/OSGridView.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/People.hpp>
+#include <openstudio/model/PeopleDefinition.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/SpaceType_Impl.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/model/ThermalZone_Impl.hpp>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// Selects the categories of the grid in turn, the widgets of the cells which are not kept being recycled for the cells of the next
+// category (range(1) == 1) or constructed every time. range(2) == 1 keeps the cells of hidden columns, as the app does.
+static void switchCategories(benchmark::State& state, QWidget* gridView) {
+  openstudio::Application::instance().application(true)->processEvents();
+
+  auto osGridView = gridView->findChild<OSGridView*>();
+  if (!osGridView) {
+    state.SkipWithError("No OSGridView");
+    return;
+  }
+  auto gridController = osGridView->findChild<OSGridController*>();
+  if (!gridController) {
+    state.SkipWithError("No OSGridController");
+    return;
+  }
+
+  const int numCategories = gridController->categories().size();
+  const unsigned created = OSCellWrapper::widgetsCreated();
+  const unsigned reused = OSCellWrapper::widgetsReused();
+
+  int index = 0;
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    index = (index + 1) % numCategories;
+    gridController->onCategorySelected(index);
+  };
+
+  state.counters["created"] = benchmark::Counter(OSCellWrapper::widgetsCreated() - created, benchmark::Counter::kAvgIterations);
+  state.counters["reused"] = benchmark::Counter(OSCellWrapper::widgetsReused() - reused, benchmark::Counter::kAvgIterations);
+}
+
+static void BM_ThermalZonesWidgetPool(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  for (int i = 0; i < state.range(0); ++i) {
+    ThermalZone z(model);
+  }
+
+  OSCellWrapper::setWidgetPoolingEnabled(state.range(1) == 1);
+  OSGridView::setCellReuseEnabled(state.range(2) == 1);
+
+  auto gridView = std::make_shared<ThermalZonesGridView>(false, model);
+  switchCategories(state, gridView.get());
+
+  OSCellWrapper::setWidgetPoolingEnabled(true);
+  OSGridView::setCellReuseEnabled(true);
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Space types with a load each, the load columns have subrows which are rebuilt even when the cells of hidden columns are kept
+static void BM_SpaceTypesWidgetPool(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  PeopleDefinition definition(model);
+  for (int i = 0; i < state.range(0); ++i) {
+    SpaceType s(model);
+    People people(definition);
+    people.setSpaceType(s);
+  }
+
+  OSCellWrapper::setWidgetPoolingEnabled(state.range(1) == 1);
+  OSGridView::setCellReuseEnabled(state.range(2) == 1);
+
+  auto gridView = std::make_shared<SpaceTypesGridView>(false, model);
+  switchCategories(state, gridView.get());
+
+  OSCellWrapper::setWidgetPoolingEnabled(true);
+  OSGridView::setCellReuseEnabled(true);
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_ThermalZonesWidgetPool)
+  ->Args({10, 0, 0})
+  ->Args({10, 1, 0})
+  ->Args({100, 0, 0})
+  ->Args({100, 1, 0})
+  ->Args({500, 0, 0})
+  ->Args({500, 1, 0})
+  ->Args({500, 0, 1})
+  ->Args({500, 1, 1})
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_SpaceTypesWidgetPool)
+  ->Args({10, 0, 1})
+  ->Args({10, 1, 1})
+  ->Args({100, 0, 1})
+  ->Args({100, 1, 1})
+  ->Args({500, 0, 1})
+  ->Args({500, 1, 1})
+  ->Unit(benchmark::kMillisecond);
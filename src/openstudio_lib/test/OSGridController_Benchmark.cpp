@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../../shared_gui_components/OSConcepts.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+
+#include <QSharedPointer>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+QSharedPointer<BaseConcept> makeMultiplierConcept() {
+  std::function<int(Space*)> getter([](Space* t_space) { return t_space->multiplier(); });
+  std::function<bool(Space*, int)> setter([](Space* t_space, int t_value) { return t_space->setMultiplier(t_value); });
+  return QSharedPointer<ValueEditConcept<int>>(new ValueEditConceptImpl<int, Space>(Heading(QString("Multiplier")), getter, setter, boost::none, boost::none));
+}
+
+// "Apply to Selected" with the setter resolved once for the column, as OSGridController::onInFocus does
+static void BM_ApplyToSelectedValueSetter(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  std::vector<ModelObject> spaces;
+  for (int i = 0; i < state.range(0); ++i) {
+    spaces.push_back(Space(model));
+  }
+  const ModelObject focused = spaces.front();
+  QSharedPointer<BaseConcept> concept = makeMultiplierConcept();
+
+  int multiplier = 1;
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    focused.cast<Space>().setMultiplier(++multiplier);
+    BaseConcept::ValueSetter setter = concept->valueSetter(focused);
+    for (const auto& space : spaces) {
+      setter(space);
+    }
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Same with the per row cast chain OSGridController::setConceptValue used before, for comparison
+static void BM_ApplyToSelectedDynamicCast(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  std::vector<ModelObject> spaces;
+  for (int i = 0; i < state.range(0); ++i) {
+    spaces.push_back(Space(model));
+  }
+  const ModelObject focused = spaces.front();
+  QSharedPointer<BaseConcept> baseConcept = makeMultiplierConcept();
+
+  int multiplier = 1;
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    focused.cast<Space>().setMultiplier(++multiplier);
+    for (const auto& space : spaces) {
+      // ValueEditConcept<int> came eighth in the chain
+      if (baseConcept.dynamicCast<CheckBoxConcept>() || baseConcept.dynamicCast<CheckBoxConceptBoolReturn>()
+          || baseConcept.dynamicCast<ComboBoxConcept>() || baseConcept.dynamicCast<ValueEditConcept<double>>()
+          || baseConcept.dynamicCast<OptionalValueEditConcept<double>>() || baseConcept.dynamicCast<ValueEditVoidReturnConcept<double>>()
+          || baseConcept.dynamicCast<OptionalValueEditVoidReturnConcept<double>>()) {
+        continue;
+      } else if (QSharedPointer<ValueEditConcept<int>> concept = baseConcept.dynamicCast<ValueEditConcept<int>>()) {
+        auto setter = std::bind(&ValueEditConcept<int>::set, concept.data(), space, std::placeholders::_1);
+        auto getter = std::bind(&ValueEditConcept<int>::get, concept.data(), focused);
+        auto temp = getter();
+        setter(temp);
+      }
+    }
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_ApplyToSelectedValueSetter)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK(BM_ApplyToSelectedDynamicCast)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond)->Complexity();
@@ -0,0 +1,423 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ThermalZonesGridView.hpp"
+#include "../../shared_gui_components/ModelObjectChangeBatch.hpp"
+#include "../../shared_gui_components/OSCellWrapper.hpp"
+#include "../../shared_gui_components/OSConcepts.hpp"
+#include "../../shared_gui_components/OSGridController.hpp"
+#include "../../shared_gui_components/OSGridView.hpp"
+#include "../../shared_gui_components/OSObjectSelector.hpp"
+#include "../../shared_gui_components/OSWidgetHolder.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/model/ThermalZone_Impl.hpp>
+
+#include <QLineEdit>
+#include <QStringList>
+
+#include <algorithm>
+#include <memory>
+
+using namespace openstudio;
+
+namespace {
+
+// Five space columns, one of each kind of concept that can be pasted, optionally after a select column
+class PasteGridController : public OSGridController
+{
+ public:
+  PasteGridController(const model::Model& model, const std::vector<model::ModelObject>& modelObjects, bool withSelectColumn = false)
+    : OSGridController(false, "Paste Spaces", IddObjectType::OS_Space, model, modelObjects), m_withSelectColumn(withSelectColumn) {
+    setCategoriesAndFields();
+  }
+
+  virtual ~PasteGridController() {}
+
+  virtual void refreshModelObjects() override {}
+
+  virtual void onItemDropped(const OSItemId& itemId) override {}
+
+ protected:
+  virtual void setCategoriesAndFields() override {
+    std::vector<QString> fields{"Name", "Multiplier", "Part of Total Floor Area", "X Origin", "Direction of Relative North"};
+    if (m_withSelectColumn) {
+      fields.insert(fields.begin(), "All");
+    }
+    addCategoryAndFields(std::make_pair(QString("General"), fields));
+    OSGridController::setCategoriesAndFields();
+  }
+
+  virtual void addColumns(const QString& t_category, std::vector<QString>& fields) override {
+    resetBaseConcepts();
+
+    for (const auto& field : fields) {
+      if (field == "All") {
+        addSelectColumn(Heading(field), "Check to select this row");
+      } else if (field == "Name") {
+        addNameLineEditColumn(Heading(field), false, false, CastNullAdapter<model::Space>(&model::Space::name),
+                              CastNullAdapter<model::Space>(&model::Space::setName));
+      } else if (field == "Multiplier") {
+        addValueEditColumn(Heading(field), NullAdapter(&model::Space::multiplier), NullAdapter(&model::Space::setMultiplier));
+      } else if (field == "Part of Total Floor Area") {
+        addCheckBoxColumn(Heading(field), "", NullAdapter(&model::Space::partofTotalFloorArea),
+                          NullAdapter(&model::Space::setPartofTotalFloorArea));
+      } else if (field == "X Origin") {
+        addQuantityEditColumn(Heading(field), QString("m"), QString("m"), QString("ft"), isIP(), NullAdapter(&model::Space::xOrigin),
+                              NullAdapter(&model::Space::setXOrigin));
+      } else if (field == "Direction of Relative North") {
+        addValueEditColumn(Heading(field), NullAdapter(&model::Space::directionofRelativeNorth),
+                           NullAdapter(&model::Space::setDirectionofRelativeNorth));
+      }
+    }
+  }
+
+  virtual QString getColor(const model::ModelObject& modelObject) override {
+    return "";
+  }
+
+ private:
+  bool m_withSelectColumn;
+};
+
+}  // namespace
+
+TEST_F(OpenStudioLibFixture, OSGridController_ApplyToSelected) {
+
+  const int numZones = 200;
+
+  // Applies the first zone's multiplier to all the zones with the "Apply to Selected" button of the multiplier column,
+  // returns the multipliers and the texts shown by the multiplier cells
+  auto applyMultiplier = [this](bool batched, std::vector<int>& multipliers, std::vector<QString>& texts) {
+    model::Model model;
+    std::vector<model::ThermalZone> zones;
+    for (int i = 0; i < numZones; ++i) {
+      zones.emplace_back(model);
+    }
+
+    auto gridView = std::make_shared<ThermalZonesGridView>(false, model);
+    auto osGridView = gridView->findChild<OSGridView*>();
+    ASSERT_TRUE(osGridView);
+    auto gridController = osGridView->findChild<OSGridController*>();
+    ASSERT_TRUE(gridController);
+
+    processEvents();
+
+    int column = -1;
+    for (int j = 0; j < gridController->columnCount(); ++j) {
+      if (gridController->baseConcept(j)->heading().label() == "Multiplier") {
+        column = j;
+      }
+    }
+    ASSERT_LE(0, column);
+
+    zones[0].setMultiplier(3);
+    getObjectSelector(gridController)->selectAll();
+
+    auto modelRow = gridController->modelRowFromHandle(zones[0].handle());
+    auto gridRow = gridController->gridRowFromHandle(zones[0].handle());
+    ASSERT_TRUE(modelRow);
+    ASSERT_TRUE(gridRow);
+
+    OSGridController::setBatchedApplyEnabled(batched);
+
+    // focus the first zone's cell, then click the column's apply button, in the header row
+    gridController->onInFocus(true, true, *modelRow, *gridRow, column, boost::none);
+    gridController->onInFocus(false, false, -1, 0, column, boost::none);
+
+    OSGridController::setBatchedApplyEnabled(true);
+
+    for (const auto& zone : zones) {
+      multipliers.push_back(zone.multiplier());
+
+      gridRow = gridController->gridRowFromHandle(zone.handle());
+      ASSERT_TRUE(gridRow);
+      auto lineEdit = qobject_cast<QLineEdit*>(getOSWidgetAt(osGridView, *gridRow, column, boost::none));
+      ASSERT_TRUE(lineEdit);
+      texts.push_back(lineEdit->text());
+    }
+  };
+
+  std::vector<int> multipliers;
+  std::vector<QString> texts;
+  unsigned deferred = ModelObjectChangeBatch::refreshesDeferred();
+  unsigned run = ModelObjectChangeBatch::refreshesRun();
+  applyMultiplier(false, multipliers, texts);
+
+  // every widget refreshes as its object is set
+  EXPECT_EQ(deferred, ModelObjectChangeBatch::refreshesDeferred());
+  EXPECT_EQ(run, ModelObjectChangeBatch::refreshesRun());
+
+  std::vector<int> batchedMultipliers;
+  std::vector<QString> batchedTexts;
+  deferred = ModelObjectChangeBatch::refreshesDeferred();
+  run = ModelObjectChangeBatch::refreshesRun();
+  applyMultiplier(true, batchedMultipliers, batchedTexts);
+
+  // the zone widgets refresh after all the values are set, OSGridController_ApplyToSelectedRefreshes counts them
+  EXPECT_LT(deferred, ModelObjectChangeBatch::refreshesDeferred());
+  EXPECT_LT(run, ModelObjectChangeBatch::refreshesRun());
+  EXPECT_FALSE(ModelObjectChangeBatch::isOpen());
+
+  ASSERT_EQ(static_cast<size_t>(numZones), multipliers.size());
+  ASSERT_EQ(static_cast<size_t>(numZones), texts.size());
+  EXPECT_EQ(multipliers, batchedMultipliers);
+  EXPECT_EQ(texts, batchedTexts);
+  for (int i = 0; i < numZones; ++i) {
+    EXPECT_EQ(3, batchedMultipliers[i]) << i;
+    EXPECT_EQ(texts[0], batchedTexts[i]) << i;
+  }
+}
+
+TEST_F(OpenStudioLibFixture, OSGridController_ApplyToSelectedRefreshes) {
+
+  const int numSpaces = 100;
+
+  model::Model model;
+  std::vector<model::Space> spaces;
+  std::vector<model::ModelObject> modelObjects;
+  for (int i = 0; i < numSpaces; ++i) {
+    spaces.emplace_back(model);
+    modelObjects.push_back(spaces.back());
+  }
+
+  auto gridController = new PasteGridController(model, modelObjects, true);
+  auto osGridView = std::make_shared<OSGridView>(gridController, "Apply Spaces", "Drop\nSpace", false);
+
+  processEvents();
+
+  // each column shows one widget bound to the space of its row, all of them refresh through the batch
+  ASSERT_EQ(6, gridController->columnCount());
+  const unsigned widgetsPerSpace = 6;
+  const int multiplierColumn = 2;
+
+  spaces[0].setMultiplier(3);
+  getObjectSelector(gridController)->selectAll();
+
+  auto modelRow = gridController->modelRowFromHandle(spaces[0].handle());
+  auto gridRow = gridController->gridRowFromHandle(spaces[0].handle());
+  ASSERT_TRUE(modelRow);
+  ASSERT_TRUE(gridRow);
+
+  unsigned deferred = ModelObjectChangeBatch::refreshesDeferred();
+  unsigned run = ModelObjectChangeBatch::refreshesRun();
+
+  // the focused space is not set again, so the widgets of the other spaces refresh once each
+  gridController->onInFocus(true, true, *modelRow, *gridRow, multiplierColumn, boost::none);
+  gridController->onInFocus(false, false, -1, 0, multiplierColumn, boost::none);
+
+  deferred = ModelObjectChangeBatch::refreshesDeferred() - deferred;
+  run = ModelObjectChangeBatch::refreshesRun() - run;
+  EXPECT_EQ(widgetsPerSpace * (numSpaces - 1), run);
+  EXPECT_LE(run, deferred);
+  for (const auto& space : spaces) {
+    EXPECT_EQ(3, space.multiplier());
+  }
+
+  // changing every space twice in a batch defers each widget twice, it still refreshes once
+  deferred = ModelObjectChangeBatch::refreshesDeferred();
+  run = ModelObjectChangeBatch::refreshesRun();
+
+  gridController->changeInBatch([&spaces]() {
+    for (auto& space : spaces) {
+      space.setMultiplier(4);
+      space.setXOrigin(1.0);
+    }
+  });
+
+  deferred = ModelObjectChangeBatch::refreshesDeferred() - deferred;
+  run = ModelObjectChangeBatch::refreshesRun() - run;
+  EXPECT_EQ(widgetsPerSpace * numSpaces, run);
+  EXPECT_GT(deferred, run);
+  EXPECT_FALSE(ModelObjectChangeBatch::isOpen());
+}
+
+TEST_F(OpenStudioLibFixture, OSGridController_PasteRange) {
+
+  const int numSpaces = 500;
+
+  model::Model model;
+  std::vector<model::Space> spaces;
+  std::vector<model::ModelObject> modelObjects;
+  for (int i = 0; i < numSpaces; ++i) {
+    spaces.emplace_back(model);
+    modelObjects.push_back(spaces.back());
+  }
+
+  auto gridController = new PasteGridController(model, modelObjects);
+  auto osGridView = std::make_shared<OSGridView>(gridController, "Paste Spaces", "Drop\nSpace", false);
+
+  processEvents();
+
+  ASSERT_EQ(5, gridController->columnCount());
+
+  // the rows as shown, top to bottom
+  std::vector<std::pair<int, model::Space>> rows;
+  for (const auto& space : spaces) {
+    auto gridRow = gridController->gridRowFromHandle(space.handle());
+    ASSERT_TRUE(gridRow);
+    rows.emplace_back(*gridRow, space);
+  }
+  std::sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  // a block copied from a spreadsheet, ending with a line break
+  QString text;
+  for (int i = 0; i < numSpaces; ++i) {
+    QStringList fields;
+    fields << QString("Pasted Space %1").arg(i, 3, 10, QChar('0')) << QString::number(i % 9 + 1) << (i % 2 == 0 ? "false" : "true")
+           << QString::number(0.5 * i, 'g', 12) << QString::number(i % 360);
+    text += fields.join('\t') + "\n";
+  }
+
+  const unsigned deferred = ModelObjectChangeBatch::refreshesDeferred();
+  const unsigned run = ModelObjectChangeBatch::refreshesRun();
+
+  gridController->setSelectedRange(rows.front().first, 0, rows.front().first, 0);
+  EXPECT_EQ(5 * numSpaces, gridController->pasteToSelectedRange(text));
+
+  // each cell's widget refreshes at most once, after all the values are set
+  EXPECT_LE(ModelObjectChangeBatch::refreshesRun() - run, static_cast<unsigned>(5 * numSpaces));
+  EXPECT_LE(ModelObjectChangeBatch::refreshesRun() - run, ModelObjectChangeBatch::refreshesDeferred() - deferred);
+  EXPECT_FALSE(ModelObjectChangeBatch::isOpen());
+
+  ASSERT_EQ(static_cast<size_t>(numSpaces), rows.size());
+  for (int i = 0; i < numSpaces; ++i) {
+    const model::Space& space = rows[i].second;
+    EXPECT_EQ(QString("Pasted Space %1").arg(i, 3, 10, QChar('0')).toStdString(), space.nameString()) << i;
+    EXPECT_EQ(i % 9 + 1, space.multiplier()) << i;
+    EXPECT_EQ(i % 2 != 0, space.partofTotalFloorArea()) << i;
+    EXPECT_DOUBLE_EQ(0.5 * i, space.xOrigin()) << i;
+    EXPECT_DOUBLE_EQ(i % 360, space.directionofRelativeNorth()) << i;
+  }
+
+  // copying the same range gives the pasted block back
+  gridController->setSelectedRange(rows.front().first, 0, rows.back().first, 4);
+  EXPECT_EQ(text.chopped(1), gridController->selectedRangeText());
+
+  // values which are not valid for their column are left out
+  gridController->setSelectedRange(rows.front().first, 1, rows.front().first, 1);
+  EXPECT_EQ(1, gridController->pasteToSelectedRange("abc\tmaybe\t2.5\n"));
+  EXPECT_EQ(1, rows.front().second.multiplier());
+  EXPECT_FALSE(rows.front().second.partofTotalFloorArea());
+  EXPECT_DOUBLE_EQ(2.5, rows.front().second.xOrigin());
+
+  // the cells of the range are marked so the user sees what copy and paste act on
+  auto isInRange = [&](int gridRow, int column) {
+    const int modelRow = gridController->modelRowFromGridRow(gridRow);
+    GridCellInfo* info = getGridCellInfoAt(getObjectSelector(gridController), modelRow, gridRow, column, boost::none);
+    OSCellWrapper* wrapper = getWrapperAt(osGridView.get(), gridRow, column, boost::none);
+    EXPECT_TRUE(info);
+    EXPECT_TRUE(wrapper);
+    if (!info || !wrapper) {
+      return false;
+    }
+    for (const auto& holder : getHolders(wrapper)) {
+      EXPECT_EQ(info->isInRange(), holder->property("inRange").toBool());
+    }
+    return info->isInRange();
+  };
+
+  gridController->setSelectedRange(rows[2].first, 2, rows[1].first, 1);
+  EXPECT_TRUE(isInRange(rows[1].first, 1));
+  EXPECT_TRUE(isInRange(rows[2].first, 2));
+  EXPECT_FALSE(isInRange(rows[0].first, 1));
+  EXPECT_FALSE(isInRange(rows[1].first, 3));
+
+  gridController->setSelectedRange(rows[1].first, 2, rows[1].first, 3);
+  EXPECT_FALSE(isInRange(rows[1].first, 1));
+  EXPECT_FALSE(isInRange(rows[2].first, 2));
+  EXPECT_TRUE(isInRange(rows[1].first, 2));
+  EXPECT_TRUE(isInRange(rows[1].first, 3));
+
+  gridController->clearSelectedRange();
+  EXPECT_FALSE(isInRange(rows[1].first, 2));
+  EXPECT_FALSE(isInRange(rows[1].first, 3));
+
+  // the range refers to the columns of the category it was selected in
+  gridController->setSelectedRange(rows.front().first, 0, rows.back().first, 4);
+  gridController->onCategorySelected(0);
+  EXPECT_TRUE(gridController->selectedRangeText().isEmpty());
+  EXPECT_EQ(0, gridController->pasteToSelectedRange(text));
+
+  gridController->setSelectedRange(rows.front().first, 0, rows.back().first, 4);
+  osGridView->onRecreateAll();
+  EXPECT_TRUE(gridController->selectedRangeText().isEmpty());
+  EXPECT_EQ(0, gridController->pasteToSelectedRange(text));
+}
+
+TEST_F(OpenStudioLibFixture, OSGridController_WidgetPool) {
+
+  const unsigned numSpaces = 100;
+
+  model::Model model;
+  std::vector<model::Space> spaces;
+  std::vector<model::ModelObject> modelObjects;
+  for (unsigned i = 0; i < numSpaces; ++i) {
+    spaces.emplace_back(model);
+    spaces.back().setMultiplier(i % 9 + 1);
+    modelObjects.push_back(spaces.back());
+  }
+
+  auto gridController = new PasteGridController(model, modelObjects);
+  auto osGridView = std::make_shared<OSGridView>(gridController, "Paste Spaces", "Drop\nSpace", false);
+
+  processEvents();
+
+  ASSERT_EQ(5, gridController->columnCount());
+
+  // every cell is rebuilt, with the new concepts made by selecting a category
+  OSGridView::setCellReuseEnabled(false);
+
+  const unsigned created = OSCellWrapper::widgetsCreated();
+  const unsigned reused = OSCellWrapper::widgetsReused();
+
+  gridController->onCategorySelected(0);
+
+  OSGridView::setCellReuseEnabled(true);
+
+  // only the name line edits aren't recycled
+  EXPECT_EQ(numSpaces, OSCellWrapper::widgetsCreated() - created);
+  EXPECT_EQ(4 * numSpaces, OSCellWrapper::widgetsReused() - reused);
+
+  // the recycled widgets show the objects of their new cells
+  for (const auto& space : spaces) {
+    auto gridRow = gridController->gridRowFromHandle(space.handle());
+    ASSERT_TRUE(gridRow);
+    auto lineEdit = qobject_cast<QLineEdit*>(getOSWidgetAt(osGridView.get(), *gridRow, 1, boost::none));
+    ASSERT_TRUE(lineEdit);
+    EXPECT_EQ(QString::number(space.multiplier()), lineEdit->text());
+  }
+}
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../SpaceTypesGridView.hpp"
+#include "../ThermalZonesGridView.hpp"
+#include "../../shared_gui_components/OSGridController.hpp"
+#include "../../shared_gui_components/OSGridView.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/SpaceType_Impl.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/model/ThermalZone_Impl.hpp>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// Selects the categories of the grid in turn, keeping the cells of hidden columns (range(1) == 1) or recreating every cell
+static void switchCategories(benchmark::State& state, QWidget* gridView) {
+  openstudio::Application::instance().application(true)->processEvents();
+
+  auto osGridView = gridView->findChild<OSGridView*>();
+  if (!osGridView) {
+    state.SkipWithError("No OSGridView");
+    return;
+  }
+  auto gridController = osGridView->findChild<OSGridController*>();
+  if (!gridController) {
+    state.SkipWithError("No OSGridController");
+    return;
+  }
+
+  const int numCategories = gridController->categories().size();
+  const unsigned reused = OSGridView::cellsReused();
+
+  int index = 0;
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    index = (index + 1) % numCategories;
+    gridController->onCategorySelected(index);
+  };
+
+  state.counters["reused"] = benchmark::Counter(OSGridView::cellsReused() - reused, benchmark::Counter::kAvgIterations);
+}
+
+static void BM_ThermalZonesCategorySwitch(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  for (int i = 0; i < state.range(0); ++i) {
+    ThermalZone z(model);
+  }
+
+  OSGridView::setCellReuseEnabled(state.range(1) == 1);
+
+  auto gridView = std::make_shared<ThermalZonesGridView>(false, model);
+  switchCategories(state, gridView.get());
+
+  OSGridView::setCellReuseEnabled(true);
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_SpaceTypesCategorySwitch(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  Model model;
+  for (int i = 0; i < state.range(0); ++i) {
+    SpaceType s(model);
+  }
+
+  OSGridView::setCellReuseEnabled(state.range(1) == 1);
+
+  auto gridView = std::make_shared<SpaceTypesGridView>(false, model);
+  switchCategories(state, gridView.get());
+
+  OSGridView::setCellReuseEnabled(true);
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_ThermalZonesCategorySwitch)
+  ->Args({10, 0})
+  ->Args({10, 1})
+  ->Args({100, 0})
+  ->Args({100, 1})
+  ->Args({500, 0})
+  ->Args({500, 1})
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_SpaceTypesCategorySwitch)
+  ->Args({10, 0})
+  ->Args({10, 1})
+  ->Args({100, 0})
+  ->Args({100, 1})
+  ->Args({500, 0})
+  ->Args({500, 1})
+  ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,115 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../SpacesLoadsGridView.hpp"
+#include "../SpacesSpacesGridView.hpp"
+#include "../../shared_gui_components/OSGridController.hpp"
+#include "../../shared_gui_components/OSGridView.hpp"
+#include "../../shared_gui_components/OSObjectSelector.hpp"
+
+#include <openstudio/model/ElectricEquipment.hpp>
+#include <openstudio/model/ElectricEquipmentDefinition.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+
+#include <memory>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, OSGridView_AddRowsInOneBatch) {
+
+  model::Model model = model::exampleModel();
+  ASSERT_EQ(4u, model.getConcreteModelObjects<model::Space>().size());
+
+  auto gridView = std::make_shared<SpacesSpacesGridView>(false, model);
+  auto osGridView = getGridView(gridView.get());
+  auto gridController = getGridController(gridView.get());
+
+  processEvents();
+
+  // the grid view is not shown, so listen to the model as it would
+  gridController->connectToModelSignals();
+
+  const int rowCount = gridController->rowCount();
+  const unsigned layoutPasses = OSGridView::layoutPasses();
+
+  // an import adds all its spaces before returning to the event loop
+  const int numSpaces = 200;
+  for (int i = 0; i < numSpaces; ++i) {
+    model::Space space(model);
+  }
+
+  processEvents();
+
+  EXPECT_EQ(1u, OSGridView::layoutPasses() - layoutPasses);
+  ASSERT_EQ(rowCount + numSpaces, gridController->rowCount());
+  EXPECT_EQ(4u + numSpaces, gridController->modelObjects().size());
+  for (int j = 0; j < gridController->columnCount(); ++j) {
+    EXPECT_TRUE(osGridView->itemAtPosition(rowCount + numSpaces - 1, j)) << "column " << j;
+  }
+
+  // nothing left for a second pass
+  processEvents();
+  EXPECT_EQ(1u, OSGridView::layoutPasses() - layoutPasses);
+
+  gridController->disconnectFromModelSignals();
+}
+
+TEST_F(OpenStudioLibFixture, OSGridView_AddSubrowsInOneBatch) {
+
+  model::Model model = model::exampleModel();
+  auto spaces = model.getConcreteModelObjects<model::Space>();
+  ASSERT_EQ(4u, spaces.size());
+
+  auto gridView = std::make_shared<SpacesLoadsGridView>(false, model);
+  auto gridController = getGridController(gridView.get());
+  auto objectSelector = getObjectSelector(gridController);
+
+  processEvents();
+
+  const auto numSelectable = objectSelector->selectableObjects().size();
+  const unsigned layoutPasses = OSGridView::layoutPasses();
+
+  // one new load in each space, every loads cell gets a new subrow
+  model::ElectricEquipmentDefinition definition(model);
+  for (auto& space : spaces) {
+    model::ElectricEquipment equipment(definition);
+    equipment.setSpace(space);
+  }
+
+  processEvents();
+
+  EXPECT_EQ(1u, OSGridView::layoutPasses() - layoutPasses);
+  EXPECT_EQ(numSelectable + spaces.size(), objectSelector->selectableObjects().size());
+}
@@ -33,11 +33,14 @@
 
 #include "../../shared_gui_components/OSGridController.hpp"
 #include "../../shared_gui_components/OSObjectSelector.hpp"
+#include "../../shared_gui_components/OSWidgetHolder.hpp"
 
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/Space.hpp>
 #include <openstudio/model/Space_Impl.hpp>
 
+#include <QWidget>
+
 #include <memory>
 
 using namespace openstudio;
@@ -102,3 +105,58 @@ TEST_F(OpenStudioLibFixture, OSObjectSelector) {
   TestGridController grid;
   OSObjectSelector selector(&grid);
 }
+
+TEST_F(OpenStudioLibFixture, OSGridController_RemoveRows) {
+
+  // Removes every tenth of the spaces
+  const int numRows = 1000;
+  model::Model model;
+  std::vector<model::ModelObject> spaces;
+  for (int i = 0; i < numRows; ++i) {
+    spaces.push_back(model::Space(model));
+  }
+
+  TestGridController grid(true, "Spaces", IddObjectType::OS_Space, model, spaces);
+  grid.connectToModelSignals();
+
+  // A selector column and a value column, without widgets
+  OSWidgetHolder holder(nullptr, new QWidget(), false);
+  OSObjectSelector* selector = getObjectSelector(&grid);
+  for (int modelRow = 0; modelRow < numRows; ++modelRow) {
+    const int gridRow = grid.gridRowFromModelRow(modelRow);
+    selector->addObject(spaces[modelRow], &holder, modelRow, gridRow, 0, boost::none, true, false, false);
+    selector->addObject(spaces[modelRow], &holder, modelRow, gridRow, 1, boost::none, false, false, false);
+  }
+  EXPECT_EQ(2u * numRows, getGridCellLocationToInfoMap(selector).size());
+
+  int numCellsChanged = 0;
+  QObject::connect(selector, &OSObjectSelector::gridCellChanged, [&numCellsChanged]() { ++numCellsChanged; });
+
+  // Each removal only changes the two cells of its row, whatever the size of the grid
+  std::vector<Handle> removed;
+  for (int modelRow = 0; modelRow < numRows; modelRow += 10) {
+    removed.push_back(spaces[modelRow].handle());
+    const int numCellsChangedBefore = numCellsChanged;
+    spaces[modelRow].remove();
+    EXPECT_EQ(2, numCellsChanged - numCellsChangedBefore) << modelRow;
+  }
+
+  // Only the cells of the removed rows changed, to hidden and locked
+  EXPECT_EQ(2 * static_cast<int>(removed.size()), numCellsChanged);
+  for (const auto& locationInfoPair : getGridCellLocationToInfoMap(selector)) {
+    const int modelRow = locationInfoPair.first->modelRow;
+    const int gridRow = locationInfoPair.first->gridRow;
+    GridCellInfo* info = locationInfoPair.second;
+    if (modelRow % 10 == 0) {
+      EXPECT_FALSE(grid.gridRowFromHandle(removed[modelRow / 10]));
+      EXPECT_FALSE(info->isVisible()) << modelRow;
+      EXPECT_TRUE(info->isLocked()) << modelRow;
+    } else {
+      // Rows keep their numbers when rows before them are removed
+      EXPECT_EQ(gridRow, grid.gridRowFromHandle(spaces[modelRow].handle()).value_or(-1));
+      EXPECT_EQ(spaces[modelRow], grid.modelObjectFromGridRow(gridRow));
+      EXPECT_TRUE(info->isVisible()) << modelRow;
+      EXPECT_FALSE(info->isLocked()) << modelRow;
+    }
+  }
+}
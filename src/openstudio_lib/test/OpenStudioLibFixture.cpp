@@ -33,6 +33,7 @@
 
 #include "../DesignDayGridView.hpp"
 #include "../GridViewSubTab.hpp"
+#include "../ModelObjectListView.hpp"
 #include "../OSDropZone.hpp"
 #include "../../shared_gui_components/OSCellWrapper.hpp"
 #include "../../shared_gui_components/OSGridController.hpp"
@@ -42,6 +43,7 @@
 #include "../../shared_gui_components/OSWidgetHolder.hpp"
 
 #include <openstudio/utilities/core/Path.hpp>
+#include <openstudio/utilities/idf/WorkspaceObject_Impl.hpp>
 
 #include <boost/optional/optional_io.hpp>
 
@@ -88,6 +90,19 @@ OSGridController* OpenStudioLibFixture::getGridController(DesignDayGridView* gv)
 OSObjectSelector* OpenStudioLibFixture::getObjectSelector(OSGridController* gc) {
   return gc->m_objectSelector;
 }
+
+std::vector<QString> OpenStudioLibFixture::getCustomFields(OSGridController* gc) {
+  return gc->m_customFields;
+}
+
+void OpenStudioLibFixture::objectAdded(ModelObjectListController* controller, const model::ModelObject& mo) {
+  controller->objectAdded(mo.getImpl<openstudio::detail::WorkspaceObject_Impl>(), mo.iddObjectType(), mo.handle());
+}
+
+void OpenStudioLibFixture::objectRemoved(ModelObjectListController* controller, const model::ModelObject& mo) {
+  controller->objectRemoved(mo.getImpl<openstudio::detail::WorkspaceObject_Impl>(), mo.iddObjectType(), mo.handle());
+}
+
 std::map<GridCellLocation*, GridCellInfo*> OpenStudioLibFixture::getGridCellLocationToInfoMap(openstudio::OSObjectSelector* os) {
   return os->m_gridCellLocationToInfoMap;
 }
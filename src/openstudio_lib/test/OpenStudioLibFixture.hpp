@@ -39,11 +39,14 @@
 #include <map>
 #include <vector>
 
+#include <QString>
+
 namespace openstudio {
 class DesignDayGridView;
 class GridCellLocation;
 class GridCellInfo;
 class GridViewSubTab;
+class ModelObjectListController;
 class OSCellWrapper;
 class OSObjectSelector;
 class OSGridController;
@@ -80,6 +83,11 @@ class OpenStudioLibFixture : public ::testing::Test
   openstudio::OSGridController* getGridController(openstudio::GridViewSubTab* gvst);
   openstudio::OSGridController* getGridController(openstudio::DesignDayGridView* gv);
   openstudio::OSObjectSelector* getObjectSelector(openstudio::OSGridController* gc);
+  std::vector<QString> getCustomFields(openstudio::OSGridController* gc);
+
+  // Runs the list controller's queued model slots as if the object had just been added or removed
+  void objectAdded(openstudio::ModelObjectListController* controller, const openstudio::model::ModelObject& mo);
+  void objectRemoved(openstudio::ModelObjectListController* controller, const openstudio::model::ModelObject& mo);
 
   std::map<openstudio::GridCellLocation*, openstudio::GridCellInfo*> getGridCellLocationToInfoMap(openstudio::OSObjectSelector* os);
   std::vector<openstudio::GridCellLocation*> getSelectorCellLocations(openstudio::OSObjectSelector* os);
@@ -0,0 +1,87 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../RefrigerationController.hpp"
+#include "../RefrigerationGraphicsItems.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/RefrigerationCase.hpp>
+#include <openstudio/model/RefrigerationCompressor.hpp>
+#include <openstudio/model/RefrigerationSystem.hpp>
+#include <openstudio/model/RefrigerationWalkIn.hpp>
+#include <openstudio/model/ScheduleCompact.hpp>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, RefrigerationController_AddCase) {
+  model::Model model;
+  model::ScheduleCompact defrostSchedule(model);
+  model::RefrigerationSystem system(model);
+
+  std::vector<model::RefrigerationCase> cases;
+  for (int i = 0; i < 150; ++i) {
+    model::RefrigerationCase refrigerationCase(model, defrostSchedule);
+    EXPECT_TRUE(system.addCase(refrigerationCase));
+    cases.push_back(refrigerationCase);
+  }
+  model::RefrigerationWalkIn walkin(model, defrostSchedule);
+  EXPECT_TRUE(system.addWalkin(walkin));
+  model::RefrigerationCompressor compressor(model);
+  EXPECT_TRUE(system.addCompressor(compressor));
+
+  RefrigerationSystemView systemView;
+  boost::optional<model::RefrigerationSystem> t_system = system;
+
+  // 150 cases, 1 walkin and 1 compressor
+  EXPECT_EQ(152u, RefrigerationController::refreshRefrigerationSystemView(&systemView, t_system));
+
+  QGraphicsObject* firstCaseView = systemView.refrigerationCasesView->caseDetailView(cases.front().handle());
+  ASSERT_TRUE(firstCaseView);
+
+  // nothing changed
+  EXPECT_EQ(0u, RefrigerationController::refreshRefrigerationSystemView(&systemView, t_system));
+
+  // adding a case only creates its detail view
+  model::RefrigerationCase newCase(model, defrostSchedule);
+  EXPECT_TRUE(system.addCase(newCase));
+  EXPECT_EQ(1u, RefrigerationController::refreshRefrigerationSystemView(&systemView, t_system));
+  EXPECT_TRUE(systemView.refrigerationCasesView->caseDetailView(newCase.handle()));
+  EXPECT_EQ(firstCaseView, systemView.refrigerationCasesView->caseDetailView(cases.front().handle()));
+
+  // removing a case deletes its detail view only
+  system.removeCase(cases.back());
+  EXPECT_EQ(0u, RefrigerationController::refreshRefrigerationSystemView(&systemView, t_system));
+  EXPECT_FALSE(systemView.refrigerationCasesView->caseDetailView(cases.back().handle()));
+  EXPECT_EQ(firstCaseView, systemView.refrigerationCasesView->caseDetailView(cases.front().handle()));
+  EXPECT_TRUE(systemView.refrigerationCompressorView->compressorDetailView(compressor.handle()));
+}
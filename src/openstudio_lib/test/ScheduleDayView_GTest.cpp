@@ -0,0 +1,125 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ScheduleDayView.hpp"
+#include "../SchedulesView.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleDay.hpp>
+#include <openstudio/model/ScheduleRuleset.hpp>
+
+#include <openstudio/utilities/time/Time.hpp>
+
+#include <memory>
+
+using namespace openstudio;
+
+namespace {
+
+// one value per minute
+model::ScheduleRuleset makeMinuteSchedule(model::Model& model) {
+  model::ScheduleRuleset scheduleRuleset(model, 0.0);
+  model::ScheduleDay scheduleDay = scheduleRuleset.defaultDaySchedule();
+  for (int minute = 1; minute <= 24 * 60; ++minute) {
+    scheduleDay.addValue(Time(0, 0, minute), (minute % 2 == 0) ? 1.0 : 0.0);
+  }
+  return scheduleRuleset;
+}
+
+// what DaySchedulePlotArea does on every mouse move while dragging a segment up or down
+void dragValue(CalendarSegmentItem* segment, double value) {
+  segment->setValue(value);
+  if (VCalendarSegmentItem* item = segment->nextVCalendarItem()) {
+    item->updateLength();
+  }
+  if (VCalendarSegmentItem* item = segment->previousVCalendarItem()) {
+    item->updateLength();
+  }
+}
+
+}  // namespace
+
+TEST_F(OpenStudioLibFixture, ScheduleDayView_DragSegment) {
+  model::Model model;
+  model::ScheduleRuleset scheduleRuleset = makeMinuteSchedule(model);
+  model::ScheduleDay scheduleDay = scheduleRuleset.defaultDaySchedule();
+  ASSERT_EQ(1440u, scheduleDay.times().size());
+
+  auto schedulesView = std::make_shared<SchedulesView>(false, model);
+  auto scheduleDayView = new ScheduleDayView(false, scheduleDay, schedulesView.get());
+  DayScheduleScene* scene = scheduleDayView->scene();
+  processEvents();
+
+  std::vector<CalendarSegmentItem*> segments = scene->segments();
+  ASSERT_EQ(1440u, segments.size());
+  const unsigned allocations = scene->itemAllocationCount();
+  // 1440 horizontal and 1439 vertical items
+  EXPECT_EQ(2879u, allocations);
+
+  double lowerLimit = scheduleDayView->lowerViewLimit();
+  double upperLimit = scheduleDayView->upperViewLimit();
+
+  // releasing the mouse without moving anything does not write
+  EXPECT_EQ(0u, scene->commitSegments(lowerLimit, upperLimit));
+
+  // a long drag of one segment is a single model write at release
+  CalendarSegmentItem* segment = segments[100];
+  for (int step = 0; step <= 200; ++step) {
+    dragValue(segment, step / 200.0);
+  }
+  dragValue(segment, 0.5);
+  EXPECT_EQ(1u, scene->commitSegments(lowerLimit, upperLimit));
+  EXPECT_DOUBLE_EQ(lowerLimit + 0.5 * (upperLimit - lowerLimit), scheduleDay.getValue(Time(0, 0, 101)));
+
+  // the scene catches up with the model without allocating any item
+  processEvents();
+  EXPECT_EQ(allocations, scene->itemAllocationCount());
+  EXPECT_EQ(segments, scene->segments());
+
+  // moving a boundary replaces one time by another
+  VCalendarSegmentItem* boundary = segments[200]->nextVCalendarItem();
+  ASSERT_TRUE(boundary);
+  boundary->setTime(segments[200]->endTime() - 30.0);
+  EXPECT_EQ(2u, scene->commitSegments(lowerLimit, upperLimit));
+  EXPECT_EQ(1440u, scheduleDay.times().size());
+
+  processEvents();
+  EXPECT_EQ(allocations, scene->itemAllocationCount());
+  EXPECT_EQ(segments, scene->segments());
+
+  // removing a value in the model drops one segment and reuses the others
+  scheduleDay.removeValue(Time(0, 0, 500));
+  processEvents();
+  EXPECT_EQ(allocations, scene->itemAllocationCount());
+  EXPECT_EQ(1439u, scene->segments().size());
+}
@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../ScheduleRuleCalendar.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleDay.hpp>
+#include <openstudio/model/ScheduleRule.hpp>
+#include <openstudio/model/ScheduleRuleset.hpp>
+#include <openstudio/model/YearDescription.hpp>
+#include <openstudio/model/YearDescription_Impl.hpp>
+
+#include <openstudio/utilities/time/Date.hpp>
+#include <openstudio/utilities/time/Time.hpp>
+
+using namespace openstudio;
+
+namespace {
+
+std::vector<int> expectedActiveRuleIndices(const model::ScheduleRuleset& scheduleRuleset) {
+  int year = scheduleRuleset.model().getUniqueModelObject<model::YearDescription>().assumedYear();
+  return scheduleRuleset.getActiveRuleIndices(Date(1, 1, year), Date(12, 31, year));
+}
+
+}  // namespace
+
+TEST_F(OpenStudioLibFixture, ScheduleRuleCalendar_MatchesActiveRuleIndices) {
+  model::Model model;
+  model::ScheduleRuleset scheduleRuleset(model, 0.0);
+
+  ScheduleRuleCalendar calendar(scheduleRuleset);
+  EXPECT_EQ(1u, calendar.computeCount());
+  EXPECT_EQ(expectedActiveRuleIndices(scheduleRuleset), calendar.activeRuleIndices());
+
+  // adding rules
+  model::ScheduleRule weekendRule(scheduleRuleset);
+  weekendRule.setApplySaturday(true);
+  weekendRule.setApplySunday(true);
+
+  model::ScheduleRule summerRule(scheduleRuleset);
+  summerRule.setApplyAllDays(true);
+  summerRule.setStartDate(Date(MonthOfYear::Jun, 1));
+  summerRule.setEndDate(Date(MonthOfYear::Aug, 31));
+
+  EXPECT_TRUE(calendar.refresh());
+  EXPECT_EQ(expectedActiveRuleIndices(scheduleRuleset), calendar.activeRuleIndices());
+
+  // dates
+  summerRule.setEndDate(Date(MonthOfYear::Sep, 15));
+  EXPECT_TRUE(calendar.refresh());
+  EXPECT_EQ(expectedActiveRuleIndices(scheduleRuleset), calendar.activeRuleIndices());
+
+  // day of week flags
+  weekendRule.setApplyFriday(true);
+  EXPECT_TRUE(calendar.refresh());
+  EXPECT_EQ(expectedActiveRuleIndices(scheduleRuleset), calendar.activeRuleIndices());
+
+  // priority
+  EXPECT_TRUE(scheduleRuleset.setScheduleRuleIndex(weekendRule, 0));
+  EXPECT_TRUE(calendar.refresh());
+  EXPECT_EQ(expectedActiveRuleIndices(scheduleRuleset), calendar.activeRuleIndices());
+
+  // year
+  model::YearDescription yearDescription = model.getUniqueModelObject<model::YearDescription>();
+  yearDescription.setCalendarYear(2012);
+  EXPECT_TRUE(calendar.refresh());
+  EXPECT_EQ(366u, calendar.activeRuleIndices().size());
+  EXPECT_EQ(expectedActiveRuleIndices(scheduleRuleset), calendar.activeRuleIndices());
+
+  // removing a rule
+  weekendRule.remove();
+  EXPECT_TRUE(calendar.refresh());
+  EXPECT_EQ(expectedActiveRuleIndices(scheduleRuleset), calendar.activeRuleIndices());
+
+  EXPECT_EQ(7u, calendar.computeCount());
+}
+
+TEST_F(OpenStudioLibFixture, ScheduleRuleCalendar_IgnoresUnrelatedEdits) {
+  model::Model model;
+  model::ScheduleRuleset scheduleRuleset(model, 0.0);
+
+  model::ScheduleRule scheduleRule(scheduleRuleset);
+  scheduleRule.setApplyMonday(true);
+
+  ScheduleRuleCalendar calendar(scheduleRuleset);
+  EXPECT_EQ(1u, calendar.computeCount());
+
+  // nothing changed
+  EXPECT_FALSE(calendar.refresh());
+
+  // names and day schedule values do not change which rule is active
+  scheduleRule.setName("Renamed Rule");
+  scheduleRuleset.setName("Renamed Ruleset");
+  scheduleRule.daySchedule().addValue(Time(0, 12), 1.0);
+  EXPECT_FALSE(calendar.refresh());
+  EXPECT_EQ(1u, calendar.computeCount());
+  EXPECT_EQ(expectedActiveRuleIndices(scheduleRuleset), calendar.activeRuleIndices());
+
+  // setting a flag to its current value does not either
+  scheduleRule.setApplyMonday(true);
+  EXPECT_FALSE(calendar.refresh());
+  EXPECT_EQ(1u, calendar.computeCount());
+}
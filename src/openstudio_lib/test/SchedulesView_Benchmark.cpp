@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../SchedulesView.hpp"
+
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ScheduleDay.hpp>
+#include <openstudio/model/ScheduleRule.hpp>
+#include <openstudio/model/ScheduleRuleset.hpp>
+#include <openstudio/utilities/time/Time.hpp>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+model::Model makeModelWithNScheduleRulesets(int nRulesets) {
+
+  constexpr int nRulesPerRuleset = 3;
+
+  Model m;
+
+  for (int i = 0; i < nRulesets; ++i) {
+    ScheduleRuleset scheduleRuleset(m, 0.0);
+    scheduleRuleset.setName("Schedule Ruleset " + std::to_string(i));
+    scheduleRuleset.defaultDaySchedule().addValue(Time(0, 8), 0.0);
+    scheduleRuleset.defaultDaySchedule().addValue(Time(0, 18), 1.0);
+    for (int j = 0; j < nRulesPerRuleset; ++j) {
+      ScheduleRule scheduleRule(scheduleRuleset);
+      scheduleRule.setApplySaturday(j % 2 == 0);
+      scheduleRule.setApplySunday(j % 2 == 1);
+      scheduleRule.daySchedule().addValue(Time(0, 12), 0.5);
+    }
+  }
+
+  return m;
+}
+
+static void BM_SchedulesViewOpen(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeModelWithNScheduleRulesets(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    auto schedulesView = std::make_shared<SchedulesView>(false, model);
+    openstudio::Application::instance().application(true)->processEvents();
+    benchmark::DoNotOptimize(schedulesView);
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_SchedulesViewOpen)->Arg(100)->Arg(500)->Arg(1000)->Arg(1500)->Arg(3000)->Unit(benchmark::kMillisecond)->Complexity();
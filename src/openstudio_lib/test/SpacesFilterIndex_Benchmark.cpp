@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include "../../model_editor/Application.hpp"
+#include "../SpacesFilterIndex.hpp"
+
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/BuildingStory_Impl.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+#include <openstudio/model/Surface.hpp>
+#include <openstudio/model/Surface_Impl.hpp>
+#include <openstudio/utilities/core/Compare.hpp>
+#include <openstudio/utilities/geometry/Point3d.hpp>
+
+#include <set>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+model::Model makeFilterModelWithNSurfaces(size_t nSurfaces) {
+
+  Model m;
+
+  std::vector<BuildingStory> stories;
+  for (int i = 0; i < 10; ++i) {
+    stories.emplace_back(m);
+    stories.back().setName("Story " + std::to_string(i));
+  }
+
+  constexpr double floorHeight = 2.0;
+
+  double zOrigin = 0.0;
+  for (size_t i = 0; i < (nSurfaces / 6); ++i) {
+
+    Point3dVector pts{{0, 0, zOrigin}, {0, 1, zOrigin}, {1, 1, zOrigin}, {1, 0, zOrigin}};
+    auto space = Space::fromFloorPrint(pts, floorHeight, m);
+    zOrigin += floorHeight;
+    if (space) {
+      space->setBuildingStory(stories[i % stories.size()]);
+    }
+  }
+
+  return m;
+}
+
+// Surface Type + Story filters evaluated through the index
+static void BM_SpacesFilterIndex(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeFilterModelWithNSurfaces(state.range(0));
+
+  SpacesFilterIndex index(model);
+  index.addAttribute(SpacesFilterIndex::Story);
+  index.addAttribute(SpacesFilterIndex::SurfaceType);
+
+  std::vector<Handle> handles;
+  for (const auto& surface : model.getConcreteModelObjects<Surface>()) {
+    handles.push_back(surface.handle());
+  }
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    index.setFilter(SpacesFilterIndex::Story, "Story 3");
+    index.setFilter(SpacesFilterIndex::SurfaceType, "Wall");
+    auto visibleRows = index.visibleRows();
+    size_t nVisible = 0;
+    for (const auto& handle : handles) {
+      nVisible += index.isVisible(visibleRows, handle) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(nVisible);
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Same filters with the std::set scans SpacesSubtabGridView used before the index, for comparison
+static void BM_SpacesFilterSets(benchmark::State& state) {
+
+  openstudio::Application::instance().application(true);
+
+  model::Model model = makeFilterModelWithNSurfaces(state.range(0));
+
+  std::vector<ModelObject> spaces;
+  for (const auto& space : model.getConcreteModelObjects<Space>()) {
+    spaces.push_back(space);
+  }
+  std::vector<ModelObject> surfaces;
+  for (const auto& surface : model.getConcreteModelObjects<Surface>()) {
+    surfaces.push_back(surface);
+  }
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    std::set<ModelObject> filtered;
+    for (const auto& obj : spaces) {
+      auto buildingStory = obj.cast<Space>().buildingStory();
+      if (!buildingStory || !buildingStory->name() || (buildingStory->name().get() != "Story 3")) {
+        filtered.insert(obj);
+      }
+    }
+    for (const auto& obj : surfaces) {
+      if (!openstudio::istringEqual(obj.cast<Surface>().surfaceType(), "Wall")) {
+        filtered.insert(obj);
+      }
+    }
+    size_t nVisible = 0;
+    for (const auto& obj : surfaces) {
+      nVisible += (filtered.count(obj) == 0) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(nVisible);
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_SpacesFilterIndex)->Arg(600)->Arg(6000)->Arg(50000)->Unit(benchmark::kMillisecond)->Complexity();
+
+BENCHMARK(BM_SpacesFilterSets)->Arg(600)->Arg(6000)->Arg(50000)->Unit(benchmark::kMillisecond)->Complexity();
@@ -0,0 +1,467 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../SpacesFilterIndex.hpp"
+
+#include "../../model_editor/Utilities.hpp"
+
+#include <openstudio/model/Building.hpp>
+#include <openstudio/model/Building_Impl.hpp>
+#include <openstudio/model/BuildingStory.hpp>
+#include <openstudio/model/BuildingStory_Impl.hpp>
+#include <openstudio/model/InteriorPartitionSurfaceGroup.hpp>
+#include <openstudio/model/InteriorPartitionSurfaceGroup_Impl.hpp>
+#include <openstudio/model/Lights.hpp>
+#include <openstudio/model/Lights_Impl.hpp>
+#include <openstudio/model/LightsDefinition.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/People.hpp>
+#include <openstudio/model/People_Impl.hpp>
+#include <openstudio/model/PeopleDefinition.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+#include <openstudio/model/SpaceType.hpp>
+#include <openstudio/model/SpaceType_Impl.hpp>
+#include <openstudio/model/SubSurface.hpp>
+#include <openstudio/model/SubSurface_Impl.hpp>
+#include <openstudio/model/Surface.hpp>
+#include <openstudio/model/Surface_Impl.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/model/ThermalZone_Impl.hpp>
+#include <openstudio/utilities/core/Compare.hpp>
+#include <openstudio/utilities/geometry/Point3d.hpp>
+
+#include <QString>
+
+#include <functional>
+#include <set>
+
+using namespace openstudio;
+
+namespace {
+
+// 6 surfaces per Space, with a mix of stories, zones, space types, exposures, sub surfaces, partition groups and loads
+model::Model makeFilterModel(size_t nSurfaces) {
+  model::Model m;
+
+  std::vector<model::BuildingStory> stories;
+  for (int i = 0; i < 10; ++i) {
+    stories.emplace_back(m);
+    stories.back().setName("Story " + std::to_string(i));
+  }
+
+  std::vector<model::ThermalZone> zones;
+  for (int i = 0; i < 50; ++i) {
+    zones.emplace_back(m);
+    zones.back().setName("Zone " + std::to_string(i));
+  }
+
+  std::vector<model::SpaceType> spaceTypes;
+  for (int i = 0; i < 4; ++i) {
+    spaceTypes.emplace_back(m);
+    spaceTypes.back().setName("Space Type " + std::to_string(i));
+  }
+
+  model::PeopleDefinition peopleDefinition(m);
+  model::LightsDefinition lightsDefinition(m);
+
+  constexpr double floorHeight = 2.0;
+  double zOrigin = 0.0;
+  for (size_t i = 0; i < nSurfaces / 6; ++i) {
+    std::vector<Point3d> pts{{0, 0, zOrigin}, {0, 1, zOrigin}, {1, 1, zOrigin}, {1, 0, zOrigin}};
+    auto space = model::Space::fromFloorPrint(pts, floorHeight, m);
+    zOrigin += floorHeight;
+    EXPECT_TRUE(space);
+    if (!space) {
+      continue;
+    }
+
+    // leave some of each unassigned
+    if (i % 11 != 0) {
+      space->setBuildingStory(stories[i % stories.size()]);
+    }
+    if (i % 13 != 0) {
+      space->setThermalZone(zones[i % zones.size()]);
+    }
+    if (i % 5 != 0) {
+      space->setSpaceType(spaceTypes[i % spaceTypes.size()]);
+    }
+
+    size_t j = 0;
+    for (auto& surface : space->surfaces()) {
+      if ((i + j) % 7 == 0) {
+        surface.setSunExposure("NoSun");
+      }
+      if ((i + j) % 9 == 0) {
+        surface.setWindExposure("NoWind");
+      }
+      if ((surface.surfaceType() == "Floor") && (i % 3 == 0)) {
+        surface.setOutsideBoundaryCondition("Ground");
+      }
+      if ((surface.surfaceType() == "RoofCeiling") && (i % 4 == 0)) {
+        std::vector<Point3d> subPts{{0.25, 0.25, zOrigin}, {0.75, 0.25, zOrigin}, {0.75, 0.75, zOrigin}, {0.25, 0.75, zOrigin}};
+        model::SubSurface subSurface(subPts, m);
+        subSurface.setSurface(surface);
+        subSurface.setSubSurfaceType((i % 8 == 0) ? "Skylight" : "FixedWindow");
+      }
+      ++j;
+    }
+
+    if (i % 10 == 0) {
+      model::InteriorPartitionSurfaceGroup group(m);
+      group.setName("Partition Group " + std::to_string(i % 30));
+      group.setSpace(*space);
+    }
+
+    if (i % 2 == 0) {
+      model::People people(peopleDefinition);
+      people.setSpace(*space);
+    } else {
+      model::Lights lights(lightsDefinition);
+      lights.setSpace(*space);
+    }
+  }
+
+  return m;
+}
+
+template <typename T>
+std::vector<model::ModelObject> objects(const model::Model& m) {
+  std::vector<model::ModelObject> result;
+  for (const auto& obj : m.getConcreteModelObjects<T>()) {
+    result.push_back(obj);
+  }
+  return result;
+}
+
+// The set based filters SpacesSubtabGridView used before the index, they return the objects to hide
+using NameGetter = std::function<boost::optional<std::string>(const model::Space&, bool& assigned)>;
+
+std::set<model::ModelObject> referenceSpaceFilter(const std::vector<model::ModelObject>& spaces, const QString& text, const NameGetter& getName) {
+  std::set<model::ModelObject> result;
+  for (const auto& obj : spaces) {
+    bool assigned = false;
+    auto name = getName(obj.cast<model::Space>(), assigned);
+    if (text == "Unassigned") {
+      if (assigned) {
+        result.insert(obj);
+      }
+    } else if (!assigned || !name || (name.get().c_str() != text)) {
+      result.insert(obj);
+    }
+  }
+  return result;
+}
+
+std::set<model::ModelObject> referenceStoryFilter(const std::vector<model::ModelObject>& spaces, const QString& text) {
+  return referenceSpaceFilter(spaces, text, [](const model::Space& space, bool& assigned) -> boost::optional<std::string> {
+    auto buildingStory = space.buildingStory();
+    assigned = buildingStory.is_initialized();
+    return buildingStory ? buildingStory->name() : boost::none;
+  });
+}
+
+std::set<model::ModelObject> referenceThermalZoneFilter(const std::vector<model::ModelObject>& spaces, const QString& text) {
+  return referenceSpaceFilter(spaces, text, [](const model::Space& space, bool& assigned) -> boost::optional<std::string> {
+    auto thermalZone = space.thermalZone();
+    assigned = thermalZone.is_initialized();
+    return thermalZone ? thermalZone->name() : boost::none;
+  });
+}
+
+std::set<model::ModelObject> referenceSpaceTypeFilter(const std::vector<model::ModelObject>& spaces, const QString& text) {
+  return referenceSpaceFilter(spaces, text, [](const model::Space& space, bool& assigned) -> boost::optional<std::string> {
+    auto spaceType = space.spaceType();
+    assigned = spaceType.is_initialized();
+    return spaceType ? spaceType->name() : boost::none;
+  });
+}
+
+std::set<model::ModelObject> referenceSpaceNameFilter(const std::vector<model::ModelObject>& spaces, const QString& text) {
+  std::set<model::ModelObject> result;
+  for (const auto& obj : spaces) {
+    QString objName(obj.name().get().c_str());
+    if (!objName.contains(text, Qt::CaseInsensitive)) {
+      result.insert(obj);
+    }
+  }
+  return result;
+}
+
+std::set<model::ModelObject> referenceSurfaceFilter(const std::vector<model::ModelObject>& selectorObjects, const std::string& text,
+                                                    const std::function<std::string(const model::Surface&)>& getValue) {
+  std::set<model::ModelObject> result;
+  for (const auto& obj : selectorObjects) {
+    if (auto surface = obj.optionalCast<model::Surface>()) {
+      auto value = getValue(surface.get());
+      if (value.empty() || !openstudio::istringEqual(value, text)) {
+        result.insert(obj);
+      }
+    }
+  }
+  return result;
+}
+
+std::set<model::ModelObject> referenceOutsideBoundaryConditionFilter(const std::vector<model::ModelObject>& selectorObjects, const std::string& text) {
+  std::set<model::ModelObject> result;
+  for (const auto& obj : selectorObjects) {
+    std::string outsideBoundaryCondition;
+    if (auto surface = obj.optionalCast<model::Surface>()) {
+      outsideBoundaryCondition = surface->outsideBoundaryCondition();
+    } else if (auto subSurface = obj.optionalCast<model::SubSurface>()) {
+      outsideBoundaryCondition = subSurface->outsideBoundaryCondition();
+    }
+    if (outsideBoundaryCondition.empty() || !openstudio::istringEqual(outsideBoundaryCondition, text)) {
+      result.insert(obj);
+    }
+  }
+  return result;
+}
+
+std::set<model::ModelObject> referenceSubSurfaceTypeFilter(const std::vector<model::ModelObject>& selectorObjects, const std::string& text) {
+  std::set<model::ModelObject> result;
+  for (const auto& obj : selectorObjects) {
+    if (auto subSurface = obj.optionalCast<model::SubSurface>()) {
+      if (!openstudio::istringEqual(subSurface->subSurfaceType(), text)) {
+        result.insert(obj);
+      }
+    }
+  }
+  return result;
+}
+
+std::set<model::ModelObject> referenceInteriorPartitionGroupFilter(const std::vector<model::ModelObject>& selectorObjects, const QString& text) {
+  std::set<model::ModelObject> result;
+  for (const auto& obj : selectorObjects) {
+    if (obj.optionalCast<model::InteriorPartitionSurfaceGroup>()) {
+      if (!obj.name() || (obj.name().get().c_str() != text)) {
+        result.insert(obj);
+      }
+    }
+  }
+  return result;
+}
+
+std::set<model::ModelObject> referenceLoadTypeFilter(const std::vector<model::ModelObject>& selectorObjects, const IddObjectType& type) {
+  std::set<model::ModelObject> result;
+  for (const auto& obj : selectorObjects) {
+    if (obj.iddObjectType() != type) {
+      result.insert(obj);
+    }
+  }
+  return result;
+}
+
+// Compares the index against the union of the reference sets, over the rows of a subtab
+void expectSameVisibility(const SpacesFilterIndex& index, const std::vector<std::set<model::ModelObject>>& filtered,
+                          const std::vector<model::ModelObject>& spaces, const std::vector<model::ModelObject>& selectorObjects) {
+  std::set<model::ModelObject> allFilteredObjects;
+  for (const auto& f : filtered) {
+    allFilteredObjects.insert(f.begin(), f.end());
+  }
+
+  auto visibleRows = index.visibleRows();
+
+  size_t mismatches = 0;
+  for (const auto* objs : {&spaces, &selectorObjects}) {
+    for (const auto& obj : *objs) {
+      bool expected = (allFilteredObjects.count(obj) == 0);
+      if (index.isVisible(visibleRows, obj.handle()) != expected) {
+        ++mismatches;
+      }
+    }
+  }
+  EXPECT_EQ(0u, mismatches);
+}
+
+}  // namespace
+
+TEST_F(OpenStudioLibFixture, SpacesFilterIndex_SameResultsAsSetFilters) {
+  model::Model m = makeFilterModel(50000);
+
+  auto spaces = objects<model::Space>(m);
+  auto surfaces = objects<model::Surface>(m);
+  auto subSurfaces = objects<model::SubSurface>(m);
+  auto groups = objects<model::InteriorPartitionSurfaceGroup>(m);
+  auto loads = objects<model::People>(m);
+  auto lights = objects<model::Lights>(m);
+  loads.insert(loads.end(), lights.begin(), lights.end());
+
+  EXPECT_EQ(49998u, surfaces.size());
+
+  SpacesFilterIndex index(m);
+  for (int attribute = 0; attribute < SpacesFilterIndex::NumAttributes; ++attribute) {
+    index.addAttribute(static_cast<SpacesFilterIndex::Attribute>(attribute));
+  }
+  EXPECT_EQ(spaces.size() + surfaces.size() + subSurfaces.size() + groups.size() + loads.size(), index.numRows());
+
+  // nothing filtered
+  expectSameVisibility(index, {}, spaces, surfaces);
+
+  // Space level filters, one at a time then combined
+  index.setFilter(SpacesFilterIndex::Story, "Story 3");
+  expectSameVisibility(index, {referenceStoryFilter(spaces, "Story 3")}, spaces, surfaces);
+
+  index.setUnassignedFilter(SpacesFilterIndex::Story);
+  expectSameVisibility(index, {referenceStoryFilter(spaces, "Unassigned")}, spaces, surfaces);
+
+  index.setFilter(SpacesFilterIndex::Story, "Story 4");
+  index.setFilter(SpacesFilterIndex::ThermalZone, "Zone 14");
+  index.setUnassignedFilter(SpacesFilterIndex::SpaceType);
+  expectSameVisibility(index,
+                       {referenceStoryFilter(spaces, "Story 4"), referenceThermalZoneFilter(spaces, "Zone 14"),
+                        referenceSpaceTypeFilter(spaces, "Unassigned")},
+                       spaces, surfaces);
+
+  index.clearFilter(SpacesFilterIndex::Story);
+  index.clearFilter(SpacesFilterIndex::ThermalZone);
+  index.setFilter(SpacesFilterIndex::SpaceType, "Space Type 2");
+  index.setFilter(SpacesFilterIndex::SpaceName, "SPACE 1");
+  expectSameVisibility(index, {referenceSpaceTypeFilter(spaces, "Space Type 2"), referenceSpaceNameFilter(spaces, "SPACE 1")}, spaces, surfaces);
+  index.clearFilter(SpacesFilterIndex::SpaceType);
+  index.clearFilter(SpacesFilterIndex::SpaceName);
+
+  // Surfaces subtab
+  auto getSun = [](const model::Surface& s) { return s.sunExposure(); };
+  auto getWind = [](const model::Surface& s) { return s.windExposure(); };
+  auto getSurfaceType = [](const model::Surface& s) { return s.surfaceType(); };
+
+  index.setFilter(SpacesFilterIndex::SurfaceType, "Wall");
+  expectSameVisibility(index, {referenceSurfaceFilter(surfaces, "Wall", getSurfaceType)}, spaces, surfaces);
+
+  index.setFilter(SpacesFilterIndex::SunExposure, "sunexposed");
+  index.setFilter(SpacesFilterIndex::WindExposure, "NoWind");
+  index.setFilter(SpacesFilterIndex::OutsideBoundaryCondition, "Outdoors");
+  index.setFilter(SpacesFilterIndex::Story, "Story 7");
+  expectSameVisibility(index,
+                       {referenceSurfaceFilter(surfaces, "Wall", getSurfaceType), referenceSurfaceFilter(surfaces, "sunexposed", getSun),
+                        referenceSurfaceFilter(surfaces, "NoWind", getWind), referenceOutsideBoundaryConditionFilter(surfaces, "Outdoors"),
+                        referenceStoryFilter(spaces, "Story 7")},
+                       spaces, surfaces);
+
+  index.clearFilter(SpacesFilterIndex::SurfaceType);
+  index.clearFilter(SpacesFilterIndex::SunExposure);
+  index.clearFilter(SpacesFilterIndex::WindExposure);
+  index.setFilter(SpacesFilterIndex::OutsideBoundaryCondition, "Ground");
+  expectSameVisibility(index, {referenceOutsideBoundaryConditionFilter(surfaces, "Ground"), referenceStoryFilter(spaces, "Story 7")}, spaces,
+                       surfaces);
+  index.clearFilter(SpacesFilterIndex::OutsideBoundaryCondition);
+  index.clearFilter(SpacesFilterIndex::Story);
+
+  // SubSurfaces subtab
+  index.setFilter(SpacesFilterIndex::SubSurfaceType, "skylight");
+  expectSameVisibility(index, {referenceSubSurfaceTypeFilter(subSurfaces, "skylight")}, spaces, subSurfaces);
+  index.clearFilter(SpacesFilterIndex::SubSurfaceType);
+
+  // Interior Partitions subtab
+  index.setFilter(SpacesFilterIndex::InteriorPartitionGroup, "Partition Group 20");
+  expectSameVisibility(index, {referenceInteriorPartitionGroupFilter(groups, "Partition Group 20")}, spaces, groups);
+  index.clearFilter(SpacesFilterIndex::InteriorPartitionGroup);
+
+  // Loads subtab
+  IddObjectType peopleType(IddObjectType::OS_People);
+  index.setFilter(SpacesFilterIndex::LoadType, peopleType.valueName());
+  index.setFilter(SpacesFilterIndex::ThermalZone, "Zone 3");
+  expectSameVisibility(index, {referenceLoadTypeFilter(loads, peopleType), referenceThermalZoneFilter(spaces, "Zone 3")}, spaces, loads);
+  index.clearFilter(SpacesFilterIndex::LoadType);
+  index.clearFilter(SpacesFilterIndex::ThermalZone);
+}
+
+TEST_F(OpenStudioLibFixture, SpacesFilterIndex_IncrementalUpdates) {
+  model::Model m = makeFilterModel(600);
+
+  SpacesFilterIndex index(m);
+  index.addAttribute(SpacesFilterIndex::Story);
+  index.addAttribute(SpacesFilterIndex::SpaceType);
+  index.addAttribute(SpacesFilterIndex::SunExposure);
+  index.addAttribute(SpacesFilterIndex::SurfaceType);
+
+  index.setFilter(SpacesFilterIndex::Story, "Story 2");
+  index.setFilter(SpacesFilterIndex::SunExposure, "NoSun");
+
+  auto check = [&]() {
+    auto spaces = objects<model::Space>(m);
+    auto surfaces = objects<model::Surface>(m);
+    auto getSun = [](const model::Surface& s) { return s.sunExposure(); };
+    expectSameVisibility(index, {referenceStoryFilter(spaces, "Story 2"), referenceSurfaceFilter(surfaces, "NoSun", getSun)}, spaces, surfaces);
+  };
+  check();
+
+  // field changes
+  auto surfaces = m.getConcreteModelObjects<model::Surface>();
+  ASSERT_FALSE(surfaces.empty());
+  surfaces[0].setSunExposure(istringEqual(surfaces[0].sunExposure(), "NoSun") ? "SunExposed" : "NoSun");
+  check();
+
+  auto spaces = m.getConcreteModelObjects<model::Space>();
+  ASSERT_FALSE(spaces.empty());
+  auto story = m.getConcreteModelObjects<model::BuildingStory>()[0];
+  spaces[0].setBuildingStory(story);
+  spaces[1].resetBuildingStory();
+  check();
+
+  // renaming the story doesn't need the spaces to be reindexed
+  for (auto& s : m.getConcreteModelObjects<model::BuildingStory>()) {
+    if (s.nameString() == "Story 2") {
+      s.setName("Story 2 Renamed");
+    } else if (s.handle() == story.handle()) {
+      s.setName("Story 2");
+    }
+  }
+  check();
+
+  // additions and removals
+  std::vector<Point3d> pts{{0, 0, -10}, {0, 1, -10}, {1, 1, -10}, {1, 0, -10}};
+  auto space = model::Space::fromFloorPrint(pts, 2.0, m);
+  ASSERT_TRUE(space);
+  space->setBuildingStory(story);
+  check();
+
+  spaces[2].remove();
+  check();
+
+  // Spaces without their own SpaceType follow the Building's
+  auto spaceType = m.getConcreteModelObjects<model::SpaceType>()[0];
+  index.setFilter(SpacesFilterIndex::SpaceType, spaceType.nameString());
+  auto building = m.getUniqueModelObject<model::Building>();
+  building.setSpaceType(spaceType);
+  {
+    auto spaces = objects<model::Space>(m);
+    auto surfaces = objects<model::Surface>(m);
+    auto getSun = [](const model::Surface& s) { return s.sunExposure(); };
+    expectSameVisibility(index,
+                         {referenceStoryFilter(spaces, "Story 2"), referenceSurfaceFilter(surfaces, "NoSun", getSun),
+                          referenceSpaceTypeFilter(spaces, toQString(spaceType.nameString()))},
+                         spaces, surfaces);
+  }
+}
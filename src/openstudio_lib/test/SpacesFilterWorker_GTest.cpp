@@ -0,0 +1,191 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../SpacesFilterIndex.hpp"
+#include "../SpacesFilterWorker.hpp"
+
+#include <openstudio/model/Lights.hpp>
+#include <openstudio/model/Lights_Impl.hpp>
+#include <openstudio/model/LightsDefinition.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/People.hpp>
+#include <openstudio/model/People_Impl.hpp>
+#include <openstudio/model/PeopleDefinition.hpp>
+#include <openstudio/model/Space.hpp>
+#include <openstudio/model/Space_Impl.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace openstudio;
+
+namespace {
+
+using RowMask = SpacesFilterIndex::RowMask;
+
+// Waits until condition holds, giving up after a few seconds
+template <typename Condition>
+bool waitFor(const Condition& condition, const std::function<void()>& step) {
+  auto start = std::chrono::steady_clock::now();
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() - start > std::chrono::seconds(10)) {
+      return false;
+    }
+    step();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST_F(OpenStudioLibFixture, SpacesFilterWorker_SupersededRequests) {
+  SpacesFilterWorker worker;
+
+  std::vector<unsigned> emitted;
+  RowMask emittedMask;
+  QObject::connect(&worker, &SpacesFilterWorker::maskReady, [&emitted, &emittedMask](unsigned requestId, const RowMask& visibleRows) {
+    emitted.push_back(requestId);
+    emittedMask = visibleRows;
+  });
+
+  // the first evaluation keeps running until it's told it was superseded
+  std::atomic<bool> firstStarted(false);
+  std::atomic<bool> firstCancelled(false);
+  worker.request([&firstStarted, &firstCancelled](const std::function<bool()>& isCancelled) -> boost::optional<RowMask> {
+    firstStarted = true;
+    if (waitFor(isCancelled, []() {})) {
+      firstCancelled = true;
+    }
+    // a result anyway, the worker must not emit it
+    return RowMask(1);
+  });
+  ASSERT_TRUE(waitFor([&firstStarted]() { return firstStarted.load(); }, []() {}));
+
+  worker.request([](const std::function<bool()>& isCancelled) -> boost::optional<RowMask> { return RowMask(2); });
+
+  unsigned lastRequest = worker.request([](const std::function<bool()>& isCancelled) -> boost::optional<RowMask> {
+    RowMask result(3);
+    result.set(1);
+    return result;
+  });
+
+  EXPECT_TRUE(waitFor([&worker]() { return worker.pendingCount() == 0; }, [this]() { processEvents(); }));
+
+  EXPECT_TRUE(firstCancelled.load());
+  EXPECT_EQ(2u, worker.cancelledCount());
+  ASSERT_EQ(1u, emitted.size());
+  EXPECT_EQ(lastRequest, emitted[0]);
+  ASSERT_EQ(3u, emittedMask.size());
+  EXPECT_TRUE(emittedMask.test(1));
+  EXPECT_EQ(1u, emittedMask.count());
+
+  // cancel without a new request, as when the filter goes back to All
+  worker.request([](const std::function<bool()>& isCancelled) -> boost::optional<RowMask> { return RowMask(4); });
+  worker.cancel();
+
+  EXPECT_TRUE(waitFor([&worker]() { return worker.pendingCount() == 0; }, [this]() { processEvents(); }));
+
+  EXPECT_EQ(3u, worker.cancelledCount());
+  EXPECT_EQ(1u, emitted.size());
+}
+
+TEST_F(OpenStudioLibFixture, SpacesFilterWorker_LoadTypeSnapshot) {
+  model::Model m;
+  model::Space space(m);
+  model::PeopleDefinition peopleDefinition(m);
+  model::LightsDefinition lightsDefinition(m);
+
+  std::vector<model::People> people;
+  std::vector<model::Lights> lights;
+  for (int i = 0; i < 2000; ++i) {
+    people.emplace_back(peopleDefinition);
+    people.back().setSpace(space);
+    lights.emplace_back(lightsDefinition);
+    lights.back().setSpace(space);
+  }
+
+  SpacesFilterIndex index(m);
+  index.addAttribute(SpacesFilterIndex::LoadType);
+  index.addAttribute(SpacesFilterIndex::Story);
+
+  auto snapshot = index.typeSnapshot(SpacesFilterIndex::LoadType);
+  EXPECT_EQ(2000, std::count(snapshot->begin(), snapshot->end(), IddObjectType(IddObjectType::OS_People)));
+  EXPECT_EQ(2000, std::count(snapshot->begin(), snapshot->end(), IddObjectType(IddObjectType::OS_Lights)));
+
+  // the types are kept by the index, a later snapshot shares them rather than walking the rows again
+  EXPECT_EQ(snapshot.get(), index.typeSnapshot(SpacesFilterIndex::LoadType).get());
+
+  // a cancelled evaluation gives up
+  EXPECT_FALSE(SpacesFilterIndex::visibleRowsOfType(snapshot, IddObjectType::OS_People, []() { return true; }));
+
+  auto visibleRows = SpacesFilterIndex::visibleRowsOfType(snapshot, IddObjectType::OS_People, []() { return false; });
+  ASSERT_TRUE(visibleRows);
+  index.setFilterMask(SpacesFilterIndex::LoadType, visibleRows.get());
+
+  // same result as the filter evaluated on the gui thread
+  auto mask = index.visibleRows();
+  index.setFilter(SpacesFilterIndex::LoadType, IddObjectType(IddObjectType::OS_People).valueName());
+  EXPECT_EQ(index.visibleRows(), mask);
+
+  for (const auto& p : people) {
+    EXPECT_TRUE(index.isVisible(mask, p.handle()));
+  }
+  for (const auto& l : lights) {
+    EXPECT_FALSE(index.isVisible(mask, l.handle()));
+  }
+  EXPECT_TRUE(index.isVisible(mask, space.handle()));
+
+  // loads added after the snapshot are visible until the filter is evaluated again
+  const std::vector<IddObjectType> types = *snapshot;
+  model::Lights newLights(lightsDefinition);
+  newLights.setSpace(space);
+  index.setFilterMask(SpacesFilterIndex::LoadType, visibleRows.get());
+  EXPECT_TRUE(index.isVisible(index.visibleRows(), newLights.handle()));
+
+  // the snapshot in use did not change, the next one has the new load
+  EXPECT_EQ(types, *snapshot);
+  auto newSnapshot = index.typeSnapshot(SpacesFilterIndex::LoadType);
+  EXPECT_NE(snapshot.get(), newSnapshot.get());
+  auto newRow = index.row(newLights.handle());
+  ASSERT_TRUE(newRow);
+  ASSERT_LT(newRow.get(), newSnapshot->size());
+  EXPECT_EQ(IddObjectType(IddObjectType::OS_Lights), (*newSnapshot)[newRow.get()]);
+
+  visibleRows = SpacesFilterIndex::visibleRowsOfType(newSnapshot, IddObjectType::OS_People, []() { return false; });
+  ASSERT_TRUE(visibleRows);
+  index.setFilterMask(SpacesFilterIndex::LoadType, visibleRows.get());
+  EXPECT_FALSE(index.isVisible(index.visibleRows(), newLights.handle()));
+}
@@ -0,0 +1,82 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../VRFController.hpp"
+#include "../VRFGraphicsItems.hpp"
+
+#include <openstudio/model/AirConditionerVariableRefrigerantFlow.hpp>
+#include <openstudio/model/Model.hpp>
+#include <openstudio/model/ThermalZone.hpp>
+#include <openstudio/model/ZoneHVACTerminalUnitVariableRefrigerantFlow.hpp>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, VRFController_AttachZone) {
+  model::Model model;
+  model::AirConditionerVariableRefrigerantFlow vrf(model);
+
+  std::vector<model::ZoneHVACTerminalUnitVariableRefrigerantFlow> terminals;
+  for (int i = 0; i < 120; ++i) {
+    model::ZoneHVACTerminalUnitVariableRefrigerantFlow terminal(model);
+    vrf.addTerminal(terminal);
+    terminals.push_back(terminal);
+  }
+
+  VRFSystemView systemView;
+  boost::optional<model::AirConditionerVariableRefrigerantFlow> t_vrf = vrf;
+  EXPECT_EQ(120u, VRFController::refreshVRFSystemView(&systemView, t_vrf));
+
+  std::vector<VRFTerminalView*> terminalViews;
+  for (const auto& terminal : terminals) {
+    terminalViews.push_back(systemView.vrfTerminalView(terminal.handle()));
+    ASSERT_TRUE(terminalViews.back());
+    EXPECT_TRUE(terminalViews.back()->zoneName().isEmpty());
+  }
+
+  // attaching a zone only updates the label of that terminal
+  model::ThermalZone zone(model);
+  zone.setName("Zone 1");
+  EXPECT_TRUE(terminals[42].addToThermalZone(zone));
+
+  EXPECT_EQ(0u, VRFController::refreshVRFSystemView(&systemView, t_vrf));
+  for (size_t i = 0; i < terminals.size(); ++i) {
+    EXPECT_EQ(terminalViews[i], systemView.vrfTerminalView(terminals[i].handle()));
+  }
+  EXPECT_EQ("Zone 1", terminalViews[42]->zoneName().toStdString());
+  EXPECT_TRUE(terminalViews[41]->zoneName().isEmpty());
+
+  // removing the zone resets the label
+  terminals[42].removeFromThermalZone();
+  EXPECT_EQ(0u, VRFController::refreshVRFSystemView(&systemView, t_vrf));
+  EXPECT_TRUE(terminalViews[42]->zoneName().isEmpty());
+}
@@ -35,6 +35,7 @@
 #include "Component.hpp"
 #include "ComponentList.hpp"
 #include "BaseApp.hpp"
+#include "LocalBCLComponentCache.hpp"
 #include "MeasureManager.hpp"
 
 #include <openstudio/measure/OSArgument.hpp>
@@ -320,6 +321,7 @@ void BuildingComponentDialogCentralWidget::componentDownloadComplete(const std::
     if (oldComponent && oldComponent->versionId() != component->versionId()) {
       LocalBCL::instance().removeComponent(*oldComponent);
     }
+    LocalBCLComponentCache::instance().invalidate();
   } else {
     // error downloading component
     // find component in list by uid and re-enable
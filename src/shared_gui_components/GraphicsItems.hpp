@@ -31,15 +31,50 @@
 #define SHAREDGUICOMPONENTS_GRAPHICSITEMS_HPP
 
 #include <openstudio/nano/nano_signal_slot.hpp>  // Signal-Slot replacement
+#include <openstudio/utilities/core/UUID.hpp>
 #include <QGraphicsObject>
 #include <QSizeF>
 
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
 namespace openstudio {
 
 class OSListItem;
 class OSListController;
 class OSGraphicsItemDelegate;
 
+// Makes keyedViews the child views of container, in this order, indexed by the handle of the object each one shows.
+// Views that are still listed are reused, new ones are parented to container and the ones no longer listed are deleted
+template <typename ViewType>
+void setKeyedChildViews(QGraphicsObject* container, const std::vector<std::pair<Handle, ViewType*>>& keyedViews,
+                        std::vector<QGraphicsObject*>& views, std::map<Handle, ViewType*>& viewsByHandle) {
+  std::set<QGraphicsObject*> keptViews;
+  for (const auto& keyedView : keyedViews) {
+    keptViews.insert(keyedView.second);
+  }
+
+  for (QGraphicsObject* view : views) {
+    if (keptViews.find(view) == keptViews.end()) {
+      delete view;
+    }
+  }
+
+  views.clear();
+  viewsByHandle.clear();
+
+  for (const auto& keyedView : keyedViews) {
+    if (keyedView.second->parentItem() != container) {
+      keyedView.second->setParentItem(container);
+    }
+
+    views.push_back(keyedView.second);
+    viewsByHandle[keyedView.first] = keyedView.second;
+  }
+}
+
 // Button functionality without any visual elements
 // ButtonItem already existed when AbstractButtonItem was factored out.
 // Ideally ButtonItem derives from AbstractButtonItem.
@@ -0,0 +1,165 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "GridLayoutProfiles.hpp"
+
+#include <QCoreApplication>
+#include <QSettings>
+#include <QStringList>
+#include <QtConcurrent>
+
+#include <memory>
+
+namespace openstudio {
+
+namespace {
+
+std::unique_ptr<GridLayoutProfiles>& instancePtr() {
+  static std::unique_ptr<GridLayoutProfiles> profiles;
+  return profiles;
+}
+
+}  // namespace
+
+GridLayoutProfiles::GridLayoutProfiles(const QString& organization, const QString& application)
+  : m_organization(organization), m_application(application) {
+  // one write for all the changes made while processing an event
+  m_writeTimer.setSingleShot(true);
+  m_writeTimer.setInterval(0);
+  QObject::connect(&m_writeTimer, &QTimer::timeout, [this]() { startWrite(); });
+
+  if (QCoreApplication* app = QCoreApplication::instance()) {
+    QObject::connect(app, &QCoreApplication::aboutToQuit, &m_writeTimer, [this]() { flush(); });
+  }
+}
+
+GridLayoutProfiles::~GridLayoutProfiles() {
+  flush();
+}
+
+GridLayoutProfiles& GridLayoutProfiles::instance() {
+  std::unique_ptr<GridLayoutProfiles>& profiles = instancePtr();
+  if (!profiles) {
+    profiles.reset(new GridLayoutProfiles("OpenStudio", "GridLayoutProfiles"));
+  }
+  return *profiles;
+}
+
+void GridLayoutProfiles::setInstanceSettings(const QString& organization, const QString& application) {
+  instancePtr().reset(new GridLayoutProfiles(organization, application));
+}
+
+std::vector<QString> GridLayoutProfiles::customFields(const QString& gridName) {
+  load();
+
+  auto it = m_customFields.find(gridName);
+  if (it != m_customFields.end()) {
+    return it->second;
+  }
+  return std::vector<QString>();
+}
+
+void GridLayoutProfiles::setCustomFields(const QString& gridName, const std::vector<QString>& customFields) {
+  load();
+
+  std::vector<QString>& current = m_customFields[gridName];
+  if (current != customFields) {
+    current = customFields;
+    m_dirty = true;
+    m_writeTimer.start();
+  }
+}
+
+void GridLayoutProfiles::flush() {
+  m_writeTimer.stop();
+  m_write.waitForFinished();
+  if (m_dirty) {
+    m_dirty = false;
+    ++m_settingsWrites;
+    write(m_organization, m_application, m_customFields);
+  }
+}
+
+unsigned GridLayoutProfiles::settingsReads() const {
+  return m_settingsReads;
+}
+
+unsigned GridLayoutProfiles::settingsWrites() const {
+  return m_settingsWrites;
+}
+
+void GridLayoutProfiles::load() {
+  if (m_loaded) {
+    return;
+  }
+  m_loaded = true;
+  ++m_settingsReads;
+
+  QSettings settings(m_organization, m_application);
+  const int size = settings.beginReadArray("grids");
+  for (int i = 0; i < size; ++i) {
+    settings.setArrayIndex(i);
+    const QStringList fields = settings.value("customFields").toStringList();
+    m_customFields[settings.value("name").toString()] = std::vector<QString>(fields.begin(), fields.end());
+  }
+  settings.endArray();
+}
+
+void GridLayoutProfiles::startWrite() {
+  if (!m_dirty) {
+    return;
+  }
+
+  // writes go to the settings in order
+  m_write.waitForFinished();
+
+  m_dirty = false;
+  ++m_settingsWrites;
+  m_write = QtConcurrent::run(&GridLayoutProfiles::write, m_organization, m_application, m_customFields);
+}
+
+void GridLayoutProfiles::write(const QString& organization, const QString& application, const std::map<QString, std::vector<QString>>& customFields) {
+  QSettings settings(organization, application);
+  settings.remove("grids");
+  settings.beginWriteArray("grids", customFields.size());
+  int i = 0;
+  for (const auto& gridFields : customFields) {
+    settings.setArrayIndex(i++);
+    settings.setValue("name", gridFields.first);
+    QStringList fields;
+    for (const QString& field : gridFields.second) {
+      fields << field;
+    }
+    settings.setValue("customFields", fields);
+  }
+  settings.endArray();
+  settings.sync();
+}
+
+}  // namespace openstudio
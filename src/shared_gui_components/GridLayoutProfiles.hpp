@@ -0,0 +1,98 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef SHAREDGUICOMPONENTS_GRIDLAYOUTPROFILES_HPP
+#define SHAREDGUICOMPONENTS_GRIDLAYOUTPROFILES_HPP
+
+#include <QFuture>
+#include <QString>
+#include <QTimer>
+
+#include <map>
+#include <vector>
+
+namespace openstudio {
+
+// Layout preferences of the grid views, the fields of their "Custom" category, by grid name (the grid header text).
+// All the profiles are read from the settings at once, the first time one is needed, and grids are then built from memory.
+// Changes are written back together, on a worker thread, after the event that made them has been processed.
+class GridLayoutProfiles
+{
+ public:
+  GridLayoutProfiles(const QString& organization, const QString& application);
+
+  GridLayoutProfiles(const GridLayoutProfiles&) = delete;
+  GridLayoutProfiles& operator=(const GridLayoutProfiles&) = delete;
+
+  // Writes the pending changes
+  ~GridLayoutProfiles();
+
+  // The profiles used by the grids
+  static GridLayoutProfiles& instance();
+
+  // Makes instance() use other settings, for testing
+  static void setInstanceSettings(const QString& organization, const QString& application);
+
+  std::vector<QString> customFields(const QString& gridName);
+
+  void setCustomFields(const QString& gridName, const std::vector<QString>& customFields);
+
+  // Writes the pending changes now, and waits for them to be written
+  void flush();
+
+  // Number of times the settings were read and written, for testing
+  unsigned settingsReads() const;
+  unsigned settingsWrites() const;
+
+ private:
+  void load();
+
+  // Starts writing a copy of the profiles on a worker thread
+  void startWrite();
+
+  static void write(const QString& organization, const QString& application, const std::map<QString, std::vector<QString>>& customFields);
+
+  QString m_organization;
+  QString m_application;
+
+  bool m_loaded = false;
+  bool m_dirty = false;
+
+  std::map<QString, std::vector<QString>> m_customFields;
+
+  QTimer m_writeTimer;
+  QFuture<void> m_write;
+
+  unsigned m_settingsReads = 0;
+  unsigned m_settingsWrites = 0;
+};
+
+}  // namespace openstudio
+
+#endif  // SHAREDGUICOMPONENTS_GRIDLAYOUTPROFILES_HPP
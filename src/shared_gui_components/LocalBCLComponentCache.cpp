@@ -0,0 +1,85 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "LocalBCLComponentCache.hpp"
+
+#include <openstudio/utilities/bcl/LocalBCL.hpp>
+
+#include <algorithm>
+
+namespace openstudio {
+
+LocalBCLComponentCache* LocalBCLComponentCache::s_instance = nullptr;
+
+LocalBCLComponentCache& LocalBCLComponentCache::instance() {
+  if (!s_instance) {
+    s_instance = new LocalBCLComponentCache();
+  }
+
+  return *s_instance;
+}
+
+LocalBCLComponentCache::LocalBCLComponentCache() : QObject(), m_searchCount(0) {}
+
+const std::vector<BCLComponent>& LocalBCLComponentCache::components(const IddObjectType& iddObjectType) {
+  // LocalBCL::instance(path) may have re-targeted the singleton, drop everything that came from the old library
+  openstudio::path libraryPath = LocalBCL::instance().libraryPath();
+  if (libraryPath != m_libraryPath) {
+    m_components.clear();
+    m_libraryPath = libraryPath;
+  }
+
+  auto it = m_components.find(iddObjectType.value());
+  if (it == m_components.end()) {
+    std::vector<std::pair<std::string, std::string>> pairs;
+    pairs.push_back(std::make_pair<std::string, std::string>("OpenStudio Type", iddObjectType.valueDescription()));
+
+    // get BCL results
+    std::vector<BCLComponent> bclresults = LocalBCL::instance().componentAttributeSearch(pairs);
+    ++m_searchCount;
+
+    // sort by name
+    std::sort(bclresults.begin(), bclresults.end(), BCLComponentNameGreater());
+
+    it = m_components.insert(std::make_pair(iddObjectType.value(), std::move(bclresults))).first;
+  }
+
+  return it->second;
+}
+
+unsigned LocalBCLComponentCache::searchCount() const {
+  return m_searchCount;
+}
+
+void LocalBCLComponentCache::invalidate() {
+  m_components.clear();
+  emit invalidated();
+}
+
+}  // namespace openstudio
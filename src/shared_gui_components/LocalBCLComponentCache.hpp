@@ -0,0 +1,91 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef SHAREDGUICOMPONENTS_LOCALBCLCOMPONENTCACHE_HPP
+#define SHAREDGUICOMPONENTS_LOCALBCLCOMPONENTCACHE_HPP
+
+#include <openstudio/utilities/bcl/BCLComponent.hpp>
+#include <openstudio/utilities/core/Logger.hpp>
+#include <openstudio/utilities/core/Path.hpp>
+#include <openstudio/utilities/idd/IddEnums.hpp>
+
+#include <QObject>
+
+#include <map>
+#include <vector>
+
+namespace openstudio {
+
+/*! This class is a simple singleton that caches the result of LocalBCL component searches by OpenStudio Type
+ *
+ * Searching the LocalBCL hits its sqlite database, while its contents only change when components are downloaded or removed.
+ * Results are kept per IddObjectType until invalidate() is called or the LocalBCL library path changes.
+ */
+class LocalBCLComponentCache : public QObject
+{
+  Q_OBJECT
+
+ public:
+  //! If the class in not instantiated, this call will instantiate it
+  static LocalBCLComponentCache& instance();
+
+  virtual ~LocalBCLComponentCache() {}
+
+  //! LocalBCL components whose "OpenStudio Type" attribute matches the iddObjectType, sorted by BCLComponentNameGreater
+  const std::vector<BCLComponent>& components(const IddObjectType& iddObjectType);
+
+  //! Number of searches actually run against the LocalBCL since the cache was created
+  unsigned searchCount() const;
+
+ public slots:
+
+  //! Call this whenever the LocalBCL contents change, emits invalidated
+  void invalidate();
+
+ signals:
+
+  void invalidated();
+
+ private:
+  REGISTER_LOGGER("openstudio.shared_gui_components.LocalBCLComponentCache");
+
+  LocalBCLComponentCache();
+  LocalBCLComponentCache(const LocalBCLComponentCache&);
+  LocalBCLComponentCache& operator=(const LocalBCLComponentCache&);
+
+  static LocalBCLComponentCache* s_instance;
+
+  std::map<int, std::vector<BCLComponent>> m_components;
+  openstudio::path m_libraryPath;
+  unsigned m_searchCount;
+};
+
+}  // namespace openstudio
+
+#endif  // SHAREDGUICOMPONENTS_LOCALBCLCOMPONENTCACHE_HPP
@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ModelObjectChangeBatch.hpp"
+
+namespace openstudio {
+
+int ModelObjectChangeBatch::s_depth = 0;
+std::vector<std::pair<QPointer<QObject>, std::function<void()>>> ModelObjectChangeBatch::s_deferred;
+std::map<QObject*, size_t> ModelObjectChangeBatch::s_deferredIndex;
+unsigned ModelObjectChangeBatch::s_refreshesDeferred = 0;
+unsigned ModelObjectChangeBatch::s_refreshesRun = 0;
+
+ModelObjectChangeBatch::ModelObjectChangeBatch() {
+  ++s_depth;
+}
+
+ModelObjectChangeBatch::~ModelObjectChangeBatch() {
+  if (--s_depth == 0) {
+    refreshDeferred();
+  }
+}
+
+bool ModelObjectChangeBatch::isOpen() {
+  return s_depth > 0;
+}
+
+bool ModelObjectChangeBatch::deferRefresh(QObject* t_widget, const std::function<void()>& t_refresh) {
+  if (s_depth == 0) {
+    return false;
+  }
+
+  ++s_refreshesDeferred;
+
+  auto it = s_deferredIndex.find(t_widget);
+  if (it == s_deferredIndex.end()) {
+    s_deferredIndex[t_widget] = s_deferred.size();
+    s_deferred.emplace_back(t_widget, t_refresh);
+  } else if (s_deferred[it->second].first.isNull()) {
+    // a widget deleted during the batch, at the same address
+    s_deferred[it->second] = std::make_pair(QPointer<QObject>(t_widget), t_refresh);
+  }
+
+  return true;
+}
+
+unsigned ModelObjectChangeBatch::refreshesDeferred() {
+  return s_refreshesDeferred;
+}
+
+unsigned ModelObjectChangeBatch::refreshesRun() {
+  return s_refreshesRun;
+}
+
+void ModelObjectChangeBatch::refreshDeferred() {
+  std::vector<std::pair<QPointer<QObject>, std::function<void()>>> deferred;
+  deferred.swap(s_deferred);
+  s_deferredIndex.clear();
+
+  for (const auto& widgetAndRefresh : deferred) {
+    if (widgetAndRefresh.first) {
+      widgetAndRefresh.second();
+      ++s_refreshesRun;
+    }
+  }
+}
+
+}  // namespace openstudio
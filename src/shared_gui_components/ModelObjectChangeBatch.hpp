@@ -0,0 +1,92 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2020-2020, OpenStudio Coalition and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef SHAREDGUICOMPONENTS_MODELOBJECTCHANGEBATCH_HPP
+#define SHAREDGUICOMPONENTS_MODELOBJECTCHANGEBATCH_HPP
+
+#include <QObject>
+#include <QPointer>
+
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+
+// Suspends the refresh of the widgets bound to model objects while many objects are changed together, e.g. "Apply to Selected".
+// While a batch is open, a widget told that its object changed defers its refresh, and each deferred widget refreshes once
+// when the outermost batch is closed, after all the changes were made.
+class ModelObjectChangeBatch
+{
+ public:
+  ModelObjectChangeBatch();
+
+  ModelObjectChangeBatch(const ModelObjectChangeBatch&) = delete;
+  ModelObjectChangeBatch& operator=(const ModelObjectChangeBatch&) = delete;
+
+  // Refreshes the deferred widgets if this is the outermost batch
+  ~ModelObjectChangeBatch();
+
+  static bool isOpen();
+
+  // Called by a widget on change, returns false if no batch is open and the widget should refresh now.
+  // A widget deferring several times refreshes once, with the t_refresh of its first call.
+  static bool deferRefresh(QObject* t_widget, const std::function<void()>& t_refresh);
+
+  // Same for a widget bound to a model object, the deferred t_onChange is skipped if the widget was unbound by then
+  template <typename Widget, typename BoundObject>
+  static bool deferRefresh(Widget* t_widget, void (Widget::*t_onChange)(), BoundObject Widget::*t_boundObject) {
+    return deferRefresh(t_widget, [t_widget, t_onChange, t_boundObject]() {
+      if (t_widget->*t_boundObject) {
+        (t_widget->*t_onChange)();
+      }
+    });
+  }
+
+  // Number of refreshes deferred and of refreshes run when closing batches, for testing
+  static unsigned refreshesDeferred();
+  static unsigned refreshesRun();
+
+ private:
+  static void refreshDeferred();
+
+  static int s_depth;
+
+  // in the order the widgets were first deferred, widgets deleted during the batch are skipped
+  static std::vector<std::pair<QPointer<QObject>, std::function<void()>>> s_deferred;
+  static std::map<QObject*, size_t> s_deferredIndex;
+
+  static unsigned s_refreshesDeferred;
+  static unsigned s_refreshesRun;
+};
+
+}  // namespace openstudio
+
+#endif  // SHAREDGUICOMPONENTS_MODELOBJECTCHANGEBATCH_HPP
@@ -71,9 +71,530 @@
 #include <set>
 #include <string>
 #include <iterator>
+#include <typeindex>
+#include <unordered_map>
 
 namespace openstudio {
 
+// Makes the widget for a cell, or rebinds t_recycled (a pooled widget made by the same factory, maybe for another concept) to t_mo,
+// resetting the tooltip or click focus its previous concept may have set
+using WidgetMaker = QWidget* (*)(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled,
+                                 OSGridView* t_gridView, OSGridController* t_gridController);
+
+struct WidgetFactory
+{
+  bool (*matches)(const QSharedPointer<BaseConcept>& t_baseConcept);
+  WidgetMaker make;
+  // unbinds a widget going back to the pool, nullptr if this kind of widget isn't recycled
+  void (*release)(QWidget* t_widget);
+  // units the widget is constructed with, nullptr if it can be rebound to any concept of the factory
+  std::string (*units)(const QSharedPointer<BaseConcept>& t_baseConcept) = nullptr;
+};
+
+namespace {
+
+template <typename ConceptType>
+bool isConcept(const QSharedPointer<BaseConcept>& t_baseConcept) {
+  return !t_baseConcept.dynamicCast<ConceptType>().isNull();
+}
+
+template <typename ConceptType>
+std::string quantityUnits(const QSharedPointer<BaseConcept>& t_baseConcept) {
+  auto quantityConcept = t_baseConcept.staticCast<ConceptType>();
+  return (quantityConcept->modelUnits() + ";" + quantityConcept->siUnits() + ";" + quantityConcept->ipUnits()).toStdString();
+}
+
+template <typename WidgetType>
+void releaseWidget(QWidget* t_widget) {
+  auto widget = static_cast<WidgetType*>(t_widget);
+  widget->unbind();
+  widget->clearFocus();
+  // a new widget starts out unlocked, the object selector locks it again if needed
+  widget->setLocked(false);
+}
+
+QWidget* makeCheckBox(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                      OSGridController*) {
+  auto checkBoxConcept = t_baseConcept.staticCast<CheckBoxConcept>();
+
+  // This is basically for a row in the "Select All" column
+  // OSCheckBox3 is derived from QCheckBox, whereas OSCheckBox2 is derived from QPushButton
+  auto checkBox = t_recycled ? static_cast<OSCheckBox3*>(t_recycled) : new OSCheckBox3(nullptr);
+  if (checkBoxConcept->tooltip().size()) {
+    checkBox->setToolTip(checkBoxConcept->tooltip().c_str());
+  } else if (t_recycled) {
+    checkBox->setToolTip(QString());
+  }
+
+  checkBox->bind(t_mo, BoolGetter(std::bind(&CheckBoxConcept::get, checkBoxConcept.data(), t_mo)),
+                 boost::optional<BoolSetter>(std::bind(&CheckBoxConcept::set, checkBoxConcept.data(), t_mo, std::placeholders::_1)));
+
+  return checkBox;
+}
+
+QWidget* makeCheckBoxBoolReturn(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                                OSGridController*) {
+  auto checkBoxConceptBoolReturn = t_baseConcept.staticCast<CheckBoxConceptBoolReturn>();
+
+  // This is for a proper setter **that returns a bool**, such as Ideal Air Loads column
+  auto checkBoxBoolReturn = t_recycled ? static_cast<OSCheckBox3*>(t_recycled) : new OSCheckBox3(nullptr);
+  if (checkBoxConceptBoolReturn->tooltip().size()) {
+    checkBoxBoolReturn->setToolTip(checkBoxConceptBoolReturn->tooltip().c_str());
+  } else if (t_recycled) {
+    checkBoxBoolReturn->setToolTip(QString());
+  }
+
+  if (checkBoxConceptBoolReturn->hasClickFocus()) {
+    checkBoxBoolReturn->enableClickFocus();
+  } else if (t_recycled) {
+    checkBoxBoolReturn->disableClickFocus();
+  }
+
+  checkBoxBoolReturn->bind(t_mo, BoolGetter(std::bind(&CheckBoxConceptBoolReturn::get, checkBoxConceptBoolReturn.data(), t_mo)),
+                           boost::optional<BoolSetterBoolReturn>(
+                             std::bind(&CheckBoxConceptBoolReturn::set, checkBoxConceptBoolReturn.data(), t_mo, std::placeholders::_1)));
+
+  return checkBoxBoolReturn;
+}
+
+QWidget* makeComboBox(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget*, OSGridView*, OSGridController*) {
+  auto comboBoxConcept = t_baseConcept.staticCast<ComboBoxConcept>();
+
+  auto choiceConcept = comboBoxConcept->choiceConcept(t_mo);
+
+  auto comboBox = new OSComboBox2(nullptr, choiceConcept->editable());
+  if (comboBoxConcept->hasClickFocus()) {
+    comboBox->enableClickFocus();
+  }
+
+  comboBox->bind(t_mo, choiceConcept);
+
+  return comboBox;
+}
+
+QWidget* makeDoubleEdit(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                        OSGridController*) {
+  auto doubleEditConcept = t_baseConcept.staticCast<ValueEditConcept<double>>();
+
+  auto doubleEdit = t_recycled ? static_cast<OSDoubleEdit2*>(t_recycled) : new OSDoubleEdit2(nullptr);
+  if (doubleEditConcept->hasClickFocus()) {
+    doubleEdit->enableClickFocus();
+  } else if (t_recycled) {
+    doubleEdit->disableClickFocus();
+  }
+
+  doubleEdit->bind(t_mo, DoubleGetter(std::bind(&ValueEditConcept<double>::get, doubleEditConcept.data(), t_mo)),
+                   boost::optional<DoubleSetter>(std::bind(&ValueEditConcept<double>::set, doubleEditConcept.data(), t_mo, std::placeholders::_1)),
+                   boost::optional<NoFailAction>(std::bind(&ValueEditConcept<double>::reset, doubleEditConcept.data(), t_mo)),
+                   boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
+                   boost::optional<BasicQuery>(std::bind(&ValueEditConcept<double>::isDefaulted, doubleEditConcept.data(), t_mo)));
+
+  return doubleEdit;
+}
+
+QWidget* makeOptionalDoubleEdit(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                                OSGridController*) {
+  auto optionalDoubleEditConcept = t_baseConcept.staticCast<OptionalValueEditConcept<double>>();
+
+  auto optionalDoubleEdit = t_recycled ? static_cast<OSDoubleEdit2*>(t_recycled) : new OSDoubleEdit2(nullptr);
+  if (optionalDoubleEditConcept->hasClickFocus()) {
+    optionalDoubleEdit->enableClickFocus();
+  } else if (t_recycled) {
+    optionalDoubleEdit->disableClickFocus();
+  }
+
+  optionalDoubleEdit->bind(t_mo, OptionalDoubleGetter(std::bind(&OptionalValueEditConcept<double>::get, optionalDoubleEditConcept.data(), t_mo)),
+                           boost::optional<DoubleSetter>(
+                             std::bind(&OptionalValueEditConcept<double>::set, optionalDoubleEditConcept.data(), t_mo, std::placeholders::_1)));
+
+  return optionalDoubleEdit;
+}
+
+QWidget* makeDoubleEditVoidReturn(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                                  OSGridController*) {
+  auto doubleEditVoidReturnConcept = t_baseConcept.staticCast<ValueEditVoidReturnConcept<double>>();
+
+  auto doubleEditVoidReturn = t_recycled ? static_cast<OSDoubleEdit2*>(t_recycled) : new OSDoubleEdit2(nullptr);
+  if (doubleEditVoidReturnConcept->hasClickFocus()) {
+    doubleEditVoidReturn->enableClickFocus();
+  } else if (t_recycled) {
+    doubleEditVoidReturn->disableClickFocus();
+  }
+
+  doubleEditVoidReturn->bind(
+    t_mo, DoubleGetter(std::bind(&ValueEditVoidReturnConcept<double>::get, doubleEditVoidReturnConcept.data(), t_mo)),
+    DoubleSetterVoidReturn(std::bind(&ValueEditVoidReturnConcept<double>::set, doubleEditVoidReturnConcept.data(), t_mo, std::placeholders::_1)),
+    boost::optional<NoFailAction>(std::bind(&ValueEditVoidReturnConcept<double>::reset, doubleEditVoidReturnConcept.data(), t_mo)),
+    boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
+    boost::optional<BasicQuery>(std::bind(&ValueEditVoidReturnConcept<double>::isDefaulted, doubleEditVoidReturnConcept.data(), t_mo)));
+
+  return doubleEditVoidReturn;
+}
+
+QWidget* makeOptionalDoubleEditVoidReturn(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled,
+                                          OSGridView*, OSGridController*) {
+  auto optionalDoubleEditVoidReturnConcept = t_baseConcept.staticCast<OptionalValueEditVoidReturnConcept<double>>();
+
+  auto optionalDoubleEditVoidReturn = t_recycled ? static_cast<OSDoubleEdit2*>(t_recycled) : new OSDoubleEdit2(nullptr);
+  if (optionalDoubleEditVoidReturnConcept->hasClickFocus()) {
+    optionalDoubleEditVoidReturn->enableClickFocus();
+  } else if (t_recycled) {
+    optionalDoubleEditVoidReturn->disableClickFocus();
+  }
+
+  optionalDoubleEditVoidReturn->bind(
+    t_mo, OptionalDoubleGetter(std::bind(&OptionalValueEditVoidReturnConcept<double>::get, optionalDoubleEditVoidReturnConcept.data(), t_mo)),
+    DoubleSetterVoidReturn(
+      std::bind(&OptionalValueEditVoidReturnConcept<double>::set, optionalDoubleEditVoidReturnConcept.data(), t_mo, std::placeholders::_1)));
+
+  return optionalDoubleEditVoidReturn;
+}
+
+QWidget* makeIntegerEdit(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                         OSGridController*) {
+  auto integerEditConcept = t_baseConcept.staticCast<ValueEditConcept<int>>();
+
+  auto integerEdit = t_recycled ? static_cast<OSIntegerEdit2*>(t_recycled) : new OSIntegerEdit2(nullptr);
+  if (integerEditConcept->hasClickFocus()) {
+    integerEdit->enableClickFocus();
+  } else if (t_recycled) {
+    integerEdit->disableClickFocus();
+  }
+
+  integerEdit->bind(t_mo, IntGetter(std::bind(&ValueEditConcept<int>::get, integerEditConcept.data(), t_mo)),
+                    boost::optional<IntSetter>(std::bind(&ValueEditConcept<int>::set, integerEditConcept.data(), t_mo, std::placeholders::_1)),
+                    boost::optional<NoFailAction>(std::bind(&ValueEditConcept<int>::reset, integerEditConcept.data(), t_mo)),
+                    boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
+                    boost::optional<BasicQuery>(std::bind(&ValueEditConcept<int>::isDefaulted, integerEditConcept.data(), t_mo)));
+
+  return integerEdit;
+}
+
+QWidget* makeLineEdit(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget*, OSGridView*, OSGridController*) {
+  auto lineEditConcept = t_baseConcept.staticCast<ValueEditConcept<std::string>>();
+
+  auto lineEdit = new OSLineEdit2(nullptr);
+  if (lineEditConcept->hasClickFocus()) {
+    lineEdit->enableClickFocus();
+  }
+
+  lineEdit->bind(t_mo, StringGetter(std::bind(&ValueEditConcept<std::string>::get, lineEditConcept.data(), t_mo)),
+                 boost::optional<StringSetter>(std::bind(&ValueEditConcept<std::string>::set, lineEditConcept.data(), t_mo, std::placeholders::_1)),
+                 boost::optional<NoFailAction>(std::bind(&ValueEditConcept<std::string>::reset, lineEditConcept.data(), t_mo)),
+                 boost::optional<BasicQuery>(std::bind(&ValueEditConcept<std::string>::isDefaulted, lineEditConcept.data(), t_mo)));
+
+  return lineEdit;
+}
+
+QWidget* makeLineEditVoidReturn(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget*, OSGridView*,
+                                OSGridController*) {
+  auto lineEditConcept = t_baseConcept.staticCast<ValueEditVoidReturnConcept<std::string>>();
+
+  auto lineEdit = new OSLineEdit2(nullptr);
+  if (lineEditConcept->hasClickFocus()) {
+    lineEdit->enableClickFocus();
+  }
+
+  lineEdit->bind(t_mo, StringGetter(std::bind(&ValueEditVoidReturnConcept<std::string>::get, lineEditConcept.data(), t_mo)),
+                 boost::optional<StringSetterVoidReturn>(
+                   std::bind(&ValueEditVoidReturnConcept<std::string>::set, lineEditConcept.data(), t_mo, std::placeholders::_1)),
+                 boost::optional<NoFailAction>(std::bind(&ValueEditVoidReturnConcept<std::string>::reset, lineEditConcept.data(), t_mo)),
+                 boost::optional<BasicQuery>(std::bind(&ValueEditVoidReturnConcept<std::string>::isDefaulted, lineEditConcept.data(), t_mo)));
+
+  return lineEdit;
+}
+
+QWidget* makeNameLineEdit(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget*, OSGridView* t_gridView,
+                          OSGridController*) {
+  auto nameLineEditConcept = t_baseConcept.staticCast<NameLineEditConcept>();
+
+  OSLineEdit2Interface* nameLineEdit = nameLineEditConcept->makeWidget(nullptr);
+  if (nameLineEditConcept->hasClickFocus()) {
+    nameLineEdit->enableClickFocus();
+  }
+
+  nameLineEdit->bind(
+    t_mo, OptionalStringGetter(std::bind(&NameLineEditConcept::get, nameLineEditConcept.data(), t_mo, true)),
+    boost::optional<StringSetter>(std::bind(&NameLineEditConcept::setReturnBool, nameLineEditConcept.data(), t_mo, std::placeholders::_1)),
+    boost::optional<NoFailAction>(std::bind(&NameLineEditConcept::reset, nameLineEditConcept.data(), t_mo)),
+    boost::optional<BasicQuery>(std::bind(&NameLineEditConcept::isInherited, nameLineEditConcept.data(), t_mo)));
+
+  QWidget* widget = nameLineEdit->qwidget();
+
+  if (nameLineEditConcept->isInspectable()) {
+    if (OSLineEdit2* normalLineEdit = qobject_cast<OSLineEdit2*>(widget)) {
+      QObject::connect(normalLineEdit, &OSLineEdit2::itemClicked, t_gridView, &OSGridView::dropZoneItemClicked);
+    } else if (OSLoadNamePixmapLineEdit* pixmapLineEdit = qobject_cast<OSLoadNamePixmapLineEdit*>(widget)) {
+      QObject::connect(pixmapLineEdit, &OSLoadNamePixmapLineEdit::itemClicked, t_gridView, &OSGridView::dropZoneItemClicked);
+    }
+  }
+
+  if (nameLineEditConcept->isLocked()) {
+    nameLineEdit->setLocked(true);
+  }
+
+  return widget;
+}
+
+QWidget* makeQuantityEdit(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                          OSGridController* t_gridController) {
+  auto quantityEditConcept = t_baseConcept.staticCast<QuantityEditConcept<double>>();
+
+  OSQuantityEdit2* quantityEdit = static_cast<OSQuantityEdit2*>(t_recycled);
+  if (!quantityEdit) {
+    quantityEdit =
+      new OSQuantityEdit2(quantityEditConcept->modelUnits().toStdString().c_str(), quantityEditConcept->siUnits().toStdString().c_str(),
+                          quantityEditConcept->ipUnits().toStdString().c_str(), quantityEditConcept->isIP(), nullptr);
+    QObject::connect(t_gridController, &OSGridController::toggleUnitsClicked, quantityEdit, &OSQuantityEdit2::onUnitSystemChange);
+  }
+  if (quantityEditConcept->hasClickFocus()) {
+    quantityEdit->enableClickFocus();
+  } else if (t_recycled) {
+    quantityEdit->disableClickFocus();
+  }
+
+  quantityEdit->bind(
+    t_gridController->isIP(), t_mo, DoubleGetter(std::bind(&QuantityEditConcept<double>::get, quantityEditConcept.data(), t_mo)),
+    boost::optional<DoubleSetter>(std::bind(&QuantityEditConcept<double>::set, quantityEditConcept.data(), t_mo, std::placeholders::_1)),
+    boost::optional<NoFailAction>(std::bind(&QuantityEditConcept<double>::reset, quantityEditConcept.data(), t_mo)),
+    boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
+    boost::optional<BasicQuery>(std::bind(&QuantityEditConcept<double>::isDefaulted, quantityEditConcept.data(), t_mo)));
+
+  return quantityEdit;
+}
+
+QWidget* makeOptionalQuantityEdit(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                                  OSGridController* t_gridController) {
+  auto optionalQuantityEditConcept = t_baseConcept.staticCast<OptionalQuantityEditConcept<double>>();
+
+  OSQuantityEdit2* optionalQuantityEdit = static_cast<OSQuantityEdit2*>(t_recycled);
+  if (!optionalQuantityEdit) {
+    optionalQuantityEdit = new OSQuantityEdit2(
+      optionalQuantityEditConcept->modelUnits().toStdString().c_str(), optionalQuantityEditConcept->siUnits().toStdString().c_str(),
+      optionalQuantityEditConcept->ipUnits().toStdString().c_str(), optionalQuantityEditConcept->isIP(), nullptr);
+    QObject::connect(t_gridController, &OSGridController::toggleUnitsClicked, optionalQuantityEdit, &OSQuantityEdit2::onUnitSystemChange);
+  }
+  if (optionalQuantityEditConcept->hasClickFocus()) {
+    optionalQuantityEdit->enableClickFocus();
+  } else if (t_recycled) {
+    optionalQuantityEdit->disableClickFocus();
+  }
+
+  optionalQuantityEdit->bind(t_gridController->isIP(), t_mo,
+                             OptionalDoubleGetter(std::bind(&OptionalQuantityEditConcept<double>::get, optionalQuantityEditConcept.data(), t_mo)),
+                             boost::optional<DoubleSetter>(
+                               std::bind(&OptionalQuantityEditConcept<double>::set, optionalQuantityEditConcept.data(), t_mo, std::placeholders::_1)));
+
+  return optionalQuantityEdit;
+}
+
+QWidget* makeQuantityEditVoidReturn(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                                    OSGridController* t_gridController) {
+  auto quantityEditVoidReturnConcept = t_baseConcept.staticCast<QuantityEditVoidReturnConcept<double>>();
+
+  OSQuantityEdit2* quantityEditVoidReturn = static_cast<OSQuantityEdit2*>(t_recycled);
+  if (!quantityEditVoidReturn) {
+    quantityEditVoidReturn = new OSQuantityEdit2(
+      quantityEditVoidReturnConcept->modelUnits().toStdString().c_str(), quantityEditVoidReturnConcept->siUnits().toStdString().c_str(),
+      quantityEditVoidReturnConcept->ipUnits().toStdString().c_str(), quantityEditVoidReturnConcept->isIP(), nullptr);
+    QObject::connect(t_gridController, &OSGridController::toggleUnitsClicked, quantityEditVoidReturn, &OSQuantityEdit2::onUnitSystemChange);
+  }
+  if (quantityEditVoidReturnConcept->hasClickFocus()) {
+    quantityEditVoidReturn->enableClickFocus();
+  } else if (t_recycled) {
+    quantityEditVoidReturn->disableClickFocus();
+  }
+
+  quantityEditVoidReturn->bind(
+    t_gridController->isIP(), t_mo, DoubleGetter(std::bind(&QuantityEditVoidReturnConcept<double>::get, quantityEditVoidReturnConcept.data(), t_mo)),
+    DoubleSetterVoidReturn(std::bind(&QuantityEditVoidReturnConcept<double>::set, quantityEditVoidReturnConcept.data(), t_mo, std::placeholders::_1)),
+    boost::optional<NoFailAction>(std::bind(&QuantityEditVoidReturnConcept<double>::reset, quantityEditVoidReturnConcept.data(), t_mo)),
+    boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
+    boost::optional<BasicQuery>(std::bind(&QuantityEditVoidReturnConcept<double>::isDefaulted, quantityEditVoidReturnConcept.data(), t_mo)));
+
+  return quantityEditVoidReturn;
+}
+
+QWidget* makeOptionalQuantityEditVoidReturn(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled,
+                                            OSGridView*, OSGridController* t_gridController) {
+  auto optionalQuantityEditVoidReturnConcept = t_baseConcept.staticCast<OptionalQuantityEditVoidReturnConcept<double>>();
+
+  OSQuantityEdit2* optionalQuantityEditVoidReturn = static_cast<OSQuantityEdit2*>(t_recycled);
+  if (!optionalQuantityEditVoidReturn) {
+    optionalQuantityEditVoidReturn = new OSQuantityEdit2(optionalQuantityEditVoidReturnConcept->modelUnits().toStdString().c_str(),
+                                                         optionalQuantityEditVoidReturnConcept->siUnits().toStdString().c_str(),
+                                                         optionalQuantityEditVoidReturnConcept->ipUnits().toStdString().c_str(),
+                                                         optionalQuantityEditVoidReturnConcept->isIP(), nullptr);
+    QObject::connect(t_gridController, &OSGridController::toggleUnitsClicked, optionalQuantityEditVoidReturn,
+                     &OSQuantityEdit2::onUnitSystemChange);
+  }
+  if (optionalQuantityEditVoidReturnConcept->hasClickFocus()) {
+    optionalQuantityEditVoidReturn->enableClickFocus();
+  } else if (t_recycled) {
+    optionalQuantityEditVoidReturn->disableClickFocus();
+  }
+
+  optionalQuantityEditVoidReturn->bind(
+    t_gridController->isIP(), t_mo,
+    OptionalDoubleGetter(std::bind(&OptionalQuantityEditVoidReturnConcept<double>::get, optionalQuantityEditVoidReturnConcept.data(), t_mo)),
+    DoubleSetterVoidReturn(
+      std::bind(&OptionalQuantityEditVoidReturnConcept<double>::set, optionalQuantityEditVoidReturnConcept.data(), t_mo, std::placeholders::_1)));
+
+  return optionalQuantityEditVoidReturn;
+}
+
+QWidget* makeUnsignedEdit(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* t_recycled, OSGridView*,
+                          OSGridController*) {
+  auto unsignedEditConcept = t_baseConcept.staticCast<ValueEditConcept<unsigned>>();
+
+  auto unsignedEdit = t_recycled ? static_cast<OSUnsignedEdit2*>(t_recycled) : new OSUnsignedEdit2(nullptr);
+  if (unsignedEditConcept->hasClickFocus()) {
+    unsignedEdit->enableClickFocus();
+  } else if (t_recycled) {
+    unsignedEdit->disableClickFocus();
+  }
+
+  unsignedEdit->bind(
+    t_mo, UnsignedGetter(std::bind(&ValueEditConcept<unsigned>::get, unsignedEditConcept.data(), t_mo)),
+    boost::optional<UnsignedSetter>(std::bind(&ValueEditConcept<unsigned>::set, unsignedEditConcept.data(), t_mo, std::placeholders::_1)),
+    boost::optional<NoFailAction>(std::bind(&ValueEditConcept<unsigned>::reset, unsignedEditConcept.data(), t_mo)), boost::optional<NoFailAction>(),
+    boost::optional<NoFailAction>(), boost::optional<BasicQuery>(std::bind(&ValueEditConcept<unsigned>::isDefaulted, unsignedEditConcept.data(), t_mo)));
+
+  return unsignedEdit;
+}
+
+QWidget* makeDropZone(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget*, OSGridView* t_gridView,
+                      OSGridController*) {
+  auto dropZoneConcept = t_baseConcept.staticCast<DropZoneConcept>();
+
+  auto dropZone = new OSDropZone2();
+  if (dropZoneConcept->hasClickFocus()) {
+    dropZone->enableClickFocus();
+  }
+
+  dropZone->bind(t_mo, OptionalModelObjectGetter(std::bind(&DropZoneConcept::get, dropZoneConcept.data(), t_mo)),
+                 ModelObjectSetter(std::bind(&DropZoneConcept::set, dropZoneConcept.data(), t_mo, std::placeholders::_1)),
+                 NoFailAction(std::bind(&DropZoneConcept::reset, dropZoneConcept.data(), t_mo)),
+                 ModelObjectIsDefaulted(std::bind(&DropZoneConcept::isDefaulted, dropZoneConcept.data(), t_mo)),
+                 OtherModelObjects(std::bind(&DropZoneConcept::otherObjects, dropZoneConcept.data(), t_mo)));
+
+  QObject::connect(dropZone, &OSDropZone2::itemClicked, t_gridView, &OSGridView::dropZoneItemClicked);
+
+  return dropZone;
+}
+
+QWidget* makeRenderingColorWidget(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept, QWidget*, OSGridView*,
+                                  OSGridController*) {
+  auto renderingColorConcept = t_baseConcept.staticCast<RenderingColorConcept>();
+
+  auto renderingColorWidget = new RenderingColorWidget2(nullptr);
+
+  renderingColorWidget->bind(t_mo, OptionalModelObjectGetter(std::bind(&RenderingColorConcept::get, renderingColorConcept.data(), t_mo)),
+                             ModelObjectSetter(std::bind(&RenderingColorConcept::set, renderingColorConcept.data(), t_mo, std::placeholders::_1)));
+
+  return renderingColorWidget;
+}
+
+// Checked in this order the first time a concept type is seen, same order as the cast chain this replaces
+const std::vector<WidgetFactory>& widgetFactories() {
+  static const std::vector<WidgetFactory> factories{
+    {&isConcept<CheckBoxConcept>, &makeCheckBox, &releaseWidget<OSCheckBox3>},
+    {&isConcept<CheckBoxConceptBoolReturn>, &makeCheckBoxBoolReturn, &releaseWidget<OSCheckBox3>},
+    {&isConcept<ComboBoxConcept>, &makeComboBox, nullptr},
+    {&isConcept<ValueEditConcept<double>>, &makeDoubleEdit, &releaseWidget<OSDoubleEdit2>},
+    {&isConcept<OptionalValueEditConcept<double>>, &makeOptionalDoubleEdit, &releaseWidget<OSDoubleEdit2>},
+    {&isConcept<ValueEditVoidReturnConcept<double>>, &makeDoubleEditVoidReturn, &releaseWidget<OSDoubleEdit2>},
+    {&isConcept<OptionalValueEditVoidReturnConcept<double>>, &makeOptionalDoubleEditVoidReturn, &releaseWidget<OSDoubleEdit2>},
+    {&isConcept<ValueEditConcept<int>>, &makeIntegerEdit, &releaseWidget<OSIntegerEdit2>},
+    {&isConcept<ValueEditConcept<std::string>>, &makeLineEdit, nullptr},
+    {&isConcept<ValueEditVoidReturnConcept<std::string>>, &makeLineEditVoidReturn, nullptr},
+    {&isConcept<NameLineEditConcept>, &makeNameLineEdit, nullptr},
+    {&isConcept<QuantityEditConcept<double>>, &makeQuantityEdit, &releaseWidget<OSQuantityEdit2>,
+     &quantityUnits<QuantityEditConcept<double>>},
+    {&isConcept<OptionalQuantityEditConcept<double>>, &makeOptionalQuantityEdit, &releaseWidget<OSQuantityEdit2>,
+     &quantityUnits<OptionalQuantityEditConcept<double>>},
+    {&isConcept<QuantityEditVoidReturnConcept<double>>, &makeQuantityEditVoidReturn, &releaseWidget<OSQuantityEdit2>,
+     &quantityUnits<QuantityEditVoidReturnConcept<double>>},
+    {&isConcept<OptionalQuantityEditVoidReturnConcept<double>>, &makeOptionalQuantityEditVoidReturn, &releaseWidget<OSQuantityEdit2>,
+     &quantityUnits<OptionalQuantityEditVoidReturnConcept<double>>},
+    {&isConcept<ValueEditConcept<unsigned>>, &makeUnsignedEdit, &releaseWidget<OSUnsignedEdit2>},
+    {&isConcept<DropZoneConcept>, &makeDropZone, nullptr},
+    {&isConcept<RenderingColorConcept>, &makeRenderingColorWidget, nullptr},
+  };
+  return factories;
+}
+
+// A column shares one concept, so after its first cell this is a single hash lookup instead of a walk through all the concept types
+const WidgetFactory& widgetFactory(const QSharedPointer<BaseConcept>& t_baseConcept) {
+  static std::unordered_map<std::type_index, const WidgetFactory*> resolved;
+
+  const BaseConcept& baseConcept = *t_baseConcept;
+  std::type_index conceptType(typeid(baseConcept));
+  auto it = resolved.find(conceptType);
+  if (it == resolved.end()) {
+    const WidgetFactory* factory = nullptr;
+    for (const auto& candidate : widgetFactories()) {
+      if (candidate.matches(t_baseConcept)) {
+        factory = &candidate;
+        break;
+      }
+    }
+    // Unknown type
+    OS_ASSERT(factory);
+    it = resolved.emplace(conceptType, factory).first;
+  }
+  return *it->second;
+}
+
+bool widgetPoolingEnabled = true;
+unsigned numWidgetsCreated = 0;
+unsigned numWidgetsReused = 0;
+
+}  // namespace
+
+OSWidgetPool::~OSWidgetPool() {
+  clear();
+}
+
+OSWidgetPool::Key OSWidgetPool::key(const QSharedPointer<BaseConcept>& t_baseConcept) {
+  const WidgetFactory& factory = widgetFactory(t_baseConcept);
+  return Key(&factory, factory.units ? factory.units(t_baseConcept) : std::string());
+}
+
+void OSWidgetPool::add(const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* widget) {
+  m_entries[key(t_baseConcept)].push_back(widget);
+}
+
+QWidget* OSWidgetPool::take(const QSharedPointer<BaseConcept>& t_baseConcept) {
+  auto it = m_entries.find(key(t_baseConcept));
+  if (it == m_entries.end()) {
+    return nullptr;
+  }
+  QWidget* widget = it->second.back();
+  it->second.pop_back();
+  if (it->second.empty()) {
+    m_entries.erase(it);
+  }
+  return widget;
+}
+
+size_t OSWidgetPool::size() const {
+  size_t result = 0;
+  for (const auto& entry : m_entries) {
+    result += entry.second.size();
+  }
+  return result;
+}
+
+void OSWidgetPool::clear() {
+  for (auto& entry : m_entries) {
+    for (QWidget* widget : entry.second) {
+      delete widget;
+    }
+  }
+  m_entries.clear();
+}
+
 OSCellWrapper::OSCellWrapper(OSGridView* gridView, QSharedPointer<BaseConcept> baseConcept, OSObjectSelector* objectSelector, int modelRow,
                              int gridRow, int column)
   : QWidget(gridView),
@@ -98,9 +619,7 @@ OSCellWrapper::OSCellWrapper(OSGridView* gridView, QSharedPointer<BaseConcept> b
   connect(this, &OSCellWrapper::rowNeedsStyle, objectSelector, &OSObjectSelector::onRowNeedsStyle);
 }
 
-OSCellWrapper::~OSCellWrapper() {
-  disconnectModelSignals();
-}
+OSCellWrapper::~OSCellWrapper() {}
 
 void OSCellWrapper::setGridController(OSGridController* gridController) {
   m_gridController = gridController;
@@ -117,6 +636,7 @@ void OSCellWrapper::refresh() {
   OS_ASSERT(m_gridController);
 
   m_holders.clear();
+  m_holderObjects.clear();
 
   m_hasSubRows = false;
   if (QSharedPointer<DataSourceAdapter> dataSource = m_baseConcept.dynamicCast<DataSourceAdapter>()) {
@@ -129,8 +649,9 @@ void OSCellWrapper::refresh() {
     // all the way around.
     auto items = dataSource->source().items(m_modelObject.get());
 
-    if (m_refreshCount == 0) {
-      connectModelSignals();
+    if (m_refreshCount == 0 && m_gridView) {
+      // the grid view tells us about objects added to the model which may be new subrows
+      m_gridView->addSubrowCell(this);
     }
 
     size_t subrowCounter = 0;
@@ -202,317 +723,86 @@ void OSCellWrapper::setCellProperties(const GridCellLocation& location, const Gr
   }
 }
 
-QWidget* OSCellWrapper::createOSWidget(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept) {
-  QWidget* widget = nullptr;
-
-  OS_ASSERT(m_gridController);
-
-  if (QSharedPointer<CheckBoxConcept> checkBoxConcept = t_baseConcept.dynamicCast<CheckBoxConcept>()) {
-
-    // This is basically for a row in the "Select All" column
-    auto checkBox = new OSCheckBox3(nullptr);  // OSCheckBox3 is derived from QCheckBox, whereas OSCheckBox2 is derived from QPushButton
-    if (checkBoxConcept->tooltip().size()) {
-      checkBox->setToolTip(checkBoxConcept->tooltip().c_str());
-    }
-
-    checkBox->bind(t_mo, BoolGetter(std::bind(&CheckBoxConcept::get, checkBoxConcept.data(), t_mo)),
-                   boost::optional<BoolSetter>(std::bind(&CheckBoxConcept::set, checkBoxConcept.data(), t_mo, std::placeholders::_1)));
-
-    widget = checkBox;
-
-  } else if (auto checkBoxConceptBoolReturn = t_baseConcept.dynamicCast<CheckBoxConceptBoolReturn>()) {
-    // This is for a proper setter **that returns a bool**, such as Ideal Air Loads column
-    auto checkBoxBoolReturn = new OSCheckBox3(nullptr);
-    if (checkBoxConceptBoolReturn->tooltip().size()) {
-      checkBoxBoolReturn->setToolTip(checkBoxConceptBoolReturn->tooltip().c_str());
-    }
-
-    if (checkBoxConceptBoolReturn->hasClickFocus()) {
-      checkBoxBoolReturn->enableClickFocus();
-    }
-
-    checkBoxBoolReturn->bind(t_mo, BoolGetter(std::bind(&CheckBoxConceptBoolReturn::get, checkBoxConceptBoolReturn.data(), t_mo)),
-                             boost::optional<BoolSetterBoolReturn>(
-                               std::bind(&CheckBoxConceptBoolReturn::set, checkBoxConceptBoolReturn.data(), t_mo, std::placeholders::_1)));
-
-    widget = checkBoxBoolReturn;
-
-  } else if (QSharedPointer<ComboBoxConcept> comboBoxConcept = t_baseConcept.dynamicCast<ComboBoxConcept>()) {
-
-    auto choiceConcept = comboBoxConcept->choiceConcept(t_mo);
-
-    auto comboBox = new OSComboBox2(nullptr, choiceConcept->editable());
-    if (comboBoxConcept->hasClickFocus()) {
-      comboBox->enableClickFocus();
-    }
-
-    comboBox->bind(t_mo, choiceConcept);
-
-    widget = comboBox;
-
-  } else if (QSharedPointer<ValueEditConcept<double>> doubleEditConcept = t_baseConcept.dynamicCast<ValueEditConcept<double>>()) {
-
-    auto doubleEdit = new OSDoubleEdit2(nullptr);
-    if (doubleEditConcept->hasClickFocus()) {
-      doubleEdit->enableClickFocus();
-    }
-
-    doubleEdit->bind(t_mo, DoubleGetter(std::bind(&ValueEditConcept<double>::get, doubleEditConcept.data(), t_mo)),
-                     boost::optional<DoubleSetter>(std::bind(&ValueEditConcept<double>::set, doubleEditConcept.data(), t_mo, std::placeholders::_1)),
-                     boost::optional<NoFailAction>(std::bind(&ValueEditConcept<double>::reset, doubleEditConcept.data(), t_mo)),
-                     boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
-                     boost::optional<BasicQuery>(std::bind(&ValueEditConcept<double>::isDefaulted, doubleEditConcept.data(), t_mo)));
-
-    widget = doubleEdit;
-
-  } else if (QSharedPointer<OptionalValueEditConcept<double>> optionalDoubleEditConcept =
-               t_baseConcept.dynamicCast<OptionalValueEditConcept<double>>()) {
-
-    auto optionalDoubleEdit = new OSDoubleEdit2(nullptr);
-    if (optionalDoubleEditConcept->hasClickFocus()) {
-      optionalDoubleEdit->enableClickFocus();
-    }
-
-    optionalDoubleEdit->bind(t_mo, OptionalDoubleGetter(std::bind(&OptionalValueEditConcept<double>::get, optionalDoubleEditConcept.data(), t_mo)),
-                             boost::optional<DoubleSetter>(
-                               std::bind(&OptionalValueEditConcept<double>::set, optionalDoubleEditConcept.data(), t_mo, std::placeholders::_1)));
-
-    widget = optionalDoubleEdit;
-
-  } else if (QSharedPointer<ValueEditVoidReturnConcept<double>> doubleEditVoidReturnConcept =
-               t_baseConcept.dynamicCast<ValueEditVoidReturnConcept<double>>()) {
-
-    auto doubleEditVoidReturn = new OSDoubleEdit2(nullptr);
-    if (doubleEditVoidReturnConcept->hasClickFocus()) {
-      doubleEditVoidReturn->enableClickFocus();
-    }
-
-    doubleEditVoidReturn->bind(
-      t_mo, DoubleGetter(std::bind(&ValueEditVoidReturnConcept<double>::get, doubleEditVoidReturnConcept.data(), t_mo)),
-      DoubleSetterVoidReturn(std::bind(&ValueEditVoidReturnConcept<double>::set, doubleEditVoidReturnConcept.data(), t_mo, std::placeholders::_1)),
-      boost::optional<NoFailAction>(std::bind(&ValueEditVoidReturnConcept<double>::reset, doubleEditVoidReturnConcept.data(), t_mo)),
-      boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
-      boost::optional<BasicQuery>(std::bind(&ValueEditVoidReturnConcept<double>::isDefaulted, doubleEditVoidReturnConcept.data(), t_mo)));
-
-    widget = doubleEditVoidReturn;
-
-  } else if (QSharedPointer<OptionalValueEditVoidReturnConcept<double>> optionalDoubleEditVoidReturnConcept =
-               t_baseConcept.dynamicCast<OptionalValueEditVoidReturnConcept<double>>()) {
-
-    auto optionalDoubleEditVoidReturn = new OSDoubleEdit2(nullptr);
-    if (optionalDoubleEditVoidReturnConcept->hasClickFocus()) {
-      optionalDoubleEditVoidReturn->enableClickFocus();
-    }
-
-    optionalDoubleEditVoidReturn->bind(
-      t_mo, OptionalDoubleGetter(std::bind(&OptionalValueEditVoidReturnConcept<double>::get, optionalDoubleEditVoidReturnConcept.data(), t_mo)),
-      DoubleSetterVoidReturn(
-        std::bind(&OptionalValueEditVoidReturnConcept<double>::set, optionalDoubleEditVoidReturnConcept.data(), t_mo, std::placeholders::_1)));
-
-    widget = optionalDoubleEditVoidReturn;
-
-  } else if (QSharedPointer<ValueEditConcept<int>> integerEditConcept = t_baseConcept.dynamicCast<ValueEditConcept<int>>()) {
-
-    auto integerEdit = new OSIntegerEdit2(nullptr);
-    if (integerEditConcept->hasClickFocus()) {
-      integerEdit->enableClickFocus();
-    }
-
-    integerEdit->bind(t_mo, IntGetter(std::bind(&ValueEditConcept<int>::get, integerEditConcept.data(), t_mo)),
-                      boost::optional<IntSetter>(std::bind(&ValueEditConcept<int>::set, integerEditConcept.data(), t_mo, std::placeholders::_1)),
-                      boost::optional<NoFailAction>(std::bind(&ValueEditConcept<int>::reset, integerEditConcept.data(), t_mo)),
-                      boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
-                      boost::optional<BasicQuery>(std::bind(&ValueEditConcept<int>::isDefaulted, integerEditConcept.data(), t_mo)));
-
-    widget = integerEdit;
-
-  } else if (QSharedPointer<ValueEditConcept<std::string>> lineEditConcept = t_baseConcept.dynamicCast<ValueEditConcept<std::string>>()) {
-
-    auto lineEdit = new OSLineEdit2(nullptr);
-    if (lineEditConcept->hasClickFocus()) {
-      lineEdit->enableClickFocus();
-    }
-
-    lineEdit->bind(t_mo, StringGetter(std::bind(&ValueEditConcept<std::string>::get, lineEditConcept.data(), t_mo)),
-                   boost::optional<StringSetter>(std::bind(&ValueEditConcept<std::string>::set, lineEditConcept.data(), t_mo, std::placeholders::_1)),
-                   boost::optional<NoFailAction>(std::bind(&ValueEditConcept<std::string>::reset, lineEditConcept.data(), t_mo)),
-                   boost::optional<BasicQuery>(std::bind(&ValueEditConcept<std::string>::isDefaulted, lineEditConcept.data(), t_mo)));
-
-    widget = lineEdit;
-
-  } else if (QSharedPointer<ValueEditVoidReturnConcept<std::string>> lineEditConcept =
-               t_baseConcept.dynamicCast<ValueEditVoidReturnConcept<std::string>>()) {
-
-    auto lineEdit = new OSLineEdit2(nullptr);
-    if (lineEditConcept->hasClickFocus()) {
-      lineEdit->enableClickFocus();
-    }
-
-    lineEdit->bind(t_mo, StringGetter(std::bind(&ValueEditVoidReturnConcept<std::string>::get, lineEditConcept.data(), t_mo)),
-                   boost::optional<StringSetterVoidReturn>(
-                     std::bind(&ValueEditVoidReturnConcept<std::string>::set, lineEditConcept.data(), t_mo, std::placeholders::_1)),
-                   boost::optional<NoFailAction>(std::bind(&ValueEditVoidReturnConcept<std::string>::reset, lineEditConcept.data(), t_mo)),
-                   boost::optional<BasicQuery>(std::bind(&ValueEditVoidReturnConcept<std::string>::isDefaulted, lineEditConcept.data(), t_mo)));
-
-    widget = lineEdit;
-
-  } else if (QSharedPointer<NameLineEditConcept> nameLineEditConcept = t_baseConcept.dynamicCast<NameLineEditConcept>()) {
-
-    OSLineEdit2Interface* nameLineEdit = nameLineEditConcept->makeWidget(nullptr);
-    if (nameLineEditConcept->hasClickFocus()) {
-      nameLineEdit->enableClickFocus();
-    }
-
-    nameLineEdit->bind(
-      t_mo, OptionalStringGetter(std::bind(&NameLineEditConcept::get, nameLineEditConcept.data(), t_mo, true)),
-      boost::optional<StringSetter>(std::bind(&NameLineEditConcept::setReturnBool, nameLineEditConcept.data(), t_mo, std::placeholders::_1)),
-      boost::optional<NoFailAction>(std::bind(&NameLineEditConcept::reset, nameLineEditConcept.data(), t_mo)),
-      boost::optional<BasicQuery>(std::bind(&NameLineEditConcept::isInherited, nameLineEditConcept.data(), t_mo)));
-
-    widget = nameLineEdit->qwidget();
-
-    if (nameLineEditConcept->isInspectable()) {
-      if (OSLineEdit2* normalLineEdit = qobject_cast<OSLineEdit2*>(widget)) {
-        connect(normalLineEdit, &OSLineEdit2::itemClicked, m_gridView, &OSGridView::dropZoneItemClicked);
-      } else if (OSLoadNamePixmapLineEdit* pixmapLineEdit = qobject_cast<OSLoadNamePixmapLineEdit*>(widget)) {
-        connect(pixmapLineEdit, &OSLoadNamePixmapLineEdit::itemClicked, m_gridView, &OSGridView::dropZoneItemClicked);
-      }
-    }
-
-    if (nameLineEditConcept->isLocked()) {
-      nameLineEdit->setLocked(true);
-    }
-
-  } else if (QSharedPointer<QuantityEditConcept<double>> quantityEditConcept = t_baseConcept.dynamicCast<QuantityEditConcept<double>>()) {
-
-    OSQuantityEdit2* quantityEdit =
-      new OSQuantityEdit2(quantityEditConcept->modelUnits().toStdString().c_str(), quantityEditConcept->siUnits().toStdString().c_str(),
-                          quantityEditConcept->ipUnits().toStdString().c_str(), quantityEditConcept->isIP(), nullptr);
-    if (quantityEditConcept->hasClickFocus()) {
-      quantityEdit->enableClickFocus();
-    }
-
-    quantityEdit->bind(
-      m_gridController->isIP(), t_mo, DoubleGetter(std::bind(&QuantityEditConcept<double>::get, quantityEditConcept.data(), t_mo)),
-      boost::optional<DoubleSetter>(std::bind(&QuantityEditConcept<double>::set, quantityEditConcept.data(), t_mo, std::placeholders::_1)),
-      boost::optional<NoFailAction>(std::bind(&QuantityEditConcept<double>::reset, quantityEditConcept.data(), t_mo)),
-      boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
-      boost::optional<BasicQuery>(std::bind(&QuantityEditConcept<double>::isDefaulted, quantityEditConcept.data(), t_mo)));
-
-    connect(m_gridController, &OSGridController::toggleUnitsClicked, quantityEdit, &OSQuantityEdit2::onUnitSystemChange);
-
-    widget = quantityEdit;
-
-  } else if (QSharedPointer<OptionalQuantityEditConcept<double>> optionalQuantityEditConcept =
-               t_baseConcept.dynamicCast<OptionalQuantityEditConcept<double>>()) {
-
-    OSQuantityEdit2* optionalQuantityEdit = new OSQuantityEdit2(
-      optionalQuantityEditConcept->modelUnits().toStdString().c_str(), optionalQuantityEditConcept->siUnits().toStdString().c_str(),
-      optionalQuantityEditConcept->ipUnits().toStdString().c_str(), optionalQuantityEditConcept->isIP(), nullptr);
-    if (optionalQuantityEditConcept->hasClickFocus()) {
-      optionalQuantityEdit->enableClickFocus();
-    }
-
-    optionalQuantityEdit->bind(m_gridController->isIP(), t_mo,
-                               OptionalDoubleGetter(std::bind(&OptionalQuantityEditConcept<double>::get, optionalQuantityEditConcept.data(), t_mo)),
-                               boost::optional<DoubleSetter>(std::bind(&OptionalQuantityEditConcept<double>::set, optionalQuantityEditConcept.data(),
-                                                                       t_mo, std::placeholders::_1)));
-
-    connect(m_gridController, &OSGridController::toggleUnitsClicked, optionalQuantityEdit, &OSQuantityEdit2::onUnitSystemChange);
-
-    widget = optionalQuantityEdit;
-
-  } else if (QSharedPointer<QuantityEditVoidReturnConcept<double>> quantityEditVoidReturnConcept =
-               t_baseConcept.dynamicCast<QuantityEditVoidReturnConcept<double>>()) {
+QSharedPointer<BaseConcept> OSCellWrapper::baseConcept() const {
+  return m_baseConcept;
+}
 
-    OSQuantityEdit2* quantityEditVoidReturn = new OSQuantityEdit2(
-      quantityEditVoidReturnConcept->modelUnits().toStdString().c_str(), quantityEditVoidReturnConcept->siUnits().toStdString().c_str(),
-      quantityEditVoidReturnConcept->ipUnits().toStdString().c_str(), quantityEditVoidReturnConcept->isIP(), nullptr);
-    if (quantityEditVoidReturnConcept->hasClickFocus()) {
-      quantityEditVoidReturn->enableClickFocus();
-    }
+boost::optional<model::ModelObject> OSCellWrapper::modelObject() const {
+  return m_modelObject;
+}
 
-    quantityEditVoidReturn->bind(
-      m_gridController->isIP(), t_mo,
-      DoubleGetter(std::bind(&QuantityEditVoidReturnConcept<double>::get, quantityEditVoidReturnConcept.data(), t_mo)),
-      DoubleSetterVoidReturn(
-        std::bind(&QuantityEditVoidReturnConcept<double>::set, quantityEditVoidReturnConcept.data(), t_mo, std::placeholders::_1)),
-      boost::optional<NoFailAction>(std::bind(&QuantityEditVoidReturnConcept<double>::reset, quantityEditVoidReturnConcept.data(), t_mo)),
-      boost::optional<NoFailAction>(), boost::optional<NoFailAction>(),
-      boost::optional<BasicQuery>(std::bind(&QuantityEditVoidReturnConcept<double>::isDefaulted, quantityEditVoidReturnConcept.data(), t_mo)));
+bool OSCellWrapper::isReusable() const {
+  return m_modelObject && m_gridController && !m_hasSubRows && (m_holders.size() == 1);
+}
 
-    connect(m_gridController, &OSGridController::toggleUnitsClicked, quantityEditVoidReturn, &OSQuantityEdit2::onUnitSystemChange);
+void OSCellWrapper::setLocation(int modelRow, int gridRow, int column) {
+  OS_ASSERT(isReusable());
+  OS_ASSERT(m_holders.size() == m_holderObjects.size());
 
-    widget = quantityEditVoidReturn;
+  m_modelRow = modelRow;
+  m_gridRow = gridRow;
+  m_column = column;
 
-  } else if (QSharedPointer<OptionalQuantityEditVoidReturnConcept<double>> optionalQuantityEditVoidReturnConcept =
-               t_baseConcept.dynamicCast<OptionalQuantityEditVoidReturnConcept<double>>()) {
+  for (size_t i = 0; i < m_holders.size(); ++i) {
+    const HolderObject& holderObject = m_holderObjects[i];
+    m_objectSelector->addObject(holderObject.obj, m_holders[i], m_modelRow, m_gridRow, m_column, boost::none, holderObject.isSelector,
+                                holderObject.isParent, holderObject.isLocked);
 
-    OSQuantityEdit2* optionalQuantityEditVoidReturn = new OSQuantityEdit2(optionalQuantityEditVoidReturnConcept->modelUnits().toStdString().c_str(),
-                                                                          optionalQuantityEditVoidReturnConcept->siUnits().toStdString().c_str(),
-                                                                          optionalQuantityEditVoidReturnConcept->ipUnits().toStdString().c_str(),
-                                                                          optionalQuantityEditVoidReturnConcept->isIP(), nullptr);
-    if (optionalQuantityEditVoidReturnConcept->hasClickFocus()) {
-      optionalQuantityEditVoidReturn->enableClickFocus();
-    }
+    // look like a new cell at this location
+    GridCellLocation location(m_modelRow, m_gridRow, m_column, boost::none, nullptr);
+    GridCellInfo info(holderObject.obj, holderObject.isSelector, true, false, holderObject.isLocked, nullptr);
+    m_holders[i]->setCellProperties(location, info);
+  }
+}
 
-    optionalQuantityEditVoidReturn->bind(
-      m_gridController->isIP(), t_mo,
-      OptionalDoubleGetter(std::bind(&OptionalQuantityEditVoidReturnConcept<double>::get, optionalQuantityEditVoidReturnConcept.data(), t_mo)),
-      DoubleSetterVoidReturn(
-        std::bind(&OptionalQuantityEditVoidReturnConcept<double>::set, optionalQuantityEditVoidReturnConcept.data(), t_mo, std::placeholders::_1)));
+QWidget* OSCellWrapper::createOSWidget(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept) {
+  OS_ASSERT(m_gridController);
 
-    connect(m_gridController, &OSGridController::toggleUnitsClicked, optionalQuantityEditVoidReturn, &OSQuantityEdit2::onUnitSystemChange);
+  const WidgetFactory& factory = widgetFactory(t_baseConcept);
 
-    widget = optionalQuantityEditVoidReturn;
+  QWidget* recycled = nullptr;
+  if (factory.release && widgetPoolingEnabled && m_gridView) {
+    recycled = m_gridView->widgetPool().take(t_baseConcept);
+  }
 
-  } else if (QSharedPointer<ValueEditConcept<unsigned>> unsignedEditConcept = t_baseConcept.dynamicCast<ValueEditConcept<unsigned>>()) {
+  QWidget* widget = factory.make(t_mo, t_baseConcept, recycled, m_gridView, m_gridController);
 
-    auto unsignedEdit = new OSUnsignedEdit2(nullptr);
-    if (unsignedEditConcept->hasClickFocus()) {
-      unsignedEdit->enableClickFocus();
-    }
+  if (recycled) {
+    ++numWidgetsReused;
+  } else {
+    ++numWidgetsCreated;
+  }
 
-    unsignedEdit->bind(
-      t_mo, UnsignedGetter(std::bind(&ValueEditConcept<unsigned>::get, unsignedEditConcept.data(), t_mo)),
-      boost::optional<UnsignedSetter>(std::bind(&ValueEditConcept<unsigned>::set, unsignedEditConcept.data(), t_mo, std::placeholders::_1)),
-      boost::optional<NoFailAction>(std::bind(&ValueEditConcept<unsigned>::reset, unsignedEditConcept.data(), t_mo)), boost::optional<NoFailAction>(),
-      boost::optional<NoFailAction>(),
-      boost::optional<BasicQuery>(std::bind(&ValueEditConcept<unsigned>::isDefaulted, unsignedEditConcept.data(), t_mo)));
+  if (factory.release) {
+    m_poolableWidgets.emplace_back(widget, t_baseConcept);
+  }
 
-    widget = unsignedEdit;
+  return widget;
+}
 
-  } else if (QSharedPointer<DropZoneConcept> dropZoneConcept = t_baseConcept.dynamicCast<DropZoneConcept>()) {
-    auto dropZone = new OSDropZone2();
-    if (dropZoneConcept->hasClickFocus()) {
-      dropZone->enableClickFocus();
+void OSCellWrapper::releaseWidgets(OSWidgetPool& pool) {
+  for (const auto& poolableWidget : m_poolableWidgets) {
+    QWidget* widget = poolableWidget.first;
+    if (widget) {
+      widgetFactory(poolableWidget.second).release(widget);
+      // take it out of its holder, it isn't explicitly hidden so it shows again with the next holder
+      widget->setParent(nullptr);
+      pool.add(poolableWidget.second, widget);
     }
+  }
+  m_poolableWidgets.clear();
+}
 
-    dropZone->bind(t_mo, OptionalModelObjectGetter(std::bind(&DropZoneConcept::get, dropZoneConcept.data(), t_mo)),
-                   ModelObjectSetter(std::bind(&DropZoneConcept::set, dropZoneConcept.data(), t_mo, std::placeholders::_1)),
-                   NoFailAction(std::bind(&DropZoneConcept::reset, dropZoneConcept.data(), t_mo)),
-                   ModelObjectIsDefaulted(std::bind(&DropZoneConcept::isDefaulted, dropZoneConcept.data(), t_mo)),
-                   OtherModelObjects(std::bind(&DropZoneConcept::otherObjects, dropZoneConcept.data(), t_mo)));
-
-    //connect(dropZone, OSDropZone2::itemClicked, gridView(), OSGridView::dropZoneItemClicked);
-    connect(dropZone, &OSDropZone2::itemClicked, m_gridView, &OSGridView::dropZoneItemClicked);
-
-    widget = dropZone;
-
-  } else if (QSharedPointer<RenderingColorConcept> renderingColorConcept = t_baseConcept.dynamicCast<RenderingColorConcept>()) {
-    auto renderingColorWidget = new RenderingColorWidget2(nullptr);
-
-    renderingColorWidget->bind(t_mo, OptionalModelObjectGetter(std::bind(&RenderingColorConcept::get, renderingColorConcept.data(), t_mo)),
-                               ModelObjectSetter(std::bind(&RenderingColorConcept::set, renderingColorConcept.data(), t_mo, std::placeholders::_1)));
-
-    widget = renderingColorWidget;
+void OSCellWrapper::setWidgetPoolingEnabled(bool enabled) {
+  widgetPoolingEnabled = enabled;
+}
 
-  } else {
-    // Unknown type
-    OS_ASSERT(false);
-  }
+unsigned OSCellWrapper::widgetsCreated() {
+  return numWidgetsCreated;
+}
 
-  return widget;
+unsigned OSCellWrapper::widgetsReused() {
+  return numWidgetsReused;
 }
 
 void OSCellWrapper::addOSWidget(QWidget* widget, const boost::optional<model::ModelObject>& obj, const bool isSelector, const bool isParent) {
@@ -570,31 +860,7 @@ void OSCellWrapper::addOSWidget(QWidget* widget, const boost::optional<model::Mo
 
   m_objectSelector->addObject(obj, holder, m_modelRow, m_gridRow, m_column, m_hasSubRows ? subrow : boost::optional<int>(), isSelector, isParent,
                               isLocked);
-}
-
-void OSCellWrapper::connectModelSignals() {
-  if (m_modelObject && !m_connectedmodel) {
-    m_connectedmodel = m_modelObject->model();
-
-    // get signals if object is added or removed
-    m_connectedmodel->getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.connect<OSCellWrapper, &OSCellWrapper::onAddWorkspaceObject>(
-      this);
-    m_connectedmodel->getImpl<model::detail::Model_Impl>()
-      .get()
-      ->removeWorkspaceObject.connect<OSCellWrapper, &OSCellWrapper::onRemoveWorkspaceObject>(this);
-  }
-}
-
-void OSCellWrapper::disconnectModelSignals() {
-  if (m_connectedmodel) {
-    m_connectedmodel->getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.disconnect<OSCellWrapper, &OSCellWrapper::onAddWorkspaceObject>(
-      this);
-    m_connectedmodel->getImpl<model::detail::Model_Impl>()
-      .get()
-      ->removeWorkspaceObject.disconnect<OSCellWrapper, &OSCellWrapper::onRemoveWorkspaceObject>(this);
-
-    m_connectedmodel.reset();
-  }
+  m_holderObjects.push_back(HolderObject{obj, isSelector, isParent, isLocked});
 }
 
 void OSCellWrapper::makeHeader() {
@@ -604,22 +870,7 @@ void OSCellWrapper::makeHeader() {
   this->style()->polish(this);
 }
 
-void OSCellWrapper::onRemoveWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType,
-                                            const openstudio::UUID& handle) {}
-
-void OSCellWrapper::onAddWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType,
-                                         const openstudio::UUID& handle) {
-  OS_ASSERT(m_baseConcept);
-  OS_ASSERT(m_modelObject);
-  OS_ASSERT(m_objectSelector);
-  OS_ASSERT(m_gridController);
-
-  // the object has been added to the model but is not fully constructed and does not yet have a parent
-  m_newModelObjects.insert(object.cast<model::ModelObject>());
-  QTimer::singleShot(0, this, &OSCellWrapper::processNewModelObjects);
-}
-
-void OSCellWrapper::processNewModelObjects() {
+bool OSCellWrapper::processNewModelObjects(const std::vector<model::ModelObject>& newModelObjects) {
   OS_ASSERT(m_modelObject);
   OS_ASSERT(m_objectSelector);
 
@@ -627,7 +878,7 @@ void OSCellWrapper::processNewModelObjects() {
 
   bool needsRefresh = false;
 
-  for (const auto& newModelObject : m_newModelObjects) {
+  for (const auto& newModelObject : newModelObjects) {
     boost::optional<model::ParentObject> p = newModelObject.parent();
     if (p) {
       if (p.get() == m_modelObject.get()) {
@@ -648,8 +899,6 @@ void OSCellWrapper::processNewModelObjects() {
     }
   }
 
-  m_newModelObjects.clear();
-
   if (needsRefresh) {
     // clear current holders
     QLayoutItem* child;
@@ -658,13 +907,17 @@ void OSCellWrapper::processNewModelObjects() {
       delete child;            // delete the layout item
     }
     m_holders.clear();
+    m_holderObjects.clear();
+    m_poolableWidgets.clear();
 
     // tell object selector to clear this cell
     m_objectSelector->clearCell(m_modelRow, m_gridRow, m_column);
 
-    // schedule refresh
-    QTimer::singleShot(0, this, &OSCellWrapper::refresh);
+    // the grid view batches the refreshes of all the cells with new subrows in one layout pass
+    refresh();
   }
+
+  return needsRefresh;
 }
 
 }  // namespace openstudio
@@ -35,8 +35,12 @@
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/ModelObject.hpp>
 
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include <QPointer>
 #include <QSharedPointer>
 #include <QWidget>
 #include <QVBoxLayout>
@@ -57,6 +61,37 @@ class OSGridController;
 class OSObjectSelector;
 class OSWidgetHolder;
 
+struct WidgetFactory;
+
+// Unbound widgets handed back by the cells of a grid being recreated, reused by the new cells whose widgets are made by the same factory,
+// in any column or category, instead of constructing new widgets. Widgets which are not reused are deleted with the pool or on clear.
+class OSWidgetPool
+{
+ public:
+  OSWidgetPool() = default;
+  OSWidgetPool(const OSWidgetPool&) = delete;
+  OSWidgetPool& operator=(const OSWidgetPool&) = delete;
+
+  ~OSWidgetPool();
+
+  void add(const QSharedPointer<BaseConcept>& t_baseConcept, QWidget* widget);
+
+  // Returns nullptr if there is no widget left which can be rebound to this concept
+  QWidget* take(const QSharedPointer<BaseConcept>& t_baseConcept);
+
+  size_t size() const;
+
+  void clear();
+
+ private:
+  // The factory of the concept, and the units for a widget constructed with them such as OSQuantityEdit2
+  using Key = std::pair<const WidgetFactory*, std::string>;
+
+  static Key key(const QSharedPointer<BaseConcept>& t_baseConcept);
+
+  std::map<Key, std::vector<QWidget*>> m_entries;
+};
+
 // An OSCellWrapper has one or more OSWidgetHolders, one for each subrow in a cell
 class OSCellWrapper : public QWidget
 {
@@ -76,13 +111,29 @@ class OSCellWrapper : public QWidget
 
   void setCellProperties(const GridCellLocation& location, const GridCellInfo& info);
 
- private slots:
+  QSharedPointer<BaseConcept> baseConcept() const;
+
+  boost::optional<model::ModelObject> modelObject() const;
 
-  void onRemoveWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+  // True for a bound cell without subrows, which can be moved to another location as is
+  bool isReusable() const;
 
-  void onAddWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+  // Moves a reusable cell, registering its widget with the object selector at the new location
+  void setLocation(int modelRow, int gridRow, int column);
 
-  void processNewModelObjects();
+  // Rebuilds the subrows if one of the objects added to the model belongs to this cell, returns true if it did.
+  // Called by the grid view with all the objects added in one event loop turn.
+  bool processNewModelObjects(const std::vector<model::ModelObject>& newModelObjects);
+
+  // Unbinds the widgets that can be recycled and moves them to the pool, call before deleting the cell
+  void releaseWidgets(OSWidgetPool& pool);
+
+  // Lets cells reuse pooled widgets, on by default
+  static void setWidgetPoolingEnabled(bool enabled);
+
+  // Number of widgets constructed and reused by createOSWidget, for testing
+  static unsigned widgetsCreated();
+  static unsigned widgetsReused();
 
  signals:
 
@@ -96,13 +147,21 @@ class OSCellWrapper : public QWidget
   // These will be put in container widgets to form the cell, regardless of the presence of sub rows.
   QWidget* createOSWidget(model::ModelObject t_mo, const QSharedPointer<BaseConcept>& t_baseConcept);
 
-  void connectModelSignals();
-  void disconnectModelSignals();
   void makeHeader();
 
   OSGridView* m_gridView;
   QGridLayout* m_layout;
   std::vector<OSWidgetHolder*> m_holders;
+
+  // what each holder was registered with in the object selector
+  struct HolderObject
+  {
+    boost::optional<model::ModelObject> obj;
+    bool isSelector;
+    bool isParent;
+    bool isLocked;
+  };
+  std::vector<HolderObject> m_holderObjects;
   QSharedPointer<BaseConcept> m_baseConcept;
   OSObjectSelector* m_objectSelector;
   int m_modelRow = 0;
@@ -113,13 +172,10 @@ class OSCellWrapper : public QWidget
 
   // only has these members if not a header cell
   boost::optional<model::ModelObject> m_modelObject;
-  OSGridController* m_gridController;
-
-  // set when connecting to a model signals
-  boost::optional<model::Model> m_connectedmodel;
+  OSGridController* m_gridController = nullptr;
 
-  // temp variable
-  std::set<model::ModelObject> m_newModelObjects;
+  // widgets that can go back to the pool, with the concept they were made for
+  std::vector<std::pair<QPointer<QWidget>, QSharedPointer<BaseConcept>>> m_poolableWidgets;
 };
 
 }  // namespace openstudio
@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "OSCheckBox.hpp"
+#include "ModelObjectChangeBatch.hpp"
 
 #include <openstudio/model/ModelObject.hpp>
 #include <openstudio/model/ModelObject_Impl.hpp>
@@ -106,7 +107,7 @@ void OSCheckBox3::bind(const model::ModelObject& modelObject, BoolGetter get, bo
     .get()
     ->openstudio::model::detail::ModelObject_Impl::onRemoveFromWorkspace.connect<OSCheckBox3, &OSCheckBox3::onModelObjectRemove>(this);
 
-  connect(this, &OSCheckBox3::toggled, this, &OSCheckBox3::onToggled);
+  connect(this, &OSCheckBox3::toggled, this, &OSCheckBox3::onToggled, Qt::UniqueConnection);
   bool checked = (*m_get)();
 
   this->setChecked(checked);
@@ -131,7 +132,7 @@ void OSCheckBox3::bind(const model::ModelObject& modelObject, BoolGetter get, bo
     .get()
     ->onRemoveFromWorkspace.connect<OSCheckBox3, &OSCheckBox3::onModelObjectRemove>(this);
 
-  connect(this, &OSCheckBox3::toggled, this, &OSCheckBox3::onToggled);
+  connect(this, &OSCheckBox3::toggled, this, &OSCheckBox3::onToggled, Qt::UniqueConnection);
   bool checked = (*m_get)();
 
   this->setChecked(checked);
@@ -146,7 +147,7 @@ void OSCheckBox3::enableClickFocus() {
 }
 
 void OSCheckBox3::disableClickFocus() {
-  m_hasClickFocus = true;
+  m_hasClickFocus = false;
   this->setFocusPolicy(Qt::NoFocus);
   clearFocus();
 }
@@ -195,6 +196,9 @@ void OSCheckBox3::onToggled(bool checked) {
 }
 
 void OSCheckBox3::onModelObjectChange() {
+  if (ModelObjectChangeBatch::deferRefresh(this, &OSCheckBox3::onModelObjectChange, &OSCheckBox3::m_modelObject)) {
+    return;
+  }
   if (m_modelObject) {
     if ((*m_get)() != this->isChecked()) {
       this->blockSignals(true);
@@ -345,6 +349,9 @@ void OSCheckBox2::onToggled(bool checked) {
 }
 
 void OSCheckBox2::onModelObjectChange() {
+  if (ModelObjectChangeBatch::deferRefresh(this, &OSCheckBox2::onModelObjectChange, &OSCheckBox2::m_modelObject)) {
+    return;
+  }
   if (m_modelObject) {
     this->setChecked((*m_get)());
   }
@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "OSComboBox.hpp"
+#include "ModelObjectChangeBatch.hpp"
 
 #include <openstudio/model/Model.hpp>
 #include <openstudio/model/Model_Impl.hpp>
@@ -249,6 +250,9 @@ void OSComboBox2::unbind() {
 }
 
 void OSComboBox2::onModelObjectChanged() {
+  if (ModelObjectChangeBatch::deferRefresh(this, &OSComboBox2::onModelObjectChanged, &OSComboBox2::m_modelObject)) {
+    return;
+  }
   OS_ASSERT(m_modelObject);
 
   if (m_choiceConcept) {
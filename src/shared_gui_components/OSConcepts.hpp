@@ -35,11 +35,15 @@
 #include "OSLoadNamePixmapLineEdit.hpp"
 
 #include <openstudio/model/ModelObject.hpp>
+#include <openstudio/utilities/units/QuantityConverter.hpp>
 
 #include <boost/any.hpp>
 #include <QSharedPointer>
 #include <QWidget>
 
+#include <algorithm>
+#include <string>
+
 namespace openstudio {
 
 class Heading
@@ -290,6 +294,88 @@ class ConceptProxy
   boost::any m_any;
 };
 
+// Text of the concepts' values, as copied and pasted between grid cells and spreadsheets
+
+inline std::string conceptValueToText(bool t_value) {
+  return t_value ? "true" : "false";
+}
+
+inline std::string conceptValueToText(int t_value) {
+  return std::to_string(t_value);
+}
+
+inline std::string conceptValueToText(unsigned t_value) {
+  return std::to_string(t_value);
+}
+
+inline std::string conceptValueToText(double t_value) {
+  return QString::number(t_value, 'g', 12).toStdString();
+}
+
+inline std::string conceptValueToText(const std::string& t_value) {
+  return t_value;
+}
+
+// Returns false if the text is not a value of the type
+inline bool conceptValueFromText(const std::string& t_text, bool& t_value) {
+  QString text = QString::fromStdString(t_text).trimmed().toLower();
+  if (text == "true" || text == "yes" || text == "1") {
+    t_value = true;
+    return true;
+  } else if (text == "false" || text == "no" || text == "0") {
+    t_value = false;
+    return true;
+  }
+  return false;
+}
+
+inline bool conceptValueFromText(const std::string& t_text, int& t_value) {
+  bool ok = false;
+  t_value = QString::fromStdString(t_text).trimmed().toInt(&ok);
+  return ok;
+}
+
+inline bool conceptValueFromText(const std::string& t_text, unsigned& t_value) {
+  bool ok = false;
+  t_value = QString::fromStdString(t_text).trimmed().toUInt(&ok);
+  return ok;
+}
+
+inline bool conceptValueFromText(const std::string& t_text, double& t_value) {
+  bool ok = false;
+  t_value = QString::fromStdString(t_text).trimmed().toDouble(&ok);
+  return ok;
+}
+
+inline bool conceptValueFromText(const std::string& t_text, std::string& t_value) {
+  t_value = t_text;
+  return true;
+}
+
+// Quantities are copied and pasted in the units the grid shows, IP or SI, and stored in the model's units
+inline boost::optional<std::string> quantityValueToText(double t_value, const QString& t_modelUnits, const QString& t_siUnits, const QString& t_ipUnits,
+                                                        bool t_isIP) {
+  boost::optional<double> value = convert(t_value, t_modelUnits.toStdString(), (t_isIP ? t_ipUnits : t_siUnits).toStdString());
+  if (!value) {
+    return boost::none;
+  }
+  return conceptValueToText(value.get());
+}
+
+inline bool quantityValueFromText(const std::string& t_text, const QString& t_modelUnits, const QString& t_siUnits, const QString& t_ipUnits,
+                                  bool t_isIP, double& t_value) {
+  double value;
+  if (!conceptValueFromText(t_text, value)) {
+    return false;
+  }
+  boost::optional<double> modelValue = convert(value, (t_isIP ? t_ipUnits : t_siUnits).toStdString(), t_modelUnits.toStdString());
+  if (!modelValue) {
+    return false;
+  }
+  t_value = modelValue.get();
+  return true;
+}
+
 class BaseConcept
 {
  public:
@@ -325,6 +411,31 @@ class BaseConcept
     return m_heading;
   }
 
+  using ValueSetter = std::function<void(const ConceptProxy&)>;
+
+  // Reads t_obj's value once and returns a setter applying it to other objects, used to "apply to selected".
+  // Each concept type overrides this, so the dispatch is resolved once per column instead of casting for every row.
+  // Empty for concepts that can't be applied
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) {
+    return ValueSetter();
+  }
+
+  // Returns a function resetting the concept's value on an object, empty for concepts that can't be reset
+  virtual ValueSetter resetter() {
+    return ValueSetter();
+  }
+
+  // t_obj's value as text, in IP or SI units, used to copy cells. None for concepts without a text value
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) {
+    return boost::none;
+  }
+
+  // Sets t_obj's value from text, in IP or SI units, used to paste cells.
+  // Returns false if the concept has no text value, the text isn't a value of the concept's type or the object rejected it
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) {
+    return false;
+  }
+
  private:
   Heading m_heading;
   bool m_selector;
@@ -344,6 +455,24 @@ class CheckBoxConcept : public BaseConcept
   virtual bool get(const ConceptProxy& obj) = 0;
   virtual void set(const ConceptProxy& obj, bool) = 0;
 
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    bool value = get(t_obj);
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    return conceptValueToText(get(t_obj));
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    bool value;
+    if (!conceptValueFromText(t_text, value)) {
+      return false;
+    }
+    set(t_obj, value);
+    return true;
+  }
+
   const std::string& tooltip() const {
     return m_tooltip;
   }
@@ -391,6 +520,20 @@ class CheckBoxConceptBoolReturn : public BaseConcept
   virtual bool get(const ConceptProxy& obj) = 0;
   virtual bool set(const ConceptProxy& obj, bool) = 0;
 
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    bool value = get(t_obj);
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    return conceptValueToText(get(t_obj));
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    bool value;
+    return conceptValueFromText(t_text, value) && set(t_obj, value);
+  }
+
   const std::string& tooltip() const {
     return m_tooltip;
   }
@@ -680,6 +823,27 @@ class ComboBoxConcept : public BaseConcept
   virtual ~ComboBoxConcept() {}
 
   virtual std::shared_ptr<ChoiceConcept> choiceConcept(const ConceptProxy& obj) = 0;
+
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    std::string value = choiceConcept(t_obj)->get();
+    return [this, value](const ConceptProxy& t_setterObj) { choiceConcept(t_setterObj)->set(value); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    return choiceConcept(t_obj)->get();
+  }
+
+  // Only one of the choices offered for t_obj, unless the combo box is editable
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    std::shared_ptr<ChoiceConcept> choice = choiceConcept(t_obj);
+    if (!choice->editable()) {
+      std::vector<std::string> choices = choice->choices();
+      if (std::find(choices.begin(), choices.end(), t_text) == choices.end()) {
+        return false;
+      }
+    }
+    return choice->set(t_text);
+  }
 };
 
 template <typename ChoiceType, typename DataSourceType>
@@ -775,6 +939,27 @@ class ValueEditConcept : public BaseConcept
   virtual bool set(const ConceptProxy& obj, ValueType) = 0;
   virtual void reset(const ConceptProxy& obj) = 0;
   virtual bool isDefaulted(const ConceptProxy& obj) = 0;
+
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    ValueType value = get(t_obj);
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value); };
+  }
+
+  virtual ValueSetter resetter() override {
+    return [this](const ConceptProxy& t_obj) { reset(t_obj); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    return conceptValueToText(get(t_obj));
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    ValueType value;
+    if (!conceptValueFromText(t_text, value)) {
+      return false;
+    }
+    return set(t_obj, value);
+  }
 };
 
 template <typename ValueType, typename DataSourceType>
@@ -833,6 +1018,31 @@ class OptionalValueEditConcept : public BaseConcept
 
   virtual boost::optional<ValueType> get(const ConceptProxy& obj) = 0;
   virtual bool set(const ConceptProxy& obj, ValueType) = 0;
+
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    boost::optional<ValueType> value = get(t_obj);
+    if (!value) {
+      // nothing to apply
+      return [](const ConceptProxy&) {};
+    }
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value.get()); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    boost::optional<ValueType> value = get(t_obj);
+    if (!value) {
+      return std::string();
+    }
+    return conceptValueToText(value.get());
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    ValueType value;
+    if (!conceptValueFromText(t_text, value)) {
+      return false;
+    }
+    return set(t_obj, value);
+  }
 };
 
 template <typename ValueType, typename DataSourceType>
@@ -874,6 +1084,28 @@ class ValueEditVoidReturnConcept : public BaseConcept
   virtual void set(const ConceptProxy& obj, ValueType) = 0;
   virtual void reset(const ConceptProxy& t_obj) = 0;
   virtual bool isDefaulted(const ConceptProxy& t_obj) = 0;
+
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    ValueType value = get(t_obj);
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value); };
+  }
+
+  virtual ValueSetter resetter() override {
+    return [this](const ConceptProxy& t_obj) { reset(t_obj); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    return conceptValueToText(get(t_obj));
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    ValueType value;
+    if (!conceptValueFromText(t_text, value)) {
+      return false;
+    }
+    set(t_obj, value);
+    return true;
+  }
 };
 
 template <typename ValueType, typename DataSourceType>
@@ -933,6 +1165,32 @@ class OptionalValueEditVoidReturnConcept : public BaseConcept
 
   virtual boost::optional<ValueType> get(const ConceptProxy& obj) = 0;
   virtual void set(const ConceptProxy& obj, ValueType) = 0;
+
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    boost::optional<ValueType> value = get(t_obj);
+    if (!value) {
+      // nothing to apply
+      return [](const ConceptProxy&) {};
+    }
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value.get()); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    boost::optional<ValueType> value = get(t_obj);
+    if (!value) {
+      return std::string();
+    }
+    return conceptValueToText(value.get());
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    ValueType value;
+    if (!conceptValueFromText(t_text, value)) {
+      return false;
+    }
+    set(t_obj, value);
+    return true;
+  }
 };
 
 template <typename ValueType, typename DataSourceType>
@@ -983,6 +1241,34 @@ class NameLineEditConcept : public BaseConcept
   virtual void reset(const ConceptProxy& obj) = 0;
   virtual bool isInherited(const ConceptProxy& obj) = 0;
 
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    boost::optional<std::string> value = get(t_obj, true);
+    if (!value) {
+      // nothing to apply
+      return [](const ConceptProxy&) {};
+    }
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value.get()); };
+  }
+
+  virtual ValueSetter resetter() override {
+    return [this](const ConceptProxy& t_obj) { reset(t_obj); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    boost::optional<std::string> value = get(t_obj, true);
+    if (!value) {
+      return std::string();
+    }
+    return value;
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    if (m_isLocked) {
+      return false;
+    }
+    return setReturnBool(t_obj, t_text);
+  }
+
   OSLineEditType osLineEditType() const {
     return m_osLineEditType;
   }
@@ -1081,6 +1367,27 @@ class QuantityEditConcept : public BaseConcept
   virtual void reset(const ConceptProxy& obj) = 0;
   virtual bool isDefaulted(const ConceptProxy& obj) = 0;
 
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    ValueType value = get(t_obj);
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value); };
+  }
+
+  virtual ValueSetter resetter() override {
+    return [this](const ConceptProxy& t_obj) { reset(t_obj); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    return quantityValueToText(get(t_obj), m_modelUnits, m_siUnits, m_ipUnits, t_isIP);
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    double value;
+    if (!quantityValueFromText(t_text, m_modelUnits, m_siUnits, m_ipUnits, t_isIP, value)) {
+      return false;
+    }
+    return set(t_obj, static_cast<ValueType>(value));
+  }
+
   QString modelUnits() const {
     return m_modelUnits;
   }
@@ -1167,6 +1474,31 @@ class OptionalQuantityEditConcept : public BaseConcept
   virtual boost::optional<ValueType> get(const ConceptProxy& obj) = 0;
   virtual bool set(const ConceptProxy& obj, ValueType) = 0;
 
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    boost::optional<ValueType> value = get(t_obj);
+    if (!value) {
+      // nothing to apply
+      return [](const ConceptProxy&) {};
+    }
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value.get()); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    boost::optional<ValueType> value = get(t_obj);
+    if (!value) {
+      return std::string();
+    }
+    return quantityValueToText(value.get(), m_modelUnits, m_siUnits, m_ipUnits, t_isIP);
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    double value;
+    if (!quantityValueFromText(t_text, m_modelUnits, m_siUnits, m_ipUnits, t_isIP, value)) {
+      return false;
+    }
+    return set(t_obj, static_cast<ValueType>(value));
+  }
+
   QString modelUnits() const {
     return m_modelUnits;
   }
@@ -1230,6 +1562,28 @@ class QuantityEditVoidReturnConcept : public BaseConcept
   virtual void reset(const ConceptProxy& t_obj) = 0;
   virtual bool isDefaulted(const ConceptProxy& t_obj) = 0;
 
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    ValueType value = get(t_obj);
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value); };
+  }
+
+  virtual ValueSetter resetter() override {
+    return [this](const ConceptProxy& t_obj) { reset(t_obj); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    return quantityValueToText(get(t_obj), m_modelUnits, m_siUnits, m_ipUnits, t_isIP);
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    double value;
+    if (!quantityValueFromText(t_text, m_modelUnits, m_siUnits, m_ipUnits, t_isIP, value)) {
+      return false;
+    }
+    set(t_obj, static_cast<ValueType>(value));
+    return true;
+  }
+
   QString modelUnits() const {
     return m_modelUnits;
   }
@@ -1315,6 +1669,32 @@ class OptionalQuantityEditVoidReturnConcept : public BaseConcept
   virtual boost::optional<ValueType> get(const ConceptProxy& obj) = 0;
   virtual void set(const ConceptProxy& obj, ValueType) = 0;
 
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    boost::optional<ValueType> value = get(t_obj);
+    if (!value) {
+      // nothing to apply
+      return [](const ConceptProxy&) {};
+    }
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value.get()); };
+  }
+
+  virtual boost::optional<std::string> valueText(const ConceptProxy& t_obj, bool t_isIP) override {
+    boost::optional<ValueType> value = get(t_obj);
+    if (!value) {
+      return std::string();
+    }
+    return quantityValueToText(value.get(), m_modelUnits, m_siUnits, m_ipUnits, t_isIP);
+  }
+
+  virtual bool setValueText(const ConceptProxy& t_obj, const std::string& t_text, bool t_isIP) override {
+    double value;
+    if (!quantityValueFromText(t_text, m_modelUnits, m_siUnits, m_ipUnits, t_isIP, value)) {
+      return false;
+    }
+    set(t_obj, static_cast<ValueType>(value));
+    return true;
+  }
+
   QString modelUnits() const {
     return m_modelUnits;
   }
@@ -1377,6 +1757,19 @@ class DropZoneConcept : public BaseConcept
   virtual void reset(const ConceptProxy& obj) = 0;
   virtual bool isDefaulted(const ConceptProxy& obj) = 0;
   virtual std::vector<model::ModelObject> otherObjects(const ConceptProxy& obj) = 0;
+
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    boost::optional<model::ModelObject> value = get(t_obj);
+    if (!value) {
+      // nothing to apply
+      return [](const ConceptProxy&) {};
+    }
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value.get()); };
+  }
+
+  virtual ValueSetter resetter() override {
+    return [this](const ConceptProxy& t_obj) { reset(t_obj); };
+  }
 };
 
 template <typename ValueType, typename DataSourceType>
@@ -1482,6 +1875,15 @@ class RenderingColorConcept : public BaseConcept
 
   virtual boost::optional<model::ModelObject> get(const ConceptProxy& obj) = 0;
   virtual bool set(const ConceptProxy& obj, const model::ModelObject&) = 0;
+
+  virtual ValueSetter valueSetter(const ConceptProxy& t_obj) override {
+    boost::optional<model::ModelObject> value = get(t_obj);
+    if (!value) {
+      // nothing to apply
+      return [](const ConceptProxy&) {};
+    }
+    return [this, value](const ConceptProxy& t_setterObj) { set(t_setterObj, value.get()); };
+  }
 };
 
 template <typename ValueType, typename DataSourceType>
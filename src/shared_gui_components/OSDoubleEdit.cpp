@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "OSDoubleEdit.hpp"
+#include "ModelObjectChangeBatch.hpp"
 
 #include <openstudio/model/ModelObject_Impl.hpp>
 
@@ -228,7 +229,7 @@ void OSDoubleEdit2::completeBind() {
 
   setEnabled(true);
 
-  connect(this, &OSDoubleEdit2::editingFinished, this, &OSDoubleEdit2::onEditingFinished);
+  connect(this, &OSDoubleEdit2::editingFinished, this, &OSDoubleEdit2::onEditingFinished, Qt::UniqueConnection);
 
   m_modelObject->getImpl<openstudio::model::detail::ModelObject_Impl>().get()->onChange.connect<OSDoubleEdit2, &OSDoubleEdit2::onModelObjectChange>(
     this);
@@ -344,6 +345,9 @@ void OSDoubleEdit2::onEditingFinished() {
 }
 
 void OSDoubleEdit2::onModelObjectChange() {
+  if (ModelObjectChangeBatch::deferRefresh(this, &OSDoubleEdit2::onModelObjectChange, &OSDoubleEdit2::m_modelObject)) {
+    return;
+  }
   if (m_modelExtensibleGroup) {
     if (m_modelExtensibleGroup->empty()) {
       // this is equivalent to onModelObjectRemove for the extensible group
@@ -29,6 +29,8 @@
 
 #include "OSGridController.hpp"
 
+#include "GridLayoutProfiles.hpp"
+#include "ModelObjectChangeBatch.hpp"
 #include "OSCellWrapper.hpp"
 #include "OSGridView.hpp"
 #include "OSObjectSelector.hpp"
@@ -45,6 +47,8 @@
 #include "../openstudio_lib/RenderingColorWidget.hpp"
 #include "../openstudio_lib/SchedulesView.hpp"
 
+#include "../model_editor/Utilities.hpp"
+
 #include <openstudio/model/Model_Impl.hpp>
 #include <openstudio/model/ModelObject_Impl.hpp>
 
@@ -60,9 +64,9 @@
 #include <QBoxLayout>
 #include <QButtonGroup>
 #include <QCheckBox>
+#include <QClipboard>
 #include <QColor>
 #include <QPushButton>
-#include <QSettings>
 #include <QTimer>
 #include <QWidget>
 
@@ -75,6 +79,70 @@
 
 namespace openstudio {
 
+namespace {
+
+bool batchedApplyEnabled = true;
+
+// Tab separated values, as spreadsheets copy and paste them: values with tabs, line breaks or quotes are quoted, quotes doubled
+QString toTabSeparatedValues(const std::vector<std::vector<std::string>>& values) {
+  QStringList lines;
+  for (const auto& row : values) {
+    QStringList fields;
+    for (const auto& value : row) {
+      QString field = QString::fromStdString(value);
+      if (field.contains('\t') || field.contains('\n') || field.contains('\r') || field.contains('"')) {
+        field = "\"" + field.replace("\"", "\"\"") + "\"";
+      }
+      fields.append(field);
+    }
+    lines.append(fields.join('\t'));
+  }
+  return lines.join('\n');
+}
+
+std::vector<std::vector<std::string>> fromTabSeparatedValues(const QString& text) {
+  std::vector<std::vector<std::string>> result;
+  std::vector<std::string> row;
+  QString field;
+  bool quoted = false;
+  for (int i = 0; i < text.size(); ++i) {
+    const QChar c = text[i];
+    if (quoted) {
+      if (c == '"' && i + 1 < text.size() && text[i + 1] == '"') {
+        field.append(c);
+        ++i;
+      } else if (c == '"') {
+        quoted = false;
+      } else {
+        field.append(c);
+      }
+    } else if (c == '"' && field.isEmpty()) {
+      quoted = true;
+    } else if (c == '\t') {
+      row.push_back(field.toStdString());
+      field.clear();
+    } else if (c == '\n' || c == '\r') {
+      if (c == '\r' && i + 1 < text.size() && text[i + 1] == '\n') {
+        ++i;
+      }
+      row.push_back(field.toStdString());
+      field.clear();
+      result.push_back(row);
+      row.clear();
+    } else {
+      field.append(c);
+    }
+  }
+  // spreadsheets end the last line with a line break
+  if (!field.isEmpty() || !row.empty()) {
+    row.push_back(field.toStdString());
+    result.push_back(row);
+  }
+  return result;
+}
+
+}  // namespace
+
 const std::vector<QColor> OSGridController::m_colors = SchedulesView::initializeColors();
 
 OSGridController::OSGridController()
@@ -99,7 +167,9 @@ OSGridController::OSGridController(bool isIP, const QString& headerText, IddObje
     m_isIP(isIP),
     m_horizontalHeaderBtnGrp(nullptr),
     m_headerText(headerText) {
-  loadQSettings();
+  indexModelObjects();
+
+  loadLayoutProfile();
 
   m_objectSelector = new OSObjectSelector(this);
 
@@ -110,24 +180,19 @@ OSGridController::OSGridController(bool isIP, const QString& headerText, IddObje
 
 OSGridController::~OSGridController() {
   disconnectFromModelSignals();
-  saveQSettings();
+  saveLayoutProfile();
 }
 
-void OSGridController::loadQSettings() {
-  QSettings settings("OpenStudio", m_headerText);
-  auto temp = settings.value("customFields").toStringList().toVector();
-  m_customFields = std::vector<QString>(temp.begin(), temp.end());
+void OSGridController::loadLayoutProfile() {
+  if (!m_headerText.isEmpty()) {
+    m_customFields = GridLayoutProfiles::instance().customFields(m_headerText);
+  }
 }
 
-void OSGridController::saveQSettings() const {
-  QSettings settings("OpenStudio", m_headerText);
-  QVector<QVariant> vector;
-  for (unsigned i = 0; i < m_customFields.size(); i++) {
-    QVariant variant = m_customFields.at(i);
-    vector.push_back(variant);
+void OSGridController::saveLayoutProfile() const {
+  if (!m_headerText.isEmpty()) {
+    GridLayoutProfiles::instance().setCustomFields(m_headerText, m_customFields);
   }
-  QList<QVariant> list = vector.toList();
-  settings.setValue("customCategories", list);
 }
 
 IddObjectType OSGridController::iddObjectType() const {
@@ -160,6 +225,14 @@ std::vector<model::ModelObject> OSGridController::modelObjects() const {
 
 void OSGridController::setModelObjects(const std::vector<model::ModelObject>& modelObjects) {
   m_modelObjects = modelObjects;
+  indexModelObjects();
+}
+
+void OSGridController::indexModelObjects() {
+  m_modelRowsByHandle.clear();
+  for (int modelRow = 0; modelRow < static_cast<int>(m_modelObjects.size()); ++modelRow) {
+    m_modelRowsByHandle.insert(std::make_pair(m_modelObjects[modelRow].handle(), modelRow));
+  }
 }
 /*
 std::vector<model::ModelObject> OSGridController::inheritedModelObjects() const {
@@ -204,6 +277,7 @@ void OSGridController::onCategorySelected(int index) {
   m_objectSelector->clear();
   m_currentCategoryIndex = index;
   m_focusedCellLocation = std::make_tuple(-1, -1, -1);
+  clearSelectedRange();
 
   m_currentCategory = m_categoriesAndFields.at(index).first;
 
@@ -246,157 +320,40 @@ void OSGridController::setHorizontalHeader(QWidget* gridView) {
   checkSelectedFields();
 }
 
-void OSGridController::setConceptValue(model::ModelObject t_setterMO, model::ModelObject t_getterMO,
-                                       const QSharedPointer<BaseConcept>& t_baseConcept) {
-  if (QSharedPointer<CheckBoxConcept> concept = t_baseConcept.dynamicCast<CheckBoxConcept>()) {
-    auto setter = std::bind(&CheckBoxConcept::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&CheckBoxConcept::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<CheckBoxConceptBoolReturn> concept = t_baseConcept.dynamicCast<CheckBoxConceptBoolReturn>()) {
-    auto setter = std::bind(&CheckBoxConceptBoolReturn::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&CheckBoxConceptBoolReturn::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<ComboBoxConcept> concept = t_baseConcept.dynamicCast<ComboBoxConcept>()) {
-    auto getterChoiceConcept = concept->choiceConcept(t_getterMO);
-    auto setterChoiceConcept = concept->choiceConcept(t_setterMO);
-    auto getter = std::bind(&ChoiceConcept::get, getterChoiceConcept.get());
-    auto setter = std::bind(&ChoiceConcept::set, setterChoiceConcept.get(), std::placeholders::_1);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<ValueEditConcept<double>> concept = t_baseConcept.dynamicCast<ValueEditConcept<double>>()) {
-    auto setter = std::bind(&ValueEditConcept<double>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&ValueEditConcept<double>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<OptionalValueEditConcept<double>> concept = t_baseConcept.dynamicCast<OptionalValueEditConcept<double>>()) {
-    auto setter = std::bind(&OptionalValueEditConcept<double>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&OptionalValueEditConcept<double>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    if (temp) setter(temp.get());
-  } else if (QSharedPointer<ValueEditVoidReturnConcept<double>> concept = t_baseConcept.dynamicCast<ValueEditVoidReturnConcept<double>>()) {
-    auto setter = std::bind(&ValueEditVoidReturnConcept<double>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&ValueEditVoidReturnConcept<double>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<OptionalValueEditVoidReturnConcept<double>> concept =
-               t_baseConcept.dynamicCast<OptionalValueEditVoidReturnConcept<double>>()) {
-    auto setter = std::bind(&OptionalValueEditVoidReturnConcept<double>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&OptionalValueEditVoidReturnConcept<double>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    if (temp) setter(temp.get());
-  } else if (QSharedPointer<ValueEditConcept<int>> concept = t_baseConcept.dynamicCast<ValueEditConcept<int>>()) {
-    auto setter = std::bind(&ValueEditConcept<int>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&ValueEditConcept<int>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<ValueEditConcept<std::string>> concept = t_baseConcept.dynamicCast<ValueEditConcept<std::string>>()) {
-    auto setter = std::bind(&ValueEditConcept<std::string>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&ValueEditConcept<std::string>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<ValueEditVoidReturnConcept<std::string>> concept = t_baseConcept.dynamicCast<ValueEditVoidReturnConcept<std::string>>()) {
-    auto setter = std::bind(&ValueEditVoidReturnConcept<std::string>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&ValueEditVoidReturnConcept<std::string>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<NameLineEditConcept> concept = t_baseConcept.dynamicCast<NameLineEditConcept>()) {
-    auto setter = std::bind(&NameLineEditConcept::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&NameLineEditConcept::get, concept.data(), t_getterMO, true);  // NOTE Evan: Do we always want true?
-    auto temp = getter();
-    if (temp) setter(temp.get());
-  } else if (QSharedPointer<QuantityEditConcept<double>> concept = t_baseConcept.dynamicCast<QuantityEditConcept<double>>()) {
-    auto setter = std::bind(&QuantityEditConcept<double>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&QuantityEditConcept<double>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<OptionalQuantityEditConcept<double>> concept = t_baseConcept.dynamicCast<OptionalQuantityEditConcept<double>>()) {
-    auto setter = std::bind(&OptionalQuantityEditConcept<double>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&OptionalQuantityEditConcept<double>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    if (temp) setter(temp.get());
-  } else if (QSharedPointer<QuantityEditVoidReturnConcept<double>> concept = t_baseConcept.dynamicCast<QuantityEditVoidReturnConcept<double>>()) {
-    auto setter = std::bind(&QuantityEditVoidReturnConcept<double>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&QuantityEditVoidReturnConcept<double>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<OptionalQuantityEditVoidReturnConcept<double>> concept =
-               t_baseConcept.dynamicCast<OptionalQuantityEditVoidReturnConcept<double>>()) {
-    auto setter = std::bind(&OptionalQuantityEditVoidReturnConcept<double>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&OptionalQuantityEditVoidReturnConcept<double>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    if (temp) setter(temp.get());
-  } else if (QSharedPointer<ValueEditConcept<unsigned>> concept = t_baseConcept.dynamicCast<ValueEditConcept<unsigned>>()) {
-    auto setter = std::bind(&ValueEditConcept<unsigned>::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&ValueEditConcept<unsigned>::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    setter(temp);
-  } else if (QSharedPointer<DropZoneConcept> concept = t_baseConcept.dynamicCast<DropZoneConcept>()) {
-    auto setter = std::bind(&DropZoneConcept::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&DropZoneConcept::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    if (temp) setter(temp.get());
-  } else if (QSharedPointer<RenderingColorConcept> concept = t_baseConcept.dynamicCast<RenderingColorConcept>()) {
-    auto setter = std::bind(&RenderingColorConcept::set, concept.data(), t_setterMO, std::placeholders::_1);
-    auto getter = std::bind(&RenderingColorConcept::get, concept.data(), t_getterMO);
-    auto temp = getter();
-    if (temp) setter(temp.get());
-  } else {
-    // Unknown type
-    OS_ASSERT(false);
-  }
+BaseConcept::ValueSetter OSGridController::conceptValueSetter(const model::ModelObject& t_getterMO,
+                                                              const QSharedPointer<BaseConcept>& t_baseConcept) {
+  // Each concept type knows how to carry its value over, no need to cast through all of them
+  BaseConcept::ValueSetter setter = t_baseConcept->valueSetter(t_getterMO);
+  // Unknown type
+  OS_ASSERT(setter);
+  return setter;
 }
 
-void OSGridController::setConceptValue(model::ModelObject t_setterMO, model::ModelObject t_getterMO,
-                                       const QSharedPointer<BaseConcept>& t_setterBaseConcept,
-                                       const QSharedPointer<BaseConcept>& t_getterBaseConcept) {
+BaseConcept::ValueSetter OSGridController::conceptValueSetter(const model::ModelObject& t_getterMO,
+                                                              const QSharedPointer<BaseConcept>& t_setterBaseConcept,
+                                                              const QSharedPointer<BaseConcept>& t_getterBaseConcept) {
   if (t_getterBaseConcept.dynamicCast<NameLineEditConcept>()) {
     if (QSharedPointer<DropZoneConcept> setterConcept = t_setterBaseConcept.dynamicCast<DropZoneConcept>()) {
       auto mo = m_model.getModelObject<model::ModelObject>(t_getterMO.handle());
       OS_ASSERT(mo);
-      auto setter = std::bind(&DropZoneConcept::set, setterConcept.data(), t_setterMO, std::placeholders::_1);
-      setter(mo.get());
+      model::ModelObject value = mo.get();
+      DropZoneConcept* concept = setterConcept.data();
+      return [concept, value](const ConceptProxy& t_setterObj) { concept->set(t_setterObj, value); };
     }
-  } else {
-    // No other combination is currently in use
-    // Should never get here
-    OS_ASSERT(false);
+    return [](const ConceptProxy&) {};
   }
+
+  // No other combination is currently in use
+  // Should never get here
+  OS_ASSERT(false);
+  return BaseConcept::ValueSetter();
 }
 
 void OSGridController::resetConceptValue(model::ModelObject t_resetMO, const QSharedPointer<BaseConcept>& t_baseConcept) {
-  if (QSharedPointer<ValueEditConcept<double>> concept = t_baseConcept.dynamicCast<ValueEditConcept<double>>()) {
-    auto reset = std::bind(&ValueEditConcept<double>::reset, concept.data(), t_resetMO);
-    reset();
-  } else if (QSharedPointer<ValueEditVoidReturnConcept<double>> concept = t_baseConcept.dynamicCast<ValueEditVoidReturnConcept<double>>()) {
-    auto reset = std::bind(&ValueEditVoidReturnConcept<double>::reset, concept.data(), t_resetMO);
-    reset();
-  } else if (QSharedPointer<ValueEditConcept<int>> concept = t_baseConcept.dynamicCast<ValueEditConcept<int>>()) {
-    auto reset = std::bind(&ValueEditConcept<int>::reset, concept.data(), t_resetMO);
-    reset();
-  } else if (QSharedPointer<ValueEditConcept<std::string>> concept = t_baseConcept.dynamicCast<ValueEditConcept<std::string>>()) {
-    auto reset = std::bind(&ValueEditConcept<std::string>::reset, concept.data(), t_resetMO);
-    reset();
-  } else if (QSharedPointer<NameLineEditConcept> concept = t_baseConcept.dynamicCast<NameLineEditConcept>()) {
-    auto reset = std::bind(&NameLineEditConcept::reset, concept.data(), t_resetMO);
-    reset();
-  } else if (QSharedPointer<QuantityEditConcept<double>> concept = t_baseConcept.dynamicCast<QuantityEditConcept<double>>()) {
-    auto reset = std::bind(&QuantityEditConcept<double>::reset, concept.data(), t_resetMO);
-    reset();
-  } else if (QSharedPointer<QuantityEditVoidReturnConcept<double>> concept = t_baseConcept.dynamicCast<QuantityEditVoidReturnConcept<double>>()) {
-    auto reset = std::bind(&QuantityEditVoidReturnConcept<double>::reset, concept.data(), t_resetMO);
-    reset();
-  } else if (QSharedPointer<ValueEditConcept<unsigned>> concept = t_baseConcept.dynamicCast<ValueEditConcept<unsigned>>()) {
-    auto reset = std::bind(&ValueEditConcept<unsigned>::reset, concept.data(), t_resetMO);
-    reset();
-  } else if (QSharedPointer<DropZoneConcept> concept = t_baseConcept.dynamicCast<DropZoneConcept>()) {
-    auto reset = std::bind(&DropZoneConcept::reset, concept.data(), t_resetMO);
-    reset();
-  } else {
-    // Unknown type
-    OS_ASSERT(false);
-  }
+  BaseConcept::ValueSetter reset = t_baseConcept->resetter();
+  // Unknown type
+  OS_ASSERT(reset);
+  reset(t_resetMO);
 }
 
 OSCellWrapper* OSGridController::createCellWrapper(int gridRow, int column, OSGridView* gridView) {
@@ -448,7 +405,7 @@ OSCellWrapper* OSGridController::createCellWrapper(int gridRow, int column, OSGr
 
 void OSGridController::checkSelectedFields() {
   // If there is a header row, investigate which columns were previously checked
-  // (and loaded into m_customFields by QSettings) and check the respective
+  // (and loaded into m_customFields from the layout profile) and check the respective
   // header widgets
   if (!this->m_hasHorizontalHeader) return;
 
@@ -492,6 +449,10 @@ int OSGridController::rowCount() const {
 int OSGridController::columnCount() const {
   return m_baseConcepts.size();
 }
+
+QSharedPointer<BaseConcept> OSGridController::baseConcept(int column) const {
+  return m_baseConcepts.at(column);
+}
 /*
 QWidget* OSGridController::cell(int gridRow, int columnIndex) {
   QWidget* widget = nullptr;
@@ -522,6 +483,21 @@ int OSGridController::modelRowFromGridRow(int gridRow) {
   return gridRow;
 }
 
+boost::optional<int> OSGridController::modelRowFromHandle(const Handle& handle) const {
+  auto it = m_modelRowsByHandle.find(handle);
+  if (it != m_modelRowsByHandle.end()) {
+    return it->second;
+  }
+  return boost::none;
+}
+
+boost::optional<int> OSGridController::gridRowFromHandle(const Handle& handle) const {
+  if (boost::optional<int> modelRow = modelRowFromHandle(handle)) {
+    return m_hasHorizontalHeader ? *modelRow + 1 : *modelRow;
+  }
+  return boost::none;
+}
+
 /*
 std::vector<QWidget*> OSGridController::row(int gridRow) {
   std::vector<QWidget*> row;
@@ -562,6 +538,7 @@ void OSGridController::onHorizontalHeaderChecked(int index) {
 
   // Update the user-selected fields
   setCustomCategoryAndFields();
+  saveLayoutProfile();
 }
 
 void OSGridController::onToggleUnits(bool displayIP) {
@@ -591,12 +568,11 @@ bool OSGridController::getgridRowByItem(OSItem* item, int& gridRow) {
   auto success = false;
   gridRow = -1;
 
-  for (auto modelObject : m_modelObjects) {
-    gridRow++;
-    OSItemId itemId = modelObjectToItemId(modelObject, false);
-    if (item->itemId() == itemId) {
+  // Item ids of model objects are their handles
+  if (boost::optional<int> modelRow = modelRowFromHandle(toUUID(item->itemId().itemId()))) {
+    if (item->itemId() == modelObjectToItemId(m_modelObjects[*modelRow], false)) {
+      gridRow = *modelRow;
       success = true;
-      break;
     }
   }
 
@@ -668,30 +644,54 @@ void OSGridController::disconnectFromModelSignals() {
     this);
 }
 
+void OSGridController::setBatchedApplyEnabled(bool enabled) {
+  batchedApplyEnabled = enabled;
+}
+
 void OSGridController::onSelectionCleared() {
   m_objectSelector->clearSelection();
 }
 
 void OSGridController::onRemoveWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType,
                                                const openstudio::UUID& handle) {
+  // The row stays in the grid, hidden and locked, so the rows after it keep their numbers
+  m_modelRowsByHandle.erase(handle);
+  auto it = std::find_if(m_newModelObjects.begin(), m_newModelObjects.end(),
+                         [&handle](const model::ModelObject& newModelObject) { return newModelObject.handle() == handle; });
+  if (it != m_newModelObjects.end()) {
+    m_newModelObjects.erase(it);
+  }
   m_objectSelector->setObjectRemoved(handle);
 }
 
 void OSGridController::onAddWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType,
                                             const openstudio::UUID& handle) {
   if (iddObjectType == m_iddObjectType) {
-    // note that object is not yet fully constructed
+    // note that object is not yet fully constructed, all the objects added before the next event loop turn make one batch
+    if (m_newModelObjects.empty()) {
+      QTimer::singleShot(0, this, &OSGridController::processNewModelObjects);
+    }
     m_newModelObjects.insert(object.cast<model::ModelObject>());
-    QTimer::singleShot(0, this, &OSGridController::processNewModelObjects);
   }
 }
 
 void OSGridController::processNewModelObjects() {
+  if (m_newModelObjects.empty()) {
+    return;
+  }
+
+  const int firstRow = rowCount();
   for (const model::ModelObject& newModelObject : m_newModelObjects) {
-    m_modelObjects.push_back(newModelObject);
-    emit addRow(rowCount() - 1);
+    // Already in the grid if the model objects were refreshed since it was added
+    if (m_modelRowsByHandle.insert(std::make_pair(newModelObject.handle(), static_cast<int>(m_modelObjects.size()))).second) {
+      m_modelObjects.push_back(newModelObject);
+    }
   }
   m_newModelObjects.clear();
+
+  if (rowCount() > firstRow) {
+    emit addRows(firstRow, rowCount() - 1);
+  }
 }
 
 void OSGridController::onSelectAllStateChanged(const int newState) const {
@@ -729,34 +729,41 @@ void OSGridController::onInFocus(bool inFocus, bool hasData, int modelRow, int g
       return;
     }
 
+    // Resolve how the value is applied once for the column, then it's a plain loop over the selection
+    BaseConcept::ValueSetter setter;
     QSharedPointer<DataSourceAdapter> dataSource = m_baseConcepts[column].dynamicCast<DataSourceAdapter>();
     if (focusedSubrow && dataSource) {
       // Sub rows present, either in a widget, or in a row
       const DataSource& source = dataSource->source();
       QSharedPointer<BaseConcept> dropZoneConcept = source.dropZoneConcept();
-      for (auto modelObject : selectedObjects) {
-        // Don't set the chosen object when iterating through the selected objects
-        if (modelObject != focusedObject.get()) {
-          OS_ASSERT(dataSource.data()->innerConcept());
-          if (dropZoneConcept) {
-            // Widget has sub rows
-            setConceptValue(modelObject, focusedObject.get(), dropZoneConcept, dataSource.data()->innerConcept());
-          } else {
-            // Row has sub rows
-            setConceptValue(modelObject, focusedObject.get(), dataSource.data()->innerConcept());
-          }
-        }
+      OS_ASSERT(dataSource.data()->innerConcept());
+      if (dropZoneConcept) {
+        // Widget has sub rows
+        setter = conceptValueSetter(focusedObject.get(), dropZoneConcept, dataSource.data()->innerConcept());
+      } else {
+        // Row has sub rows
+        setter = conceptValueSetter(focusedObject.get(), dataSource.data()->innerConcept());
       }
     } else if (!focusedSubrow) {
-      for (auto modelObject : selectedObjects) {
+      setter = conceptValueSetter(focusedObject.get(), m_baseConcepts[column]);
+    } else {
+      // Should never get here
+      OS_ASSERT(false);
+    }
+
+    auto applyToSelected = [&]() {
+      for (const auto& modelObject : selectedObjects) {
         // Don't set the chosen object when iterating through the selected objects
         if (modelObject != focusedObject.get()) {
-          setConceptValue(modelObject, focusedObject.get(), m_baseConcepts[column]);
+          setter(modelObject);
         }
       }
+    };
+
+    if (batchedApplyEnabled) {
+      changeInBatch(applyToSelected);
     } else {
-      // Should never get here
-      OS_ASSERT(false);
+      applyToSelected();
     }
 
   } else {
@@ -771,6 +778,14 @@ void OSGridController::onInFocus(bool inFocus, bool hasData, int modelRow, int g
     if (inFocus) {
       m_focusedCellLocation = std::make_tuple(gridRow, column, subrow);
       button->setText("Apply to Selected");
+
+      // as in a spreadsheet, shift extends the range of cells to copy or paste from the cell focused before
+      if (!subrow) {
+        if (!(QApplication::keyboardModifiers() & Qt::ShiftModifier) || m_rangeAnchor.first < 0) {
+          m_rangeAnchor = std::make_pair(gridRow, column);
+        }
+        setSelectedRange(m_rangeAnchor.first, m_rangeAnchor.second, gridRow, column);
+      }
     } else {
       // do not reset m_focusedCellLocation here because the focused cell goes out of focus when the apply button is clicked
       button->setText("Apply to Selected");
@@ -782,6 +797,134 @@ void OSGridController::onInFocus(bool inFocus, bool hasData, int modelRow, int g
   }
 }
 
+void OSGridController::changeInBatch(const std::function<void()>& t_changes) {
+  // The widgets bound to the changed objects refresh once each, when the batch closes, and the grid is repainted once
+  QWidget* gridView = qobject_cast<QWidget*>(parent());
+  if (gridView) {
+    gridView->setUpdatesEnabled(false);
+  }
+  {
+    ModelObjectChangeBatch batch;
+    t_changes();
+  }
+  if (gridView) {
+    gridView->setUpdatesEnabled(true);
+  }
+}
+
+void OSGridController::setSelectedRange(int firstGridRow, int firstColumn, int lastGridRow, int lastColumn) {
+  m_selectedRange = std::make_tuple(std::min(firstGridRow, lastGridRow), std::min(firstColumn, lastColumn), std::max(firstGridRow, lastGridRow),
+                                    std::max(firstColumn, lastColumn));
+  m_objectSelector->setRangeCells(std::get<0>(m_selectedRange), std::get<1>(m_selectedRange), std::get<2>(m_selectedRange),
+                                  std::get<3>(m_selectedRange));
+}
+
+void OSGridController::clearSelectedRange() {
+  m_selectedRange = std::make_tuple(-1, -1, -1, -1);
+  m_rangeAnchor = std::make_pair(-1, -1);
+  m_objectSelector->clearRangeCells();
+}
+
+std::vector<std::pair<int, model::ModelObject>> OSGridController::shownRows(int firstGridRow, int lastGridRow) {
+  std::vector<std::pair<int, model::ModelObject>> result;
+  auto objectFilter = m_objectSelector->objectFilter();
+  for (int gridRow = std::max(firstGridRow, 0); gridRow <= lastGridRow && gridRow < rowCount(); ++gridRow) {
+    int modelRow = modelRowFromGridRow(gridRow);
+    if (modelRow < 0) {
+      // header
+      continue;
+    }
+    const model::ModelObject& modelObject = m_modelObjects[modelRow];
+    // removed objects keep their hidden row
+    if (m_modelRowsByHandle.count(modelObject.handle()) && objectFilter(modelObject)) {
+      result.emplace_back(gridRow, modelObject);
+    }
+  }
+  return result;
+}
+
+QString OSGridController::selectedRangeText() {
+  int firstGridRow, firstColumn, lastGridRow, lastColumn;
+  std::tie(firstGridRow, firstColumn, lastGridRow, lastColumn) = m_selectedRange;
+  if (firstGridRow < 0 || firstColumn < 0) {
+    return QString();
+  }
+  lastColumn = std::min(lastColumn, columnCount() - 1);
+
+  std::vector<std::vector<std::string>> values;
+  for (const auto& row : shownRows(firstGridRow, lastGridRow)) {
+    std::vector<std::string> rowValues;
+    for (int column = firstColumn; column <= lastColumn; ++column) {
+      // cells with subrows, selection check boxes or without a text value are copied empty
+      boost::optional<std::string> value;
+      if (!m_baseConcepts[column].dynamicCast<DataSourceAdapter>() && !m_baseConcepts[column]->isSelector()) {
+        value = m_baseConcepts[column]->valueText(row.second, m_isIP);
+      }
+      rowValues.push_back(value ? value.get() : std::string());
+    }
+    values.push_back(rowValues);
+  }
+
+  return toTabSeparatedValues(values);
+}
+
+int OSGridController::pasteToSelectedRange(const QString& text) {
+  const int firstGridRow = std::get<0>(m_selectedRange);
+  const int firstColumn = std::get<1>(m_selectedRange);
+  if (firstGridRow < 0 || firstColumn < 0) {
+    return 0;
+  }
+
+  std::vector<std::vector<std::string>> values = fromTabSeparatedValues(text);
+  std::vector<std::pair<int, model::ModelObject>> rows = shownRows(firstGridRow, rowCount() - 1);
+  if (rows.size() > values.size()) {
+    rows.resize(values.size());
+  }
+  auto objectIsLocked = m_objectSelector->objectIsLocked();
+
+  int numSet = 0;
+  int numRejected = 0;
+  auto paste = [&]() {
+    for (size_t i = 0; i < rows.size(); ++i) {
+      const model::ModelObject& modelObject = rows[i].second;
+      if (objectIsLocked(modelObject)) {
+        continue;
+      }
+      for (size_t j = 0; j < values[i].size() && firstColumn + static_cast<int>(j) < columnCount(); ++j) {
+        const std::string& value = values[i][j];
+        if (value.empty()) {
+          // nothing to paste
+          continue;
+        }
+        const QSharedPointer<BaseConcept>& baseConcept = m_baseConcepts[firstColumn + j];
+        if (baseConcept->isSelector()) {
+          continue;
+        }
+        if (!baseConcept.dynamicCast<DataSourceAdapter>() && baseConcept->setValueText(modelObject, value, m_isIP)) {
+          ++numSet;
+        } else {
+          ++numRejected;
+        }
+      }
+    }
+  };
+  changeInBatch(paste);
+
+  if (numRejected > 0) {
+    LOG(Warn, "Pasted " << numSet << " cells, " << numRejected << " values were not valid for their column");
+  }
+
+  return numSet;
+}
+
+void OSGridController::onCopySelectedRange() {
+  QApplication::clipboard()->setText(selectedRangeText());
+}
+
+void OSGridController::onPasteToSelectedRange() {
+  pasteToSelectedRange(QApplication::clipboard()->text());
+}
+
 void OSGridController::onSetApplyButtonState() {
   for (auto pair : m_applyToButtonStates) {
     HorizontalHeaderWidget* horizontalHeaderWidget = qobject_cast<HorizontalHeaderWidget*>(m_horizontalHeaders.at(pair.first));
@@ -43,6 +43,8 @@
 
 #include <string>
 #include <functional>
+#include <map>
+#include <tuple>
 #include <vector>
 
 #include <QObject>
@@ -426,6 +428,8 @@ class OSGridController : public QObject
 
   virtual int columnCount() const;
 
+  QSharedPointer<BaseConcept> baseConcept(int column) const;
+
   model::ModelObject modelObjectFromGridRow(int gridRow);
 
   //virtual std::vector<QWidget*> row(int gridRow);
@@ -435,6 +439,10 @@ class OSGridController : public QObject
   int gridRowFromModelRow(int modelRow);
   int modelRowFromGridRow(int gridRow);
 
+  // Row of the object with this handle, if it is one of the model objects
+  boost::optional<int> modelRowFromHandle(const Handle& handle) const;
+  boost::optional<int> gridRowFromHandle(const Handle& handle) const;
+
   // Return a new widget at a "top level" row and column specified by arguments.
   // There might be subrows within the specified location.
   OSCellWrapper* createCellWrapper(int gridRow, int column, OSGridView* gridView);
@@ -446,6 +454,24 @@ class OSGridController : public QObject
 
   void disconnectFromModelSignals();
 
+  // Lets "Apply to Selected" set all the values before the bound widgets refresh, each once, on by default
+  static void setBatchedApplyEnabled(bool enabled);
+
+  // Rectangular range of cells to copy or paste, between two corners in grid rows and columns.
+  // Focusing a cell sets it to that cell, or extends it from the cell focused before if shift is held
+  void setSelectedRange(int firstGridRow, int firstColumn, int lastGridRow, int lastColumn);
+
+  // No range selected, the rows and columns it refers to are gone once the category changes or the grid is recreated
+  void clearSelectedRange();
+
+  // The values of the selected range, in the units shown, as tab separated values with one line per row shown
+  QString selectedRangeText();
+
+  // Pastes tab separated values into the rows shown from the top left cell of the selected range, as one batch of changes.
+  // Each value is checked by its column's concept, values that are not valid and locked rows are left unchanged.
+  // Returns the number of cells set
+  int pasteToSelectedRange(const QString& text);
+
   model::Model& model();
 
   std::vector<model::ModelObject> modelObjects() const;
@@ -478,6 +504,11 @@ class OSGridController : public QObject
 
   std::vector<model::ModelObject> m_modelObjects;
 
+  // Model row of each object in m_modelObjects, rows are never reused so they stay valid as objects are added and removed
+  std::map<Handle, int> m_modelRowsByHandle;
+
+  void indexModelObjects();
+
   //std::vector<model::ModelObject> m_inheritedModelObjects;
 
   // If a column contains information about a construction, it may be an inherited construction
@@ -543,7 +574,7 @@ class OSGridController : public QObject
 
   // Call this function after the table is constructed
   // to appropriately check user-selected category fields
-  // from QSettings and load them into a "Custom" button
+  // from the grid layout profile and load them into a "Custom" button
   virtual void checkSelectedFields();
 
   void checkSelectedFields(int category);
@@ -554,9 +585,10 @@ class OSGridController : public QObject
   friend class OSGridView;        // TODO: remove this
   friend class OSObjectSelector;  // TODO: remove this
 
-  void loadQSettings();
+  // The "Custom" fields of this grid, kept in GridLayoutProfiles by header text
+  void loadLayoutProfile();
 
-  void saveQSettings() const;
+  void saveLayoutProfile() const;
 
   void setCustomCategoryAndFields();
 
@@ -564,12 +596,13 @@ class OSGridController : public QObject
 
   bool getgridRowByItem(OSItem* item, int& gridRow);
 
-  void setConceptValue(model::ModelObject t_setterMO, model::ModelObject t_getterMO, const QSharedPointer<BaseConcept>& t_baseConcept);
+  // Returns a function applying t_getterMO's value for the concept to another object
+  BaseConcept::ValueSetter conceptValueSetter(const model::ModelObject& t_getterMO, const QSharedPointer<BaseConcept>& t_baseConcept);
 
   void resetConceptValue(model::ModelObject t_resetMO, const QSharedPointer<BaseConcept>& t_baseConcept);
 
-  void setConceptValue(model::ModelObject t_setterMO, model::ModelObject t_getterMO, const QSharedPointer<BaseConcept>& t_setterBaseConcept,
-                       const QSharedPointer<BaseConcept>& t_getterBaseConcept);
+  BaseConcept::ValueSetter conceptValueSetter(const model::ModelObject& t_getterMO, const QSharedPointer<BaseConcept>& t_setterBaseConcept,
+                                              const QSharedPointer<BaseConcept>& t_getterBaseConcept);
 
   QButtonGroup* m_horizontalHeaderBtnGrp;
 
@@ -583,13 +616,25 @@ class OSGridController : public QObject
 
   std::vector<std::pair<int, bool>> m_applyToButtonStates = std::vector<std::pair<int, bool>>();
 
-  // temp variable
+  // first row, first column, last row, last column
+  std::tuple<int, int, int, int> m_selectedRange = std::make_tuple(-1, -1, -1, -1);
+
+  // the corner the range is extended from
+  std::pair<int, int> m_rangeAnchor = std::make_pair(-1, -1);
+
+  // The grid rows, and their objects, between these rows which are shown: not headers, removed or filtered out
+  std::vector<std::pair<int, model::ModelObject>> shownRows(int firstGridRow, int lastGridRow);
+
+  // Makes the changes in one ModelObjectChangeBatch, with the grid view's updates disabled
+  void changeInBatch(const std::function<void()>& t_changes);
+
+  // objects added to the model since the last batch of new rows, processed once per event loop turn
   std::set<model::ModelObject> m_newModelObjects;
 
  signals:
 
-  // signal to add a row
-  void addRow(int row);
+  // signal to add the rows firstRow to lastRow, all added by one batch of new model objects
+  void addRows(int firstRow, int lastRow);
 
   // signal to parent to recreate all widgets
   void recreateAll();
@@ -617,6 +662,10 @@ class OSGridController : public QObject
 
   void onInFocus(bool inFocus, bool hasData, int modelRow, int gridRow, int column, boost::optional<int> subrow);
 
+  void onCopySelectedRange();
+
+  void onPasteToSelectedRange();
+
  protected slots:
 
   void onSelectAllStateChanged(const int newState) const;
@@ -57,6 +57,7 @@
 #include <openstudio/utilities/core/Assert.hpp>
 #include <openstudio/utilities/idd/IddObject.hpp>
 
+#include <QAction>
 #include <QApplication>
 #include <QBoxLayout>
 #include <QButtonGroup>
@@ -68,6 +69,9 @@
 #include <QStackedWidget>
 #include <QStyle>
 
+#include <algorithm>
+#include <typeinfo>
+
 #ifdef Q_OS_DARWIN
 #  define WIDTH 110
 #  define HEIGHT 60
@@ -80,6 +84,14 @@
 
 namespace openstudio {
 
+namespace {
+
+bool cellReuseEnabled = true;
+unsigned numCellsReused = 0;
+unsigned numLayoutPasses = 0;
+
+}  // namespace
+
 QGridLayout* OSGridView::makeGridLayout() {
   auto gridLayout = new QGridLayout();
   gridLayout->setSpacing(0);
@@ -94,17 +106,31 @@ OSGridView::OSGridView(OSGridController* gridController, const QString& headerTe
     m_contentLayout(nullptr),
     m_gridLayout(nullptr),
     m_collapsibleView(nullptr),
-    m_gridController(gridController) {
+    m_gridController(gridController),
+    m_widgetPool(new OSWidgetPool()) {
 
   // We use the headerText as the object name, will help in indentifying objects for any warnings
   setObjectName(headerText);
 
   m_gridController->setParent(this);
   connect(m_gridController, &OSGridController::recreateAll, this, &OSGridView::onRecreateAll);
-  connect(m_gridController, &OSGridController::addRow, this, &OSGridView::onAddRow);
+  connect(m_gridController, &OSGridController::addRows, this, &OSGridView::onAddRows);
   connect(m_gridController, &OSGridController::gridCellChanged, this, &OSGridView::onGridCellChanged);
   connect(m_gridController, &OSGridController::gridRowSelectionChanged, this, &OSGridView::gridRowSelectionChanged);
 
+  // Ctrl+C and Ctrl+V stay with the focused cell's line edit, the range of cells has its own shortcuts
+  auto copyCellsAction = new QAction(tr("Copy Cells"), this);
+  copyCellsAction->setShortcut(QKeySequence(Qt::CTRL | Qt::SHIFT | Qt::Key_C));
+  copyCellsAction->setShortcutContext(Qt::WidgetWithChildrenShortcut);
+  connect(copyCellsAction, &QAction::triggered, m_gridController, &OSGridController::onCopySelectedRange);
+  addAction(copyCellsAction);
+
+  auto pasteCellsAction = new QAction(tr("Paste Cells"), this);
+  pasteCellsAction->setShortcut(QKeySequence(Qt::CTRL | Qt::SHIFT | Qt::Key_V));
+  pasteCellsAction->setShortcutContext(Qt::WidgetWithChildrenShortcut);
+  connect(pasteCellsAction, &QAction::triggered, m_gridController, &OSGridController::onPasteToSelectedRange);
+  addAction(pasteCellsAction);
+
   /** Set up buttons for Categories: eg: SpaceTypes tab: that's the dropzone "Drop Space Type", "General", "Loads", "Measure Tags", "Custom"
    * QHBoxLayout manages the visual representation: they are placed side by side
    * QButtonGroup manages the state of the buttons in the group. By default a QButtonGroup is exclusive (only one button can be checked at one time)
@@ -187,7 +213,41 @@ OSGridView::OSGridView(OSGridController* gridController, const QString& headerTe
   QTimer::singleShot(0, this, &OSGridView::recreateAll);
 }
 
-OSGridView::~OSGridView(){};
+OSGridView::~OSGridView() {
+  if (m_connectedModel) {
+    m_connectedModel->getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.disconnect<OSGridView, &OSGridView::onAddWorkspaceObject>(this);
+  }
+};
+
+OSWidgetPool& OSGridView::widgetPool() {
+  return *m_widgetPool;
+}
+
+void OSGridView::setCellReuseEnabled(bool enabled) {
+  cellReuseEnabled = enabled;
+}
+
+unsigned OSGridView::cellsReused() {
+  return numCellsReused;
+}
+
+unsigned OSGridView::layoutPasses() {
+  return numLayoutPasses;
+}
+
+void OSGridView::addSubrowCell(OSCellWrapper* cellWrapper) {
+  // one connection for the whole grid rather than one per cell
+  if (!m_connectedModel) {
+    m_connectedModel = m_gridController->model();
+    m_connectedModel->getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.connect<OSGridView, &OSGridView::onAddWorkspaceObject>(this);
+  }
+  m_subrowCells.emplace_back(cellWrapper);
+}
+
+OSGridView::CellKey OSGridView::cellKey(const QSharedPointer<BaseConcept>& t_baseConcept) {
+  OS_ASSERT(t_baseConcept);
+  return CellKey(t_baseConcept->heading().label(), std::type_index(typeid(*t_baseConcept)));
+}
 
 /*
 void OSGridView::requestAddRow(int row) {
@@ -274,10 +334,81 @@ void OSGridView::addSpacingToContentLayout(int spacing) {
 //  delete item;
 //}
 
-void OSGridView::onAddRow(int row) {
-  setEnabled(false);
-  addRow(row);
-  setEnabled(true);
+void OSGridView::onAddRows(int firstRow, int lastRow) {
+  for (int row = firstRow; row <= lastRow; ++row) {
+    m_rowsToAdd.push_back(row);
+  }
+
+  // rows added while a batch is running join that batch, otherwise the pending subrows join this one
+  if (!m_processingInsertions) {
+    processInsertions();
+  }
+}
+
+void OSGridView::onAddWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType,
+                                      const openstudio::UUID& handle) {
+  // the object has been added to the model but is not fully constructed and does not yet have a parent
+  m_newModelObjects.push_back(object.cast<model::ModelObject>());
+  if (!m_insertionsScheduled) {
+    m_insertionsScheduled = true;
+    QTimer::singleShot(0, this, &OSGridView::processInsertions);
+  }
+}
+
+void OSGridView::processInsertions() {
+  m_insertionsScheduled = false;
+  if (m_processingInsertions || !m_gridLayout) {
+    // already running, or recreateAll has not built the grid yet and will build everything
+    return;
+  }
+
+  m_processingInsertions = true;
+
+  // the controller's new rows are part of the same batch
+  m_gridController->processNewModelObjects();
+
+  std::vector<int> rowsToAdd;
+  rowsToAdd.swap(m_rowsToAdd);
+  std::vector<model::ModelObject> newModelObjects;
+  newModelObjects.swap(m_newModelObjects);
+
+  m_subrowCells.erase(std::remove_if(m_subrowCells.begin(), m_subrowCells.end(), [](const QPointer<OSCellWrapper>& cell) { return cell.isNull(); }),
+                      m_subrowCells.end());
+
+  if (!rowsToAdd.empty() || (!newModelObjects.empty() && !m_subrowCells.empty())) {
+    setEnabled(false);
+    setUpdatesEnabled(false);
+
+    bool changed = false;
+    if (!newModelObjects.empty()) {
+      // cells registered by the rows created below already see the new objects
+      const std::vector<QPointer<OSCellWrapper>> subrowCells = m_subrowCells;
+      for (const auto& cell : subrowCells) {
+        if (cell && cell->processNewModelObjects(newModelObjects)) {
+          changed = true;
+        }
+      }
+    }
+
+    const auto numRows = m_gridController->rowCount();
+    const auto numColumns = m_gridController->columnCount();
+    for (int row : rowsToAdd) {
+      OS_ASSERT(row < numRows);
+      for (int j = 0; j < numColumns; j++) {
+        createCellWrapper(row, j);
+      }
+      changed = true;
+    }
+
+    setUpdatesEnabled(true);
+    setEnabled(true);
+
+    if (changed) {
+      ++numLayoutPasses;
+    }
+  }
+
+  m_processingInsertions = false;
 }
 
 void OSGridView::onRecreateAll() {
@@ -304,6 +435,23 @@ void OSGridView::deleteAll() {
 
     OS_ASSERT(widget);
 
+    if (OSCellWrapper* wrapper = qobject_cast<OSCellWrapper*>(widget)) {
+      // keep the cell, as is, for when its column is shown again
+      if (cellReuseEnabled && wrapper->isReusable()) {
+        OSCellWrapper*& cachedCell = m_cachedCells[cellKey(wrapper->baseConcept())][wrapper->modelObject()->handle()];
+        if (cachedCell) {
+          delete cachedCell;
+        }
+        cachedCell = wrapper;
+        wrapper->hide();
+        delete child;
+        continue;
+      }
+
+      // hand the widgets that can be recycled to the cells created next
+      wrapper->releaseWidgets(*m_widgetPool);
+    }
+
     delete widget;
     // Using deleteLater is actually slower than calling delete directly on the widget
     // deleteLater also introduces a strange redraw issue where the select all check box
@@ -314,20 +462,59 @@ void OSGridView::deleteAll() {
   }
 }
 
-void OSGridView::addRow(int row) {
-  setUpdatesEnabled(false);
+bool OSGridView::reuseCellWrapper(int row, int column) {
+  if (!cellReuseEnabled || m_cachedCells.empty()) {
+    return false;
+  }
 
-  OS_ASSERT(m_gridLayout);
-  OS_ASSERT(m_gridController);
+  const int modelRow = m_gridController->modelRowFromGridRow(row);
+  if (modelRow < 0) {
+    // header cells are always recreated with the header buttons
+    return false;
+  }
+
+  auto columnIt = m_cachedCells.find(cellKey(m_gridController->baseConcept(column)));
+  if (columnIt == m_cachedCells.end()) {
+    return false;
+  }
 
-  const auto numRows = m_gridController->rowCount();
-  OS_ASSERT(row < numRows);
-  const auto numColumns = m_gridController->columnCount();
-  for (int j = 0; j < numColumns; j++) {
-    createCellWrapper(row, j);
+  auto cellIt = columnIt->second.find(m_gridController->modelObjectFromGridRow(row).handle());
+  if (cellIt == columnIt->second.end()) {
+    return false;
   }
 
-  setUpdatesEnabled(true);
+  OSCellWrapper* wrapper = cellIt->second;
+  columnIt->second.erase(cellIt);
+
+  wrapper->setLocation(modelRow, row, column);
+  addCellWrapper(wrapper, row, column);
+  wrapper->show();
+  ++numCellsReused;
+
+  return true;
+}
+
+void OSGridView::pruneCachedCells() {
+  auto columnIt = m_cachedCells.begin();
+  while (columnIt != m_cachedCells.end()) {
+    auto cellIt = columnIt->second.begin();
+    while (cellIt != columnIt->second.end()) {
+      if (!cellReuseEnabled || !m_gridController->modelRowFromHandle(cellIt->first)) {
+        // the row is gone, its widgets can still be used by the cells created next
+        cellIt->second->releaseWidgets(*m_widgetPool);
+        delete cellIt->second;
+        cellIt = columnIt->second.erase(cellIt);
+      } else {
+        ++cellIt;
+      }
+    }
+
+    if (columnIt->second.empty()) {
+      columnIt = m_cachedCells.erase(columnIt);
+    } else {
+      ++columnIt;
+    }
+  }
 }
 
 void OSGridView::recreateAll() {
@@ -341,23 +528,38 @@ void OSGridView::recreateAll() {
 
   deleteAll();
 
+  // every row and subrow is built from the current model
+  m_rowsToAdd.clear();
+  m_newModelObjects.clear();
+  m_subrowCells.clear();
+
   if (m_gridController) {
     m_gridController->refreshModelObjects();
     auto objectFilter = m_gridController->objectFilter();
     auto objectIsLocked = m_gridController->objectIsLocked();
     m_gridController->clearObjectSelector();
+    m_gridController->clearSelectedRange();
+
+    pruneCachedCells();
 
     const auto numRows = m_gridController->rowCount();
     const auto numColumns = m_gridController->columnCount();
     for (int i = 0; i < numRows; i++) {
       for (int j = 0; j < numColumns; j++) {
-        createCellWrapper(i, j);
+        if (!reuseCellWrapper(i, j)) {
+          createCellWrapper(i, j);
+        }
       }
     }
 
     m_gridController->setObjectFilter(objectFilter);
     m_gridController->setObjectIsLocked(objectIsLocked);
 
+    ++numLayoutPasses;
+
+    // what wasn't reused belongs to columns or rows that are gone
+    m_widgetPool->clear();
+
     setUpdatesEnabled(true);
 
     //QTimer::singleShot(0, this, SLOT(selectRowDeterminedByModelSubTabView()));
@@ -30,13 +30,21 @@
 #ifndef SHAREDGUICOMPONENTS_OSGRIDVIEW_HPP
 #define SHAREDGUICOMPONENTS_OSGRIDVIEW_HPP
 
+#include <QPointer>
+#include <QSharedPointer>
 #include <QTimer>
 #include <QWidget>
 
 #include "../openstudio_lib/OSItem.hpp"
 
+#include <openstudio/model/Model.hpp>
 #include <openstudio/model/ModelObject.hpp>
 
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <utility>
+
 class QGridLayout;
 class QHideEvent;
 class QVBoxLayout;
@@ -53,6 +61,8 @@ class OSCollapsibleView;
 class OSDropZone;
 class OSGridController;
 class OSItem;
+class OSWidgetPool;
+class BaseConcept;
 class GridCellLocation;
 class GridCellInfo;
 
@@ -74,6 +84,22 @@ class OSGridView : public QWidget
 
   void addSpacingToContentLayout(int spacing);
 
+  // widgets of the cells being recreated, reused by the new cells
+  OSWidgetPool& widgetPool();
+
+  // Lets recreateAll keep the cells of the columns it removes and show them again when a column of the
+  // same field comes back for the same object, on by default
+  static void setCellReuseEnabled(bool enabled);
+
+  // Number of cells shown again instead of created by recreateAll, for testing
+  static unsigned cellsReused();
+
+  // Cells with subrows register here to be refreshed when objects are added to the model
+  void addSubrowCell(OSCellWrapper* cellWrapper);
+
+  // Number of times the grid layout was rebuilt or grown, by recreateAll or by a batch of insertions, for testing
+  static unsigned layoutPasses();
+
  protected:
   virtual void hideEvent(QHideEvent* event) override;
 
@@ -89,7 +115,7 @@ class OSGridView : public QWidget
 
   //void requestRemoveRow(int row);
 
-  void onAddRow(int row);
+  void onAddRows(int firstRow, int lastRow);
 
   void onRecreateAll();
 
@@ -102,11 +128,19 @@ class OSGridView : public QWidget
   // uses the OSGridController to create the OSCellWrapper for row, column
   void createCellWrapper(int row, int column);
 
-  // delete all widgets
+  // delete all widgets, keeping the reusable cells hidden in m_cachedCells
   void deleteAll();
 
-  // add a row
-  void addRow(int row);
+  // moves a kept cell for this row and column to the grid, returns false if there is none
+  bool reuseCellWrapper(int row, int column);
+
+  // delete the kept cells of objects which are no longer rows of the grid, their widgets go to the widget pool
+  void pruneCachedCells();
+
+  void onAddWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle);
+
+  // add the new rows of the controller and refresh the cells with new subrows, with the layout updated once
+  void processInsertions();
 
   // recreate all widgets
   void recreateAll();
@@ -126,6 +160,28 @@ class OSGridView : public QWidget
   OSCollapsibleView* m_collapsibleView;
 
   OSGridController* m_gridController;
+
+  std::unique_ptr<OSWidgetPool> m_widgetPool;
+
+  // columns are told apart by heading and concept type, the same field can have different concepts in different categories
+  using CellKey = std::pair<QString, std::type_index>;
+
+  static CellKey cellKey(const QSharedPointer<BaseConcept>& t_baseConcept);
+
+  // hidden cells of the columns not currently shown, by column and row object
+  std::map<CellKey, std::map<Handle, OSCellWrapper*>> m_cachedCells;
+
+  // model the subrow cells listen to, set while there is one
+  boost::optional<model::Model> m_connectedModel;
+
+  // cells with subrows, deleted ones are dropped at the next batch
+  std::vector<QPointer<OSCellWrapper>> m_subrowCells;
+
+  // rows and objects waiting for the next batch
+  std::vector<int> m_rowsToAdd;
+  std::vector<model::ModelObject> m_newModelObjects;
+  bool m_insertionsScheduled = false;
+  bool m_processingInsertions = false;
 };
 
 }  // namespace openstudio
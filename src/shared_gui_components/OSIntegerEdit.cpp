@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "OSIntegerEdit.hpp"
+#include "ModelObjectChangeBatch.hpp"
 
 #include <openstudio/model/ModelObject_Impl.hpp>
 
@@ -194,7 +195,7 @@ void OSIntegerEdit2::completeBind() {
 
   setEnabled(true);
 
-  connect(this, &OSIntegerEdit2::editingFinished, this, &OSIntegerEdit2::onEditingFinished);
+  connect(this, &OSIntegerEdit2::editingFinished, this, &OSIntegerEdit2::onEditingFinished, Qt::UniqueConnection);
 
   m_modelObject->getImpl<openstudio::model::detail::ModelObject_Impl>().get()->onChange.connect<OSIntegerEdit2, &OSIntegerEdit2::onModelObjectChange>(
     this);
@@ -306,6 +307,9 @@ void OSIntegerEdit2::onEditingFinished() {
 }
 
 void OSIntegerEdit2::onModelObjectChange() {
+  if (ModelObjectChangeBatch::deferRefresh(this, &OSIntegerEdit2::onModelObjectChange, &OSIntegerEdit2::m_modelObject)) {
+    return;
+  }
   if (m_modelExtensibleGroup) {
     if (m_modelExtensibleGroup->empty()) {
       // this is equivalent to onModelObjectRemove for the extensible group
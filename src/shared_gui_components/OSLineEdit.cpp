@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "OSLineEdit.hpp"
+#include "ModelObjectChangeBatch.hpp"
 
 #include "../openstudio_lib/InspectorController.hpp"
 #include "../openstudio_lib/InspectorView.hpp"
@@ -276,6 +277,9 @@ bool OSLineEdit2::defaulted() const {
 }
 
 void OSLineEdit2::onModelObjectChange() {
+  if (ModelObjectChangeBatch::deferRefresh(this, &OSLineEdit2::onModelObjectChange, &OSLineEdit2::m_modelObject)) {
+    return;
+  }
   onModelObjectChangeInternal(false);
 }
 
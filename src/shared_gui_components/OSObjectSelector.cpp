@@ -136,7 +136,8 @@ GridCellInfo::GridCellInfo(const boost::optional<model::ModelObject>& t_modelObj
     isSelector(t_isSelector),
     m_isVisible(t_isVisible),
     m_isSelected(t_isSelected),
-    m_isLocked(t_isLocked) {}
+    m_isLocked(t_isLocked),
+    m_isInRange(false) {}
 
 GridCellInfo::~GridCellInfo() {}
 
@@ -186,7 +187,20 @@ bool GridCellInfo::setLocked(bool locked) {
   return false;
 }
 
-OSObjectSelector::OSObjectSelector(QObject* parent) : QObject(parent), m_objectFilter(getDefaultFilter()), m_isLocked(getDefaultIsLocked()) {}
+bool GridCellInfo::isInRange() const {
+  return m_isInRange;
+}
+
+bool GridCellInfo::setInRange(bool inRange) {
+  if (m_isInRange != inRange) {
+    m_isInRange = inRange;
+    return true;
+  }
+  return false;
+}
+
+OSObjectSelector::OSObjectSelector(QObject* parent)
+  : QObject(parent), m_rangeCells(-1, -1, -1, -1), m_objectFilter(getDefaultFilter()), m_isLocked(getDefaultIsLocked()) {}
 
 OSObjectSelector::~OSObjectSelector() {}
 
@@ -202,6 +216,9 @@ void OSObjectSelector::clear() {
   m_selectorCellLocations.clear();
   m_parentCellLocations.clear();
   m_selectorOrParentCellLocations.clear();
+  m_gridRowCellLocations.clear();
+  m_selectorCellLocationsByHandle.clear();
+  m_rangeCells = std::make_tuple(-1, -1, -1, -1);
 
   m_objectFilter = getDefaultFilter();
   m_isLocked = getDefaultIsLocked();
@@ -213,26 +230,7 @@ void OSObjectSelector::clearCell(int t_modelRow, int t_gridRow, int t_column) {
     return t_modelRow == tmp->modelRow && t_gridRow == tmp->gridRow && t_column == tmp->column;
   };
 
-  m_selectorCellLocations.erase(std::remove_if(m_selectorCellLocations.begin(), m_selectorCellLocations.end(), sameCellLambda),
-                                m_selectorCellLocations.end());
-
-  m_parentCellLocations.erase(std::remove_if(m_parentCellLocations.begin(), m_parentCellLocations.end(), sameCellLambda),
-                              m_parentCellLocations.end());
-
-  m_selectorOrParentCellLocations.erase(
-    std::remove_if(m_selectorOrParentCellLocations.begin(), m_selectorOrParentCellLocations.end(), sameCellLambda),
-    m_selectorOrParentCellLocations.end());
-
-  auto it = m_gridCellLocationToInfoMap.begin();
-  while (it != m_gridCellLocationToInfoMap.end()) {
-    if (it->first->modelRow == t_modelRow && it->first->gridRow == t_gridRow && it->first->column == t_column) {
-      delete it->first;
-      delete it->second;
-      it = m_gridCellLocationToInfoMap.erase(it);
-    } else {
-      ++it;
-    }
-  }
+  eraseRowCellLocations(t_gridRow, sameCellLambda);
 }
 
 void OSObjectSelector::clearSubCell(int t_modelRow, int t_gridRow, int t_column, int t_subrow) {
@@ -241,27 +239,51 @@ void OSObjectSelector::clearSubCell(int t_modelRow, int t_gridRow, int t_column,
     return t_modelRow == tmp->modelRow && t_gridRow == tmp->gridRow && t_column == tmp->column && tmp->subrow && t_subrow == tmp->subrow.get();
   };
 
-  m_selectorCellLocations.erase(std::remove_if(m_selectorCellLocations.begin(), m_selectorCellLocations.end(), sameSubCellLambda),
-                                m_selectorCellLocations.end());
-
-  m_parentCellLocations.erase(std::remove_if(m_parentCellLocations.begin(), m_parentCellLocations.end(), sameSubCellLambda),
-                              m_parentCellLocations.end());
-
-  m_selectorOrParentCellLocations.erase(
-    std::remove_if(m_selectorOrParentCellLocations.begin(), m_selectorOrParentCellLocations.end(), sameSubCellLambda),
-    m_selectorOrParentCellLocations.end());
-
-  auto it = m_gridCellLocationToInfoMap.begin();
-  while (it != m_gridCellLocationToInfoMap.end()) {
-    if (it->first->modelRow == t_modelRow && it->first->gridRow == t_gridRow && it->first->column == t_column && it->first->subrow
-        && it->first->subrow.get() == t_subrow) {
-      delete it->first;
-      delete it->second;
-      it = m_gridCellLocationToInfoMap.erase(it);
+  eraseRowCellLocations(t_gridRow, sameSubCellLambda);
+}
+
+void OSObjectSelector::eraseRowCellLocations(int t_gridRow, const std::function<bool(GridCellLocation*)>& t_predicate) {
+  auto rowIt = m_gridRowCellLocations.find(t_gridRow);
+  if (rowIt == m_gridRowCellLocations.end()) {
+    return;
+  }
+
+  std::vector<GridCellLocation*>& rowLocations = rowIt->second;
+  auto it = rowLocations.begin();
+  while (it != rowLocations.end()) {
+    if (t_predicate(*it)) {
+      GridCellLocation* location = *it;
+      auto removeLocation = [location](std::vector<GridCellLocation*>& locations) {
+        locations.erase(std::remove(locations.begin(), locations.end(), location), locations.end());
+      };
+      removeLocation(m_selectorCellLocations);
+      removeLocation(m_parentCellLocations);
+      removeLocation(m_selectorOrParentCellLocations);
+
+      auto infoIt = m_gridCellLocationToInfoMap.find(location);
+      if (infoIt != m_gridCellLocationToInfoMap.end()) {
+        if (infoIt->second->isSelector && infoIt->second->modelObject) {
+          auto handleIt = m_selectorCellLocationsByHandle.find(infoIt->second->modelObject->handle());
+          if (handleIt != m_selectorCellLocationsByHandle.end()) {
+            removeLocation(handleIt->second);
+            if (handleIt->second.empty()) {
+              m_selectorCellLocationsByHandle.erase(handleIt);
+            }
+          }
+        }
+        delete infoIt->second;
+        m_gridCellLocationToInfoMap.erase(infoIt);
+      }
+      delete location;
+      it = rowLocations.erase(it);
     } else {
       ++it;
     }
   }
+
+  if (rowLocations.empty()) {
+    m_gridRowCellLocations.erase(rowIt);
+  }
 }
 
 void OSObjectSelector::addObject(const boost::optional<model::ModelObject>& t_obj, OSWidgetHolder* t_holder, int t_modelRow, int t_gridRow,
@@ -297,20 +319,27 @@ void OSObjectSelector::addObject(const boost::optional<model::ModelObject>& t_ob
   }
 
   m_gridCellLocationToInfoMap.insert(std::make_pair(location, info));
+
+  m_gridRowCellLocations[t_gridRow].push_back(location);
+
+  if (t_isSelector && t_obj) {
+    m_selectorCellLocationsByHandle[t_obj->handle()].push_back(location);
+  }
 }
 
 void OSObjectSelector::setObjectRemoved(const openstudio::Handle& handle) {
   const PropertyChange visible = ChangeToFalse;
   const PropertyChange selected = ChangeToFalse;
   const PropertyChange locked = ChangeToTrue;
-  for (const auto location : m_selectorCellLocations) {
-    GridCellInfo* info = getGridCellInfo(location);
-    if (info && info->modelObject && info->modelObject->handle() == handle) {
-      if (location->subrow) {
-        setSubrowProperties(location->gridRow, location->subrow.get(), visible, selected, locked);
-      } else {
-        setRowProperties(location->gridRow, visible, selected, locked);
-      }
+  auto it = m_selectorCellLocationsByHandle.find(handle);
+  if (it == m_selectorCellLocationsByHandle.end()) {
+    return;
+  }
+  for (const auto location : it->second) {
+    if (location->subrow) {
+      setSubrowProperties(location->gridRow, location->subrow.get(), visible, selected, locked);
+    } else {
+      setRowProperties(location->gridRow, visible, selected, locked);
     }
   }
 }
@@ -382,6 +411,46 @@ void OSObjectSelector::clearSelection() {
   emit gridRowSelectionChanged(0, numSelectable);
 }
 
+void OSObjectSelector::setRangeCells(int t_firstGridRow, int t_firstColumn, int t_lastGridRow, int t_lastColumn) {
+  const auto oldRange = m_rangeCells;
+  m_rangeCells = std::make_tuple(t_firstGridRow, t_firstColumn, t_lastGridRow, t_lastColumn);
+  if (m_rangeCells == oldRange) {
+    return;
+  }
+
+  auto inRange = [](const std::tuple<int, int, int, int>& range, int gridRow, int column) {
+    return std::get<0>(range) >= 0 && gridRow >= std::get<0>(range) && gridRow <= std::get<2>(range) && column >= std::get<1>(range)
+           && column <= std::get<3>(range);
+  };
+
+  // only the rows of the old and new ranges can change
+  std::set<int> gridRows;
+  for (const auto& range : {oldRange, m_rangeCells}) {
+    if (std::get<0>(range) >= 0) {
+      for (int gridRow = std::get<0>(range); gridRow <= std::get<2>(range); ++gridRow) {
+        gridRows.insert(gridRow);
+      }
+    }
+  }
+
+  for (int gridRow : gridRows) {
+    auto rowIt = m_gridRowCellLocations.find(gridRow);
+    if (rowIt == m_gridRowCellLocations.end()) {
+      continue;
+    }
+    for (const auto& location : rowIt->second) {
+      GridCellInfo* info = getGridCellInfo(location);
+      if (info && info->setInRange(inRange(m_rangeCells, location->gridRow, location->column))) {
+        emit gridCellChanged(*location, *info);
+      }
+    }
+  }
+}
+
+void OSObjectSelector::clearRangeCells() {
+  setRangeCells(-1, -1, -1, -1);
+}
+
 void OSObjectSelector::onRowNeedsStyle(int modelRow, int gridRow) {
 
   std::vector<std::pair<GridCellLocation*, PropertyChange>> visibleChanges;
@@ -487,36 +556,41 @@ void OSObjectSelector::updateRowsAndSubrows(const std::vector<std::pair<GridCell
 }
 
 void OSObjectSelector::setRowProperties(const int t_gridRow, PropertyChange t_visible, PropertyChange t_selected, PropertyChange t_locked) {
-  for (auto& locationInfoPair : m_gridCellLocationToInfoMap) {
-    if (locationInfoPair.first->gridRow == t_gridRow) {
+  auto rowIt = m_gridRowCellLocations.find(t_gridRow);
+  if (rowIt == m_gridRowCellLocations.end()) {
+    return;
+  }
+  for (const auto location : rowIt->second) {
+    GridCellInfo* info = getGridCellInfo(location);
+    if (info) {
       bool changed = false;
 
       if (t_visible == ChangeToFalse) {
-        changed = locationInfoPair.second->setVisible(false) || changed;
+        changed = info->setVisible(false) || changed;
       } else if (t_visible == ChangeToTrue) {
-        changed = locationInfoPair.second->setVisible(true) || changed;
+        changed = info->setVisible(true) || changed;
       } else if (t_visible == ToggleChange) {
-        changed = locationInfoPair.second->setVisible(!locationInfoPair.second->isVisible()) || changed;
+        changed = info->setVisible(!info->isVisible()) || changed;
       }
 
       if (t_selected == ChangeToFalse) {
-        changed = locationInfoPair.second->setSelected(false) || changed;
+        changed = info->setSelected(false) || changed;
       } else if (t_selected == ChangeToTrue) {
-        changed = locationInfoPair.second->setSelected(true) || changed;
+        changed = info->setSelected(true) || changed;
       } else if (t_selected == ToggleChange) {
-        changed = locationInfoPair.second->setSelected(!locationInfoPair.second->isSelected()) || changed;
+        changed = info->setSelected(!info->isSelected()) || changed;
       }
 
       if (t_locked == ChangeToFalse) {
-        changed = locationInfoPair.second->setLocked(false) || changed;
+        changed = info->setLocked(false) || changed;
       } else if (t_locked == ChangeToTrue) {
-        changed = locationInfoPair.second->setLocked(true) || changed;
+        changed = info->setLocked(true) || changed;
       } else if (t_locked == ToggleChange) {
-        changed = locationInfoPair.second->setLocked(!locationInfoPair.second->isLocked()) || changed;
+        changed = info->setLocked(!info->isLocked()) || changed;
       }
 
       if (changed) {
-        emit gridCellChanged(*locationInfoPair.first, *locationInfoPair.second);
+        emit gridCellChanged(*location, *info);
       }
     }
   }
@@ -524,36 +598,41 @@ void OSObjectSelector::setRowProperties(const int t_gridRow, PropertyChange t_vi
 
 void OSObjectSelector::setSubrowProperties(const int t_gridRow, const int t_subrow, PropertyChange t_visible, PropertyChange t_selected,
                                            PropertyChange t_locked) {
-  for (auto& locationInfoPair : m_gridCellLocationToInfoMap) {
-    if (locationInfoPair.first->gridRow == t_gridRow && locationInfoPair.first->subrow == t_subrow) {
+  auto rowIt = m_gridRowCellLocations.find(t_gridRow);
+  if (rowIt == m_gridRowCellLocations.end()) {
+    return;
+  }
+  for (const auto location : rowIt->second) {
+    GridCellInfo* info = getGridCellInfo(location);
+    if (info && location->subrow == t_subrow) {
       bool changed = false;
 
       if (t_visible == ChangeToFalse) {
-        changed = locationInfoPair.second->setVisible(false) || changed;
+        changed = info->setVisible(false) || changed;
       } else if (t_visible == ChangeToTrue) {
-        changed = locationInfoPair.second->setVisible(true) || changed;
+        changed = info->setVisible(true) || changed;
       } else if (t_visible == ToggleChange) {
-        changed = locationInfoPair.second->setVisible(!locationInfoPair.second->isVisible()) || changed;
+        changed = info->setVisible(!info->isVisible()) || changed;
       }
 
       if (t_selected == ChangeToFalse) {
-        changed = locationInfoPair.second->setSelected(false) || changed;
+        changed = info->setSelected(false) || changed;
       } else if (t_selected == ChangeToTrue) {
-        changed = locationInfoPair.second->setSelected(true) || changed;
+        changed = info->setSelected(true) || changed;
       } else if (t_selected == ToggleChange) {
-        changed = locationInfoPair.second->setSelected(!locationInfoPair.second->isSelected()) || changed;
+        changed = info->setSelected(!info->isSelected()) || changed;
       }
 
       if (t_locked == ChangeToFalse) {
-        changed = locationInfoPair.second->setLocked(false) || changed;
+        changed = info->setLocked(false) || changed;
       } else if (t_locked == ChangeToTrue) {
-        changed = locationInfoPair.second->setLocked(true) || changed;
+        changed = info->setLocked(true) || changed;
       } else if (t_locked == ToggleChange) {
-        changed = locationInfoPair.second->setLocked(!locationInfoPair.second->isLocked()) || changed;
+        changed = info->setLocked(!info->isLocked()) || changed;
       }
 
       if (changed) {
-        emit gridCellChanged(*locationInfoPair.first, *locationInfoPair.second);
+        emit gridCellChanged(*location, *info);
       }
     }
   }
@@ -37,6 +37,8 @@
 
 #include <string>
 #include <functional>
+#include <map>
+#include <tuple>
 #include <vector>
 
 #include <QObject>
@@ -108,10 +110,17 @@ class GridCellInfo : public QObject
   // returns true if changed
   bool setLocked(bool locked);
 
+  // true if the cell is in the range that copy and paste act on
+  bool isInRange() const;
+
+  // returns true if changed
+  bool setInRange(bool inRange);
+
  private:
   bool m_isVisible;
   bool m_isSelected;
   bool m_isLocked;
+  bool m_isInRange;
 };
 
 /// OSObjectSelector keeps track of which cells are selected, filtered/not visible, and locked
@@ -162,6 +171,12 @@ class OSObjectSelector : public QObject
   // Clear the selection
   void clearSelection();
 
+  // Mark the cells between these grid rows and columns as the range, unmarking the cells of the previous range
+  void setRangeCells(int t_firstGridRow, int t_firstColumn, int t_lastGridRow, int t_lastColumn);
+
+  // Unmark the cells of the range
+  void clearRangeCells();
+
   // Check if an object is selected
   bool getObjectSelected(const model::ModelObject& t_obj) const;
 
@@ -227,6 +242,18 @@ class OSObjectSelector : public QObject
 
   std::vector<GridCellLocation*> m_selectorOrParentCellLocations;
 
+  // all cells by grid row, so that row updates don't visit every cell in the grid
+  std::map<int, std::vector<GridCellLocation*>> m_gridRowCellLocations;
+
+  // selector cells by the handle of their object, so that removing an object doesn't visit every selector cell
+  std::map<Handle, std::vector<GridCellLocation*>> m_selectorCellLocationsByHandle;
+
+  // first grid row, first column, last grid row and last column of the marked range, -1 if there is none
+  std::tuple<int, int, int, int> m_rangeCells;
+
+  // Delete the cells of a grid row matching the predicate, only visits the cells of that row unless one is deleted
+  void eraseRowCellLocations(int t_gridRow, const std::function<bool(GridCellLocation*)>& t_predicate);
+
   // Apply locked and not visible properties to rows and subrows
   void updateRowsAndSubrows(const std::vector<std::pair<GridCellLocation*, PropertyChange>>& visibleChanges,
                             const std::vector<std::pair<GridCellLocation*, PropertyChange>>& lockedChanges);
@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "OSQuantityEdit.hpp"
+#include "ModelObjectChangeBatch.hpp"
 
 #include "../model_editor/Utilities.hpp"
 
@@ -98,6 +99,10 @@ void OSQuantityEdit2::enableClickFocus() {
   m_lineEdit->enableClickFocus();
 }
 
+void OSQuantityEdit2::disableClickFocus() {
+  m_lineEdit->disableClickFocus();
+}
+
 bool OSQuantityEdit2::locked() const {
   return m_lineEdit->locked();
 }
@@ -178,8 +183,8 @@ void OSQuantityEdit2::completeBind(bool isIP, const model::ModelObject& modelObj
 
   setEnabled(true);
 
-  connect(m_lineEdit, &QLineEdit::editingFinished, this,
-          &OSQuantityEdit2::onEditingFinished);  // Evan note: would behaviors improve with "textChanged"?
+  connect(m_lineEdit, &QLineEdit::editingFinished, this, &OSQuantityEdit2::onEditingFinished,
+          Qt::UniqueConnection);  // Evan note: would behaviors improve with "textChanged"?
 
   m_modelObject->getImpl<openstudio::model::detail::ModelObject_Impl>()
     .get()
@@ -303,6 +308,9 @@ void OSQuantityEdit2::onEditingFinished() {
 }
 
 void OSQuantityEdit2::onModelObjectChange() {
+  if (ModelObjectChangeBatch::deferRefresh(this, &OSQuantityEdit2::onModelObjectChange, &OSQuantityEdit2::m_modelObject)) {
+    return;
+  }
   //if (m_modelExtensibleGroup){
   //  if (m_modelExtensibleGroup->empty()){
   //    // this is equivalent to onModelObjectRemove for the extensible group
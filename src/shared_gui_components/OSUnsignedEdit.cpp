@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "OSUnsignedEdit.hpp"
+#include "ModelObjectChangeBatch.hpp"
 
 #include <openstudio/model/ModelObject_Impl.hpp>
 
@@ -194,7 +195,7 @@ void OSUnsignedEdit2::completeBind() {
 
   setEnabled(true);
 
-  connect(this, &OSUnsignedEdit2::editingFinished, this, &OSUnsignedEdit2::onEditingFinished);
+  connect(this, &OSUnsignedEdit2::editingFinished, this, &OSUnsignedEdit2::onEditingFinished, Qt::UniqueConnection);
 
   m_modelObject->getImpl<openstudio::model::detail::ModelObject_Impl>()
     .get()
@@ -304,6 +305,9 @@ void OSUnsignedEdit2::onEditingFinished() {
 }
 
 void OSUnsignedEdit2::onModelObjectChange() {
+  if (ModelObjectChangeBatch::deferRefresh(this, &OSUnsignedEdit2::onModelObjectChange, &OSUnsignedEdit2::m_modelObject)) {
+    return;
+  }
   if (m_modelExtensibleGroup) {
     if (m_modelExtensibleGroup->empty()) {
       // this is equivalent to onModelObjectRemove for the extensible group
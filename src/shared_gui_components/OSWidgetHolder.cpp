@@ -64,10 +64,13 @@ OSWidgetHolder::OSWidgetHolder(OSCellWrapper* cellWrapper, QWidget* widget, bool
   // set properties for style
   this->setProperty("selected", false);
   this->setProperty("even", m_isEven);
+  this->setProperty("inRange", false);
 
   this->setStyleSheet("QWidget#OSWidgetHolder[selected=\"true\"]{ border: none; background-color: #94b3de; }"
                       "QWidget#OSWidgetHolder[selected=\"false\"][even=\"true\"] { border: none; background-color: #ededed; }"
                       "QWidget#OSWidgetHolder[selected=\"false\"][even=\"false\"] { border: none; background-color: #cecece; }"
+                      "QWidget#OSWidgetHolder[inRange=\"true\"][even=\"true\"] { border: 1px solid #2f5e9e; background-color: #c5d6ee; }"
+                      "QWidget#OSWidgetHolder[inRange=\"true\"][even=\"false\"] { border: 1px solid #2f5e9e; background-color: #b3c8e6; }"
                       "QWidget#OSWidgetHolder { border: none; background-color: #ff0000; }");
 }
 
@@ -133,6 +136,12 @@ void OSWidgetHolder::setCellProperties(const GridCellLocation& location, const G
     isChanged = true;
   }
 
+  QVariant currentInRange = this->property("inRange");
+  if (currentInRange.isNull() || currentInRange.toBool() != info.isInRange()) {
+    this->setProperty("inRange", info.isInRange());
+    isChanged = true;
+  }
+
   if (isChanged) {
     this->style()->unpolish(this);
     this->style()->polish(this);